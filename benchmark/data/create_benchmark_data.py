@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+"""Create the HDF5 fixtures read by the h5db benchmarks in benchmark/h5db/.
+
+Every fixture holds 10 million logical rows (or the equivalent bytes for the wide and 4-D layouts), so timings of
+different layouts can be compared directly. Values are deterministic, so the benchmarks can check their results.
+Existing fixtures are kept unless --force is given.
+"""
+
+import argparse
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+DATA_DIR = Path(__file__).resolve().parent
+
+TALL_ROWS = 10_000_000
+TALL_CHUNK_ROWS = 65_536
+TENSOR_ROWS = 1_000_000
+TENSOR_SHAPE = (2, 2, 4)
+WIDE_ROWS = 200_000
+WIDE_COLUMNS = 64
+MANY_SMALL_FILES = 1000
+RUN_ROWS = 100
+
+WRITE_BLOCK_ROWS = 1_000_000
+
+
+def write_tall(path: Path, **dataset_options) -> None:
+    with h5py.File(path, "w") as h5:
+        dataset = h5.create_dataset("values", shape=(TALL_ROWS,), dtype=np.int64, **dataset_options)
+        for start in range(0, TALL_ROWS, WRITE_BLOCK_ROWS):
+            stop = min(start + WRITE_BLOCK_ROWS, TALL_ROWS)
+            dataset[start:stop] = np.arange(start, stop, dtype=np.int64)
+
+
+def create_tall_contiguous(path: Path) -> None:
+    write_tall(path)
+
+
+def create_tall_chunked(path: Path) -> None:
+    write_tall(path, chunks=(TALL_CHUNK_ROWS,))
+
+
+def create_tall_compressed(path: Path) -> None:
+    write_tall(path, chunks=(TALL_CHUNK_ROWS,), compression="gzip", compression_opts=4, shuffle=True)
+
+
+def create_tensor_4d(path: Path) -> None:
+    row_elements = int(np.prod(TENSOR_SHAPE))
+    with h5py.File(path, "w") as h5:
+        dataset = h5.create_dataset(
+            "tensor", shape=(TENSOR_ROWS, *TENSOR_SHAPE), dtype=np.int32, chunks=(16_384, *TENSOR_SHAPE)
+        )
+        block_rows = WRITE_BLOCK_ROWS // row_elements
+        for start in range(0, TENSOR_ROWS, block_rows):
+            stop = min(start + block_rows, TENSOR_ROWS)
+            values = np.arange(start * row_elements, stop * row_elements, dtype=np.int32)
+            dataset[start:stop] = values.reshape((stop - start, *TENSOR_SHAPE))
+
+
+def create_wide(path: Path) -> None:
+    base = np.arange(WIDE_ROWS, dtype=np.int32) % 1000
+    with h5py.File(path, "w") as h5:
+        for column in range(WIDE_COLUMNS):
+            h5.create_dataset(f"c{column:02d}", data=base + column, chunks=(TALL_CHUNK_ROWS,))
+
+
+def create_many_small(directory: Path) -> None:
+    directory.mkdir(parents=True, exist_ok=True)
+    rows_per_file = TALL_ROWS // MANY_SMALL_FILES
+    for file_idx in range(MANY_SMALL_FILES):
+        start = file_idx * rows_per_file
+        with h5py.File(directory / f"part_{file_idx:04d}.h5", "w") as h5:
+            h5.create_dataset("values", data=np.arange(start, start + rows_per_file, dtype=np.int64))
+
+
+def create_run_encoded(path: Path) -> None:
+    num_runs = TALL_ROWS // RUN_ROWS
+    with h5py.File(path, "w") as h5:
+        h5.create_dataset("time", data=np.arange(TALL_ROWS, dtype=np.int64), chunks=(TALL_CHUNK_ROWS,))
+        h5.create_dataset("state_run_starts", data=np.arange(0, TALL_ROWS, RUN_ROWS, dtype=np.int64))
+        h5.create_dataset("state_values", data=(np.arange(num_runs, dtype=np.int32) % 7))
+
+
+FIXTURES = [
+    ("tall_contiguous.h5", create_tall_contiguous),
+    ("tall_chunked.h5", create_tall_chunked),
+    ("tall_compressed.h5", create_tall_compressed),
+    ("tensor_4d.h5", create_tensor_4d),
+    ("wide.h5", create_wide),
+    ("many_small", create_many_small),
+    ("run_encoded.h5", create_run_encoded),
+]
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--force", action="store_true", help="Recreate fixtures that already exist")
+    args = parser.parse_args()
+
+    for name, create in FIXTURES:
+        path = DATA_DIR / name
+        if path.exists() and not args.force:
+            print(f"Keeping {path.relative_to(DATA_DIR.parent.parent)}")
+            continue
+        print(f"Creating {path.relative_to(DATA_DIR.parent.parent)}...")
+        create(path)
+        if path.is_file():
+            path.chmod(0o644)
+        else:
+            for part in path.glob("*.h5"):
+                part.chmod(0o644)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+"""Run the h5db benchmarks at several thread counts against local, HTTP and SFTP files.
+
+Benchmarks are run with DuckDB's benchmark runner. For the remote backends, the benchmark files are rewritten to
+read benchmark/data through the local range HTTP server or the local SFTP test server, the same way the remote test
+suites rewrite test/data. Every timed run becomes one CSV row with rows/s and bytes/s computed from the `# rows:` and
+`# bytes:` header lines of the benchmark file. After the timed runs, every benchmark query runs once more in the DuckDB
+shell at the same thread count to record the h5db_scan_stats() counters of one run (H5Dread calls, remote requests,
+wait times) next to its timings.
+"""
+
+from __future__ import annotations
+
+import argparse
+import csv
+import os
+import platform
+import re
+import shutil
+import socket
+import subprocess
+import sys
+import tempfile
+import time
+from pathlib import Path
+
+PROJECT_ROOT = Path(__file__).resolve().parents[2]
+BENCHMARK_DIR = PROJECT_ROOT / "benchmark" / "h5db"
+DATA_DIR = PROJECT_ROOT / "benchmark" / "data"
+REWRITE_ROOT = PROJECT_ROOT / "benchmark" / "rewritten"
+TEST_SCRIPTS = PROJECT_ROOT / "test" / "scripts"
+
+TIMING_RE = re.compile(r"^(benchmark/\S+\.benchmark)\t(\d+)\t([0-9.eE+-]+)$")
+HEADER_RE = re.compile(r"^#\s*(rows|bytes):\s*(\d+)\s*$")
+
+# h5db_scan_stats() counters recorded for one run of each benchmark query
+SCAN_COUNTERS = [
+    "h5dread_calls",
+    "chunk_direct_reads",
+    "cache_window_fills",
+    "fetch_wait_ns",
+    "hdf5_lock_wait_ns",
+    "remote_fetches",
+    "remote_bytes_fetched",
+]
+
+SFTP_USERNAME = "h5db"
+SFTP_PASSWORD = "h5db"
+
+
+def parse_args() -> argparse.Namespace:
+    p = argparse.ArgumentParser(description="Run h5db benchmarks and write machine-readable results")
+    p.add_argument(
+        "--runner",
+        default=str(PROJECT_ROOT / "build" / "release" / "benchmark" / "benchmark_runner"),
+        help="benchmark_runner binary (default: build/release/benchmark/benchmark_runner)",
+    )
+    p.add_argument(
+        "--shell",
+        default=str(PROJECT_ROOT / "build" / "release" / "duckdb"),
+        help="DuckDB shell with h5db linked in, used to record scan counters (default: build/release/duckdb)",
+    )
+    p.add_argument("--threads", default="1,2,4,8", help="Comma-separated thread counts (default: 1,2,4,8)")
+    p.add_argument(
+        "--backends", default="local,http,sftp", help="Comma-separated backends: local, http, sftp (default: all)"
+    )
+    p.add_argument("--pattern", default=".*", help="Regex on benchmark file names (default: all)")
+    p.add_argument(
+        "--out",
+        default=str(PROJECT_ROOT / "benchmark_results" / "h5db.csv"),
+        help="CSV output path (default: benchmark_results/h5db.csv)",
+    )
+    p.add_argument("--http-port", type=int, default=18180, help="Port for the local HTTP server (default: 18180)")
+    p.add_argument("--sftp-port", type=int, default=2322, help="Port for the local SFTP server (default: 2322)")
+    return p.parse_args()
+
+
+def read_benchmark_sizes(path: Path) -> dict[str, int]:
+    sizes = {}
+    for line in path.read_text(encoding="utf-8").splitlines():
+        match = HEADER_RE.match(line)
+        if match:
+            sizes[match.group(1)] = int(match.group(2))
+    return sizes
+
+
+def read_benchmark_sections(path: Path) -> dict[str, str]:
+    """SQL of the load and run sections; a section ends at the first blank line."""
+    sections: dict[str, list[str]] = {}
+    current = None
+    for line in path.read_text(encoding="utf-8").splitlines():
+        if current is None:
+            if line.strip() in ("load", "run"):
+                current = sections.setdefault(line.strip(), [])
+            continue
+        if not line.strip():
+            current = None
+            continue
+        current.append(line)
+    return {name: "\n".join(lines) for name, lines in sections.items()}
+
+
+def collect_scan_counters(shell: str, path: Path, threads: int) -> dict[str, int]:
+    sections = read_benchmark_sections(path)
+    script = "\n".join(
+        [
+            f"SET threads={threads};",
+            sections.get("load", ""),
+            "CREATE TEMP TABLE h5db_stats_before AS FROM h5db_scan_stats();",
+            f".output {os.devnull}",
+            sections["run"],
+            ".output",
+            ".mode csv",
+            ".headers off",
+            "SELECT a.metric, a.value - b.value FROM h5db_scan_stats() a JOIN h5db_stats_before b USING (metric);",
+        ]
+    )
+    completed = subprocess.run([shell, "-batch"], input=script, cwd=PROJECT_ROOT, capture_output=True, text=True)
+    if completed.returncode != 0:
+        sys.stderr.write(completed.stderr)
+        raise SystemExit(f"Recording scan counters for {path} failed with code {completed.returncode}")
+    counters = {}
+    for row in csv.reader(completed.stdout.splitlines()):
+        if len(row) == 2 and row[0] in SCAN_COUNTERS:
+            counters[row[0]] = int(row[1])
+    return counters
+
+
+def wait_for_port(port: int, process: subprocess.Popen, ready_file: Path | None = None) -> None:
+    for _ in range(100):
+        if process.poll() is not None:
+            raise SystemExit(f"Server on port {port} exited with code {process.returncode}")
+        if ready_file is None or (ready_file.exists() and ready_file.stat().st_size > 0):
+            try:
+                with socket.create_connection(("127.0.0.1", port), timeout=0.2):
+                    return
+            except OSError:
+                pass
+        time.sleep(0.1)
+    raise SystemExit(f"Server on port {port} did not start")
+
+
+def rewrite_benchmarks(backend: str, base_url: str, prelude: str) -> None:
+    output_dir = REWRITE_ROOT / backend / "h5db"
+    shutil.rmtree(output_dir, ignore_errors=True)
+    output_dir.mkdir(parents=True)
+    for src in sorted(BENCHMARK_DIR.glob("*.benchmark")):
+        text = src.read_text(encoding="utf-8")
+        text = text.replace("benchmark/h5db/", f"benchmark/rewritten/{backend}/h5db/")
+        text = text.replace("benchmark/data/", f"{base_url}/")
+        text = text.replace("\nrun\n", f"\nload\n{prelude}\n\nrun\n", 1)
+        (output_dir / src.name).write_text(text, encoding="utf-8")
+
+
+def start_backend(backend: str, args: argparse.Namespace, tmp_dir: Path) -> tuple[str, subprocess.Popen | None]:
+    if backend == "local":
+        return "benchmark/h5db/", None
+    if backend == "http":
+        server = subprocess.Popen(
+            [
+                sys.executable,
+                str(TEST_SCRIPTS / "range_http_server.py"),
+                "--port",
+                str(args.http_port),
+                "--directory",
+                str(DATA_DIR),
+            ],
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL,
+        )
+        wait_for_port(args.http_port, server)
+        rewrite_benchmarks(backend, f"http://127.0.0.1:{args.http_port}", "INSTALL httpfs;\nLOAD httpfs;")
+        return f"benchmark/rewritten/{backend}/h5db/", server
+    if backend == "sftp":
+        known_hosts = tmp_dir / "known_hosts"
+        server = subprocess.Popen(
+            [
+                sys.executable,
+                str(TEST_SCRIPTS / "sftp_test_server.py"),
+                "--port",
+                str(args.sftp_port),
+                "--directory",
+                str(DATA_DIR),
+                "--username",
+                SFTP_USERNAME,
+                "--password",
+                SFTP_PASSWORD,
+                "--host-key-file",
+                str(tmp_dir / "host_key"),
+                "--known-hosts-file",
+                str(known_hosts),
+            ],
+            stdout=subprocess.DEVNULL,
+            stderr=subprocess.DEVNULL,
+        )
+        wait_for_port(args.sftp_port, server, known_hosts)
+        base_url = f"sftp://127.0.0.1:{args.sftp_port}"
+        prelude = (
+            f"CREATE OR REPLACE SECRET h5db_benchmark_sftp (TYPE sftp, SCOPE '{base_url}', "
+            f"USERNAME '{SFTP_USERNAME}', PASSWORD '{SFTP_PASSWORD}', KNOWN_HOSTS_PATH '{known_hosts.as_posix()}', "
+            f"PORT {args.sftp_port});"
+        )
+        rewrite_benchmarks(backend, base_url, prelude)
+        return f"benchmark/rewritten/{backend}/h5db/", server
+    raise SystemExit(f"Unknown backend: {backend}")
+
+
+def run_benchmarks(runner: str, prefix: str, pattern: str, threads: int) -> list[tuple[str, int, float]]:
+    command = [runner, f"{prefix}{pattern}", f"--threads={threads}"]
+    completed = subprocess.run(command, cwd=PROJECT_ROOT, capture_output=True, text=True)
+    if completed.returncode != 0:
+        sys.stderr.write(completed.stdout)
+        sys.stderr.write(completed.stderr)
+        raise SystemExit(f"benchmark_runner failed with code {completed.returncode}: {' '.join(command)}")
+    timings = []
+    for line in completed.stdout.splitlines():
+        match = TIMING_RE.match(line.strip())
+        if match:
+            timings.append((match.group(1), int(match.group(2)), float(match.group(3))))
+    return timings
+
+
+def main() -> None:
+    args = parse_args()
+    if not Path(args.runner).is_file():
+        raise SystemExit(f"benchmark_runner not found at {args.runner}; build with BUILD_BENCHMARK=1 make")
+    if not Path(args.shell).is_file():
+        raise SystemExit(f"DuckDB shell not found at {args.shell}; build with make")
+    subprocess.run([sys.executable, str(DATA_DIR / "create_benchmark_data.py")], check=True)
+
+    sizes = {path.name: read_benchmark_sizes(path) for path in BENCHMARK_DIR.glob("*.benchmark")}
+    thread_counts = [int(entry) for entry in args.threads.split(",") if entry.strip()]
+    backends = [entry.strip() for entry in args.backends.split(",") if entry.strip()]
+
+    out_path = Path(args.out)
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    with tempfile.TemporaryDirectory(prefix="h5db_benchmark_") as tmp, out_path.open("w", newline="") as out:
+        writer = csv.writer(out)
+        writer.writerow(
+            ["benchmark", "backend", "threads", "run", "seconds", "rows", "bytes", "rows_per_s", "bytes_per_s", "host"]
+            + SCAN_COUNTERS
+        )
+        for backend in backends:
+            prefix, server = start_backend(backend, args, Path(tmp))
+            try:
+                for threads in thread_counts:
+                    counters: dict[str, dict[str, int]] = {}
+                    for name, run, seconds in run_benchmarks(args.runner, prefix, args.pattern, threads):
+                        if name not in counters:
+                            counters[name] = collect_scan_counters(args.shell, PROJECT_ROOT / name, threads)
+                        benchmark = Path(name).stem
+                        size = sizes.get(Path(name).name, {})
+                        rows = size.get("rows", 0)
+                        nbytes = size.get("bytes", 0)
+                        writer.writerow(
+                            [
+                                benchmark,
+                                backend,
+                                threads,
+                                run,
+                                f"{seconds:.6f}",
+                                rows,
+                                nbytes,
+                                f"{rows / seconds:.0f}" if seconds > 0 else "",
+                                f"{nbytes / seconds:.0f}" if seconds > 0 else "",
+                                platform.node(),
+                            ]
+                            + [counters[name].get(counter, "") for counter in SCAN_COUNTERS]
+                        )
+                        print(f"{backend}\t{threads}\t{benchmark}\t{run}\t{seconds:.3f}s", flush=True)
+            finally:
+                if server is not None:
+                    server.terminate()
+                    server.wait()
+                shutil.rmtree(REWRITE_ROOT / backend, ignore_errors=True)
+    print(f"Results written to {out_path}")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,10 +1,13 @@
 #include "h5_functions.hpp"
 #include "h5_internal.hpp"
 #include "h5_raii.hpp"
+#include "h5_file_cache.hpp"
+#include "h5_scalar_cache.hpp"
 #include "h5_tree_shared.hpp"
 #include "duckdb/common/multi_file/multi_file_reader.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/function/scalar_function.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
@@ -16,9 +19,9 @@
 #include "duckdb/common/types/vector.hpp"
 #endif
 #include <algorithm>
+#include <atomic>
 #include <optional>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 namespace duckdb {
@@ -49,15 +52,25 @@ struct H5AttributesBindData : public TableFunctionData {
 	}
 };
 
+// Each file is one row, so local scan states claim batches of consecutive files. Batches are small
+// enough that every thread gets several of them while the files of a batch still fit in one chunk.
+static constexpr idx_t H5_ATTRIBUTES_BATCHES_PER_THREAD = 4;
+
 struct H5AttributesGlobalState : public GlobalTableFunctionState {
-	idx_t file_idx = 0;
 	H5AttributesScanLayout output_layout;
+	idx_t file_count = 0;
+	idx_t files_per_batch = 1;
+	std::atomic<idx_t> next_file_idx {0};
 
 	idx_t MaxThreads() const override {
-		return 1;
+		return MaxValue<idx_t>((file_count + files_per_batch - 1) / files_per_batch, 1);
 	}
 };
 
+struct H5AttributesLocalState : public LocalTableFunctionState {
+	idx_t batch_index = 0; // First file of the batch this local state returned last
+};
+
 struct H5AttributesScalarBindData : public FunctionData {
 	bool swmr = false;
 
@@ -251,9 +264,19 @@ static unique_ptr<GlobalTableFunctionState> H5AttributesInit(ClientContext &cont
 	auto &bind_data = input.bind_data->Cast<H5AttributesBindData>();
 	auto result = make_uniq<H5AttributesGlobalState>();
 	result->output_layout = H5AttributesBuildOutputLayout(bind_data, input.column_ids);
+	result->file_count = bind_data.filenames.size();
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	auto batches = MaxValue<idx_t>(thread_count, 1) * H5_ATTRIBUTES_BATCHES_PER_THREAD;
+	result->files_per_batch = MinValue<idx_t>(MaxValue<idx_t>(result->file_count / batches, 1), STANDARD_VECTOR_SIZE);
 	return std::move(result);
 }
 
+static unique_ptr<LocalTableFunctionState> H5AttributesInitLocal(ExecutionContext &context,
+                                                                 TableFunctionInitInput &input,
+                                                                 GlobalTableFunctionState *global_state) {
+	return make_uniq<H5AttributesLocalState>();
+}
+
 static void H5AttributesPopulateFilenameColumns(const string &filename, const H5AttributesScanLayout &layout,
                                                 DataChunk &output, idx_t row_idx) {
 	for (auto output_idx : layout.filename_output_idxs) {
@@ -276,24 +299,34 @@ static void H5AttributesWriteFileRow(ClientContext &context, const H5AttributesB
                                      idx_t row_idx) {
 	ThrowIfInterrupted(context);
 
-	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
-	H5ErrorSuppressor suppress_errors;
-	H5FileHandle file(&context, filename.c_str(), H5F_ACC_RDONLY, bind_data.swmr);
+	// Open the file before taking the lock, so that file system requests of other threads' files overlap.
+	H5FileHandle file;
+	{
+		H5ErrorSuppressor suppress_errors;
+		file = H5OpenFile(context, filename, bind_data.swmr);
+	}
 	if (!file.is_valid()) {
 		throw IOException(FormatRemoteFileError("Failed to open HDF5 file", filename));
 	}
 
-	H5ObjectHandle obj(file, bind_data.object_path.c_str());
-	if (!obj.is_valid()) {
-		throw IOException(FormatHDF5ObjectError("Failed to open object", filename, bind_data.object_path));
+	vector<Value> values;
+	values.reserve(bind_data.attributes.size());
+	{
+		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+		H5ErrorSuppressor suppress_errors;
+		H5ObjectHandle obj(file, bind_data.object_path.c_str());
+		if (!obj.is_valid()) {
+			throw IOException(FormatHDF5ObjectError("Failed to open object", filename, bind_data.object_path));
+		}
+		for (const auto &attr_info : bind_data.attributes) {
+			values.push_back(H5AttributesReadAttributeValue(obj, attr_info, filename, bind_data.object_path));
+		}
 	}
 
 	for (idx_t attr_idx = 0; attr_idx < bind_data.attributes.size(); attr_idx++) {
-		auto value =
-		    H5AttributesReadAttributeValue(obj, bind_data.attributes[attr_idx], filename, bind_data.object_path);
 		auto output_idx = layout.attribute_output_idxs[attr_idx];
 		if (output_idx.has_value()) {
-			output.data[*output_idx].SetValue(row_idx, value);
+			output.data[*output_idx].SetValue(row_idx, values[attr_idx]);
 		}
 	}
 }
@@ -301,33 +334,49 @@ static void H5AttributesWriteFileRow(ClientContext &context, const H5AttributesB
 static void H5AttributesScan(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
 	ThrowIfInterrupted(context);
 	auto &gstate = input.global_state->Cast<H5AttributesGlobalState>();
+	auto &lstate = input.local_state->Cast<H5AttributesLocalState>();
 	auto &bind_data = input.bind_data->Cast<H5AttributesBindData>();
 
+	auto first_file_idx = gstate.next_file_idx.fetch_add(gstate.files_per_batch);
+	if (first_file_idx >= bind_data.filenames.size()) {
+		output.SetCardinality(0);
+		return;
+	}
+	auto end_file_idx = MinValue<idx_t>(first_file_idx + gstate.files_per_batch, bind_data.filenames.size());
 	idx_t row_idx = 0;
-	while (gstate.file_idx < bind_data.filenames.size() && row_idx < STANDARD_VECTOR_SIZE) {
-		auto &filename = bind_data.filenames[gstate.file_idx];
+	for (auto file_idx = first_file_idx; file_idx < end_file_idx; file_idx++) {
+		auto &filename = bind_data.filenames[file_idx];
 		H5AttributesWriteFileRow(context, bind_data, filename, gstate.output_layout, output, row_idx);
 		H5AttributesPopulateFilenameColumns(filename, gstate.output_layout, output, row_idx);
-		gstate.file_idx++;
 		row_idx++;
 	}
+	lstate.batch_index = first_file_idx;
 	output.SetCardinality(row_idx);
 }
 
+// Batches are claimed in increasing file order, so the first file of a batch is its batch index.
+static OperatorPartitionData H5AttributesGetPartitionData(ClientContext &context,
+                                                          TableFunctionGetPartitionInput &input) {
+	if (input.partition_info.RequiresPartitionColumns()) {
+		throw InternalException("h5_attributes does not support partition columns");
+	}
+	return OperatorPartitionData(input.local_state->Cast<H5AttributesLocalState>().batch_index);
+}
+
 class H5AttributesScalarFileReader {
 public:
 	H5AttributesScalarFileReader(ClientContext &context_p, string filename_p, bool swmr_p)
 	    : context(context_p), filename(std::move(filename_p)) {
 		H5ErrorSuppressor suppress_errors;
-		file = H5FileHandle(&context, filename.c_str(), H5F_ACC_RDONLY, swmr_p);
+		file = H5OpenFile(context, filename, swmr_p);
 		if (!file.is_valid()) {
 			throw IOException(FormatRemoteFileError("Failed to open HDF5 file", filename));
 		}
 	}
 
-	Value ReadObjectAttributes(const string_t &path_value) {
+	Value ReadObjectAttributes(const string &path_value) {
 		ThrowIfInterrupted(context);
-		auto object_path = NormalizeObjectPath(path_value.GetString());
+		auto object_path = NormalizeObjectPath(path_value);
 
 		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
 		H5ErrorSuppressor suppress_errors;
@@ -350,11 +399,6 @@ private:
 	H5FileHandle file;
 };
 
-struct H5AttributesScalarFileRows {
-	string filename;
-	vector<idx_t> row_idxs;
-};
-
 static unique_ptr<FunctionData> H5AttributesScalarBind(ClientContext &context, ScalarFunction &,
                                                        vector<unique_ptr<Expression>> &arguments) {
 	if (arguments.size() != 2) {
@@ -364,108 +408,22 @@ static unique_ptr<FunctionData> H5AttributesScalarBind(ClientContext &context, S
 	return make_uniq<H5AttributesScalarBindData>(swmr);
 }
 
-static void H5AttributesScalarWriteFileRows(ClientContext &context, const H5AttributesScalarFileRows &file_rows,
-                                            const UnifiedVectorFormat &path_data, const string_t *path_ptr,
-                                            Vector &result, const H5AttributesScalarBindData &bind_data) {
-	if (file_rows.row_idxs.empty()) {
-		return;
-	}
-	ThrowIfInterrupted(context);
-	H5AttributesScalarFileReader reader(context, file_rows.filename, bind_data.swmr);
-	for (auto row_idx : file_rows.row_idxs) {
-		auto path_idx = path_data.sel->get_index(row_idx);
-		result.SetValue(row_idx, reader.ReadObjectAttributes(path_ptr[path_idx]));
-	}
-}
-
 static void H5AttributesScalarFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 	auto &bind_data = func_expr.bind_info->Cast<H5AttributesScalarBindData>();
-	if (args.size() == 0) {
-		result.SetVectorType(VectorType::FLAT_VECTOR);
-		return;
-	}
-
-	auto &filename_vec = args.data[0];
-	auto &path_vec = args.data[1];
-	UnifiedVectorFormat filename_data;
-	UnifiedVectorFormat path_data;
-	filename_vec.ToUnifiedFormat(args.size(), filename_data);
-	path_vec.ToUnifiedFormat(args.size(), path_data);
-	auto filename_ptr = UnifiedVectorFormat::GetData<string_t>(filename_data);
-	auto path_ptr = UnifiedVectorFormat::GetData<string_t>(path_data);
 	auto &context = state.GetContext();
-	auto constant_filename = filename_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
-	auto constant_path = path_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
-
-	if (constant_filename && constant_path) {
-		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-		auto filename_idx = filename_data.sel->get_index(0);
-		auto path_idx = path_data.sel->get_index(0);
-		if (!filename_data.validity.RowIsValid(filename_idx) || !path_data.validity.RowIsValid(path_idx)) {
-			ConstantVector::SetNull(result, true);
-			return;
-		}
-
-		auto filename = filename_ptr[filename_idx].GetString();
+	auto read_paths = [&](const string &filename, const vector<string> &paths, const vector<idx_t> &path_idxs,
+	                      Vector &values, vector<idx_t> &sizes, bool estimate_sizes) {
 		H5AttributesScalarFileReader reader(context, filename, bind_data.swmr);
-		result.SetValue(0, reader.ReadObjectAttributes(path_ptr[path_idx]));
-		return;
-	}
-
-	result.SetVectorType(VectorType::FLAT_VECTOR);
-	auto &validity = FlatVector::Validity(result);
-
-	if (constant_filename) {
-		auto filename_idx = filename_data.sel->get_index(0);
-		if (!filename_data.validity.RowIsValid(filename_idx)) {
-			for (idx_t i = 0; i < args.size(); i++) {
-				validity.SetInvalid(i);
-			}
-			return;
-		}
-
-		H5AttributesScalarFileRows file_rows;
-		file_rows.filename = filename_ptr[filename_idx].GetString();
-		file_rows.row_idxs.reserve(args.size());
-		for (idx_t i = 0; i < args.size(); i++) {
-			auto path_idx = path_data.sel->get_index(i);
-			if (!path_data.validity.RowIsValid(path_idx)) {
-				validity.SetInvalid(i);
-				continue;
+		for (auto path_idx : path_idxs) {
+			auto value = reader.ReadObjectAttributes(paths[path_idx]);
+			if (estimate_sizes) {
+				sizes[path_idx] = H5ScalarValueSize(value);
 			}
-			validity.SetValid(i);
-			file_rows.row_idxs.push_back(i);
+			values.SetValue(path_idx, value);
 		}
-
-		H5AttributesScalarWriteFileRows(context, file_rows, path_data, path_ptr, result, bind_data);
-		return;
-	}
-
-	std::unordered_map<string, idx_t> file_group_lookup;
-	vector<H5AttributesScalarFileRows> file_groups;
-	file_group_lookup.reserve(args.size());
-	file_groups.reserve(args.size());
-	for (idx_t i = 0; i < args.size(); i++) {
-		auto filename_idx = filename_data.sel->get_index(i);
-		auto path_idx = path_data.sel->get_index(i);
-		if (!filename_data.validity.RowIsValid(filename_idx) || !path_data.validity.RowIsValid(path_idx)) {
-			validity.SetInvalid(i);
-			continue;
-		}
-		validity.SetValid(i);
-		auto filename = filename_ptr[filename_idx].GetString();
-		auto inserted = file_group_lookup.emplace(filename, file_groups.size());
-		if (inserted.second) {
-			file_groups.emplace_back();
-			file_groups.back().filename = std::move(filename);
-		}
-		file_groups[inserted.first->second].row_idxs.push_back(i);
-	}
-
-	for (const auto &file_group : file_groups) {
-		H5AttributesScalarWriteFileRows(context, file_group, path_data, path_ptr, result, bind_data);
-	}
+	};
+	H5ScalarExecute(args, state, result, bind_data.swmr, "h5_attributes", read_paths);
 }
 
 void RegisterH5AttributesFunction(ExtensionLoader &loader) {
@@ -478,6 +436,8 @@ void RegisterH5AttributesFunction(ExtensionLoader &loader) {
 	// h5_attributes still intentionally reads every attribute for each emitted row.
 	h5_attributes.projection_pushdown = true;
 	h5_attributes.get_virtual_columns = H5AttributesGetVirtualColumns;
+	h5_attributes.init_local = H5AttributesInitLocal;
+	h5_attributes.get_partition_data = H5AttributesGetPartitionData;
 
 	auto h5_attributes_set = MultiFileReader::CreateFunctionSet(std::move(h5_attributes));
 	CreateTableFunctionInfo info(std::move(h5_attributes_set));
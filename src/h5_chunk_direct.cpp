@@ -0,0 +1,291 @@
+#include "h5_chunk_direct.hpp"
+#include "h5_internal.hpp"
+#include "h5_raii.hpp"
+#include <zlib.h>
+#include <cstring>
+#include <mutex>
+
+namespace duckdb {
+
+// H5Pget_filter2 reports at most this many client values for deflate and shuffle.
+static constexpr size_t H5_CHUNK_DIRECT_MAX_CD_VALUES = 8;
+
+static bool H5ChunkDirectReadFilters(hid_t dcpl, vector<H5ChunkDirectFilter> &filters) {
+	auto filter_count = H5Pget_nfilters(dcpl);
+	if (filter_count < 0) {
+		return false;
+	}
+	for (int filter_idx = 0; filter_idx < filter_count; filter_idx++) {
+		unsigned int flags = 0;
+		size_t cd_count = H5_CHUNK_DIRECT_MAX_CD_VALUES;
+		unsigned int cd_values[H5_CHUNK_DIRECT_MAX_CD_VALUES] = {};
+		unsigned int filter_config = 0;
+		auto filter_id = H5Pget_filter2(dcpl, static_cast<unsigned>(filter_idx), &flags, &cd_count, cd_values, 0,
+		                                nullptr, &filter_config);
+		H5ChunkDirectFilter filter;
+		filter.id = filter_id;
+		if (filter_id == H5Z_FILTER_DEFLATE) {
+			// Nothing to configure: the compression level only matters when writing.
+		} else if (filter_id == H5Z_FILTER_SHUFFLE) {
+			if (cd_count < 1 || cd_values[0] == 0) {
+				return false;
+			}
+			filter.shuffle_element_size = cd_values[0];
+		} else {
+			// Fletcher32, szip, n-bit, scale-offset and plugin filters go through H5Dread.
+			return false;
+		}
+		filters.push_back(filter);
+	}
+	return true;
+}
+
+std::optional<H5ChunkDirectLayout> H5ChunkDirectTryGetLayout(hid_t dataset_id, hid_t mem_type,
+                                                             const std::vector<hsize_t> &dims) {
+	if (dims.empty() || dims[0] == 0) {
+		return std::nullopt;
+	}
+	H5ErrorSuppressor suppress;
+	hid_t dcpl = H5Dget_create_plist(dataset_id);
+	if (dcpl < 0) {
+		return std::nullopt;
+	}
+
+	std::optional<H5ChunkDirectLayout> result;
+	H5ChunkDirectLayout layout;
+	layout.ndims = static_cast<int>(dims.size());
+	std::vector<hsize_t> chunk_dims(dims.size());
+	bool usable = H5Pget_layout(dcpl) == H5D_CHUNKED &&
+	              H5Pget_chunk(dcpl, layout.ndims, chunk_dims.data()) == layout.ndims && chunk_dims[0] > 0 &&
+	              H5ChunkDirectReadFilters(dcpl, layout.filters) && !layout.filters.empty();
+	H5Pclose(dcpl);
+
+	// Each chunk must hold complete rows so that decoded chunks map to contiguous row ranges.
+	for (size_t dim_idx = 1; usable && dim_idx < dims.size(); dim_idx++) {
+		usable = chunk_dims[dim_idx] == dims[dim_idx];
+	}
+	if (!usable) {
+		return std::nullopt;
+	}
+
+	// The memory type must have the exact file representation (same size, byte order, and class), otherwise
+	// HDF5's conversion path is still required.
+	hid_t file_type = H5Dget_type(dataset_id);
+	if (file_type < 0) {
+		return std::nullopt;
+	}
+	auto types_equal = H5Tequal(file_type, mem_type);
+	auto element_size = H5Tget_size(file_type);
+	H5Tclose(file_type);
+	if (types_equal <= 0 || element_size == 0) {
+		return std::nullopt;
+	}
+
+	idx_t row_elements = 1;
+	for (size_t dim_idx = 1; dim_idx < dims.size(); dim_idx++) {
+		row_elements *= dims[dim_idx];
+	}
+	layout.chunk_rows = chunk_dims[0];
+	layout.row_bytes = row_elements * element_size;
+	layout.chunk_bytes = layout.row_bytes * layout.chunk_rows;
+	if (layout.row_bytes == 0 || layout.chunk_bytes / layout.row_bytes != layout.chunk_rows ||
+	    layout.chunk_bytes > std::numeric_limits<uLongf>::max()) {
+		return std::nullopt;
+	}
+	result = std::move(layout);
+	return result;
+}
+
+std::optional<H5ContiguousDirectLayout> H5ContiguousDirectTryGetLayout(hid_t file_id, hid_t dataset_id,
+                                                                       hid_t mem_type,
+                                                                       const std::vector<hsize_t> &dims) {
+	if (dims.empty() || dims[0] == 0) {
+		return std::nullopt;
+	}
+	H5ErrorSuppressor suppress;
+	// Other drivers (family, split, core, the remote VFD) do not map HDF5 addresses to offsets of the named file.
+	hid_t fapl = H5Fget_access_plist(file_id);
+	if (fapl < 0) {
+		return std::nullopt;
+	}
+	auto driver = H5Pget_driver(fapl);
+	H5Pclose(fapl);
+	if (driver != H5FD_SEC2) {
+		return std::nullopt;
+	}
+
+	hid_t dcpl = H5Dget_create_plist(dataset_id);
+	if (dcpl < 0) {
+		return std::nullopt;
+	}
+	bool usable = H5Pget_layout(dcpl) == H5D_CONTIGUOUS && H5Pget_external_count(dcpl) == 0;
+	H5Pclose(dcpl);
+	if (!usable) {
+		return std::nullopt;
+	}
+	// Unallocated datasets read as the fill value, which only H5Dread knows how to produce.
+	auto address = H5Dget_offset(dataset_id);
+	if (address == HADDR_UNDEF) {
+		return std::nullopt;
+	}
+
+	hid_t file_type = H5Dget_type(dataset_id);
+	if (file_type < 0) {
+		return std::nullopt;
+	}
+	auto types_equal = H5Tequal(file_type, mem_type);
+	auto element_size = H5Tget_size(file_type);
+	H5Tclose(file_type);
+	if (types_equal <= 0 || element_size == 0) {
+		return std::nullopt;
+	}
+
+	idx_t row_elements = 1;
+	for (size_t dim_idx = 1; dim_idx < dims.size(); dim_idx++) {
+		row_elements *= dims[dim_idx];
+	}
+	H5ContiguousDirectLayout layout;
+	layout.address = address;
+	layout.row_bytes = row_elements * element_size;
+	auto total_bytes = layout.row_bytes * dims[0];
+	if (layout.row_bytes == 0 || total_bytes / layout.row_bytes != dims[0] ||
+	    H5Dget_storage_size(dataset_id) < total_bytes) {
+		return std::nullopt;
+	}
+	return layout;
+}
+
+bool H5ChunkDirectReadRaw(hid_t dataset_id, const H5ChunkDirectLayout &layout, idx_t row_start, idx_t row_count,
+                          data_ptr_t target, vector<H5ChunkDirectRawChunk> &chunks) {
+	chunks.clear();
+	if (row_count == 0) {
+		return true;
+	}
+	H5ErrorSuppressor suppress;
+	std::vector<hsize_t> offset(layout.ndims, 0);
+	const idx_t row_end = row_start + row_count;
+	for (idx_t chunk_start = (row_start / layout.chunk_rows) * layout.chunk_rows; chunk_start < row_end;
+	     chunk_start += layout.chunk_rows) {
+		offset[0] = chunk_start;
+		unsigned filter_mask = 0;
+		haddr_t address = HADDR_UNDEF;
+		hsize_t stored_bytes = 0;
+		if (H5Dget_chunk_info_by_coord(dataset_id, offset.data(), &filter_mask, &address, &stored_bytes) < 0 ||
+		    address == HADDR_UNDEF || stored_bytes == 0) {
+			// Unallocated chunks read as the fill value, which only H5Dread knows how to produce.
+			return false;
+		}
+
+		H5ChunkDirectRawChunk chunk;
+		chunk.data.resize(stored_bytes);
+		uint32_t read_filter_mask = 0;
+		if (H5Dread_chunk(dataset_id, H5P_DEFAULT, offset.data(), &read_filter_mask, chunk.data.data()) < 0) {
+			return false;
+		}
+		auto copy_start = MaxValue<idx_t>(row_start, chunk_start);
+		auto copy_end = MinValue<idx_t>(row_end, chunk_start + layout.chunk_rows);
+		chunk.filter_mask = read_filter_mask;
+		chunk.chunk_row_offset = copy_start - chunk_start;
+		chunk.row_count = copy_end - copy_start;
+		chunk.target = target + (copy_start - row_start) * layout.row_bytes;
+		chunks.push_back(std::move(chunk));
+	}
+	return true;
+}
+
+static bool H5ChunkDirectInflate(const uint8_t *input, size_t input_bytes, std::vector<uint8_t> &output,
+                                 idx_t expected_bytes) {
+	output.resize(expected_bytes);
+	auto output_bytes = static_cast<uLongf>(expected_bytes);
+	auto status = uncompress(output.data(), &output_bytes, input, static_cast<uLong>(input_bytes));
+	return status == Z_OK && output_bytes == expected_bytes;
+}
+
+static void H5ChunkDirectUnshuffle(const uint8_t *input, size_t input_bytes, size_t element_size,
+                                   std::vector<uint8_t> &output) {
+	output.resize(input_bytes);
+	auto element_count = input_bytes / element_size;
+	for (size_t byte_idx = 0; byte_idx < element_size; byte_idx++) {
+		auto src = input + byte_idx * element_count;
+		auto dst = output.data() + byte_idx;
+		for (size_t element_idx = 0; element_idx < element_count; element_idx++) {
+			dst[element_idx * element_size] = src[element_idx];
+		}
+	}
+	// The shuffle filter leaves trailing bytes that do not form a whole element untouched.
+	auto shuffled_bytes = element_count * element_size;
+	std::memcpy(output.data() + shuffled_bytes, input + shuffled_bytes, input_bytes - shuffled_bytes);
+}
+
+bool H5ChunkDirectDecode(const H5ChunkDirectLayout &layout, const H5ChunkDirectRawChunk &chunk) {
+	const uint8_t *current = chunk.data.data();
+	size_t current_bytes = chunk.data.size();
+	std::vector<uint8_t> buffers[2];
+	idx_t buffer_idx = 0;
+
+	// Filters are applied in pipeline order on write, so they are undone in reverse order here.
+	for (idx_t filter_idx = layout.filters.size(); filter_idx-- > 0;) {
+		if (filter_idx < 32 && (chunk.filter_mask & (1u << filter_idx)) != 0) {
+			// HDF5 skipped this optional filter for the chunk, e.g. because compression did not pay off.
+			continue;
+		}
+		auto &output = buffers[buffer_idx];
+		const auto &filter = layout.filters[filter_idx];
+		if (filter.id == H5Z_FILTER_DEFLATE) {
+			if (!H5ChunkDirectInflate(current, current_bytes, output, layout.chunk_bytes)) {
+				return false;
+			}
+		} else if (filter.id == H5Z_FILTER_SHUFFLE) {
+			if (filter.shuffle_element_size > 1) {
+				H5ChunkDirectUnshuffle(current, current_bytes, filter.shuffle_element_size, output);
+			} else {
+				continue;
+			}
+		} else {
+			return false;
+		}
+		current = output.data();
+		current_bytes = output.size();
+		buffer_idx ^= 1;
+	}
+
+	if (current_bytes != layout.chunk_bytes) {
+		return false;
+	}
+	D_ASSERT(chunk.chunk_row_offset + chunk.row_count <= layout.chunk_rows);
+	std::memcpy(chunk.target, current + chunk.chunk_row_offset * layout.row_bytes, chunk.row_count * layout.row_bytes);
+	return true;
+}
+
+H5ChunkDirectDecodeBatch::H5ChunkDirectDecodeBatch(const H5ChunkDirectLayout &layout_p,
+                                                   vector<H5ChunkDirectRawChunk> chunks_p)
+    : layout(layout_p), chunks(std::move(chunks_p)) {
+}
+
+void H5ChunkDirectDecodeBatch::Help() {
+	for (;;) {
+		auto chunk_idx = next_chunk.fetch_add(1, std::memory_order_acq_rel);
+		if (chunk_idx >= chunks.size()) {
+			return;
+		}
+		if (!failed.load(std::memory_order_relaxed) && !H5ChunkDirectDecode(layout, chunks[chunk_idx])) {
+			failed.store(true, std::memory_order_relaxed);
+		}
+		// Drop the raw bytes as soon as they are decoded to keep peak memory near one window.
+		chunks[chunk_idx].data = std::vector<uint8_t>();
+		if (decoded_chunks.fetch_add(1, std::memory_order_acq_rel) + 1 == chunks.size()) {
+			decoded_chunks.notify_all();
+		}
+	}
+}
+
+bool H5ChunkDirectDecodeBatch::Finish() {
+	Help();
+	for (auto decoded = decoded_chunks.load(std::memory_order_acquire); decoded < chunks.size();
+	     decoded = decoded_chunks.load(std::memory_order_acquire)) {
+		decoded_chunks.wait(decoded, std::memory_order_acquire);
+	}
+	return !failed.load(std::memory_order_acquire);
+}
+
+} // namespace duckdb
@@ -322,6 +322,276 @@ idx_t ResolveScalarReadMemoryLimitOption(ClientContext &context) {
 	return ParseScalarReadMemoryLimitSetting(setting);
 }
 
+idx_t ParsePositiveCountSetting(const Value &setting_value, const char *setting_name) {
+	if (setting_value.IsNull()) {
+		throw InvalidInputException("Invalid value for %s: NULL", setting_name);
+	}
+	auto parsed = setting_value.GetValue<uint64_t>();
+	if (parsed == 0) {
+		throw InvalidInputException("Invalid value for %s: must be at least 1", setting_name);
+	}
+	return parsed;
+}
+
+idx_t ResolvePositiveCountOption(ClientContext &context, const char *setting_name, idx_t default_value) {
+	Value setting;
+	if (!context.TryGetCurrentSetting(setting_name, setting)) {
+		return default_value;
+	}
+	return ParsePositiveCountSetting(setting, setting_name);
+}
+
+idx_t ResolveMaxFilesInFlightOption(ClientContext &context) {
+	return ResolvePositiveCountOption(context, "h5db_max_files_in_flight", H5DB_DEFAULT_MAX_FILES_IN_FLIGHT);
+}
+
+bool ResolveZoneMapsOption(ClientContext &context) {
+	Value setting;
+	if (context.TryGetCurrentSetting("h5db_zone_maps", setting) && !setting.IsNull()) {
+		return setting.GetValue<bool>();
+	}
+	return true;
+}
+
+bool ResolveLateMaterializationOption(ClientContext &context) {
+	Value setting;
+	if (context.TryGetCurrentSetting("h5db_late_materialization", setting) && !setting.IsNull()) {
+		return setting.GetValue<bool>();
+	}
+	return true;
+}
+
+bool ResolveStringDictionaryOption(ClientContext &context) {
+	Value setting;
+	if (context.TryGetCurrentSetting("h5db_string_dictionary", setting) && !setting.IsNull()) {
+		return setting.GetValue<bool>();
+	}
+	return false;
+}
+
+bool ResolveVirtualSourcesOption(ClientContext &context) {
+	Value setting;
+	if (context.TryGetCurrentSetting("h5db_virtual_sources", setting) && !setting.IsNull()) {
+		return setting.GetValue<bool>();
+	}
+	return true;
+}
+
+idx_t ResolveCacheWindowsOption(ClientContext &context) {
+	auto windows = ResolvePositiveCountOption(context, "h5db_cache_windows", H5DB_DEFAULT_CACHE_WINDOWS);
+	return MinValue<idx_t>(windows, H5DB_MAX_CACHE_WINDOWS);
+}
+
+bool ResolveCachePrefetchOption(ClientContext &context) {
+	Value setting;
+	if (context.TryGetCurrentSetting("h5db_cache_prefetch", setting) && !setting.IsNull()) {
+		return setting.GetValue<bool>();
+	}
+	return false;
+}
+
+vector<string> ParseRangeAttributesSetting(const Value &setting_value) {
+	vector<string> result;
+	if (setting_value.IsNull()) {
+		return result;
+	}
+	auto input = setting_value.ToString();
+	auto trimmed = input;
+	StringUtil::Trim(trimmed);
+	if (trimmed.empty()) {
+		return result;
+	}
+	for (auto &name : StringUtil::Split(input, ',')) {
+		StringUtil::Trim(name);
+		if (name.empty()) {
+			throw InvalidInputException("Invalid value for h5db_range_attributes: empty attribute name in '%s'", input);
+		}
+		result.push_back(name);
+	}
+	if (result.size() > 2) {
+		throw InvalidInputException("Invalid value for h5db_range_attributes: expected one attribute holding [min, "
+		                            "max] or a min and a max attribute, got '%s'",
+		                            input);
+	}
+	return result;
+}
+
+vector<string> ResolveRangeAttributesOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_range_attributes", setting)) {
+		return {};
+	}
+	return ParseRangeAttributesSetting(setting);
+}
+
+idx_t ResolveBindSampleFilesOption(ClientContext &context) {
+	Value setting;
+	if (context.TryGetCurrentSetting("h5db_bind_sample_files", setting) && !setting.IsNull()) {
+		return setting.GetValue<uint64_t>();
+	}
+	return 0;
+}
+
+idx_t ParseFileCacheSizeSetting(const Value &setting_value) {
+	if (setting_value.IsNull()) {
+		throw InvalidInputException("Invalid value for h5db_file_cache_size: NULL");
+	}
+	return setting_value.GetValue<uint64_t>();
+}
+
+idx_t ResolveFileCacheSizeOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_file_cache_size", setting)) {
+		return 0;
+	}
+	return ParseFileCacheSizeSetting(setting);
+}
+
+idx_t ParseRemoteBlockSizeSetting(const Value &setting_value) {
+	auto input = setting_value.ToString();
+	if (setting_value.IsNull() || input.empty() || input[0] == '-') {
+		throw InvalidInputException("Invalid value for h5db_remote_block_size: %s", input);
+	}
+	idx_t parsed;
+	try {
+		parsed = DBConfig::ParseMemoryLimit(input);
+	} catch (std::exception &) {
+		throw InvalidInputException("Invalid value for h5db_remote_block_size: %s", input);
+	}
+	if (parsed == 0 || parsed == DConstants::INVALID_INDEX) {
+		throw InvalidInputException("Invalid value for h5db_remote_block_size: %s", input);
+	}
+	return MinValue<idx_t>(parsed, H5DB_MAX_REMOTE_BLOCK_SIZE_BYTES);
+}
+
+idx_t ResolveRemoteBlockSizeOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_remote_block_size", setting)) {
+		return H5DB_DEFAULT_REMOTE_BLOCK_SIZE_BYTES;
+	}
+	return ParseRemoteBlockSizeSetting(setting);
+}
+
+// Parses a byte size where "0" and "none" mean disabled, clamped to max_bytes.
+static idx_t ParseDisableableSizeSetting(const Value &setting_value, const char *setting_name, idx_t max_bytes) {
+	auto input = StringUtil::Lower(setting_value.ToString());
+	if (input == "none" || input == "0") {
+		return 0;
+	}
+	if (setting_value.IsNull() || input.empty() || input[0] == '-') {
+		throw InvalidInputException("Invalid value for %s: %s", setting_name, input);
+	}
+	idx_t parsed;
+	try {
+		parsed = DBConfig::ParseMemoryLimit(input);
+	} catch (std::exception &) {
+		throw InvalidInputException("Invalid value for %s: %s", setting_name, input);
+	}
+	if (parsed == DConstants::INVALID_INDEX) {
+		throw InvalidInputException("Invalid value for %s: %s", setting_name, input);
+	}
+	return MinValue<idx_t>(parsed, max_bytes);
+}
+
+idx_t ParseRemoteReadaheadSetting(const Value &setting_value) {
+	return ParseDisableableSizeSetting(setting_value, "h5db_remote_readahead", H5DB_MAX_REMOTE_READAHEAD_BYTES);
+}
+
+idx_t ResolveRemoteReadaheadOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_remote_readahead", setting)) {
+		return H5DB_DEFAULT_REMOTE_READAHEAD_BYTES;
+	}
+	return ParseRemoteReadaheadSetting(setting);
+}
+
+idx_t ParseScalarCacheSizeSetting(const Value &setting_value) {
+	return ParseDisableableSizeSetting(setting_value, "h5db_scalar_cache_size", NumericLimits<idx_t>::Maximum());
+}
+
+idx_t ResolveScalarCacheSizeOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_scalar_cache_size", setting)) {
+		return 0;
+	}
+	return ParseScalarCacheSizeSetting(setting);
+}
+
+idx_t ResolveRemoteReadaheadConcurrencyOption(ClientContext &context) {
+	return ResolvePositiveCountOption(context, "h5db_remote_readahead_concurrency",
+	                                  H5DB_DEFAULT_REMOTE_READAHEAD_CONCURRENCY);
+}
+
+idx_t ParseRemoteMetadataPrefetchSetting(const Value &setting_value) {
+	return ParseDisableableSizeSetting(setting_value, "h5db_remote_metadata_prefetch",
+	                                   H5DB_MAX_REMOTE_METADATA_PREFETCH_BYTES);
+}
+
+idx_t ResolveRemoteMetadataPrefetchOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_remote_metadata_prefetch", setting)) {
+		return H5DB_DEFAULT_REMOTE_METADATA_PREFETCH_BYTES;
+	}
+	return ParseRemoteMetadataPrefetchSetting(setting);
+}
+
+idx_t ParseRemotePageBufferSetting(const Value &setting_value) {
+	return ParseDisableableSizeSetting(setting_value, "h5db_remote_page_buffer", H5DB_MAX_REMOTE_PAGE_BUFFER_BYTES);
+}
+
+idx_t ResolveRemotePageBufferOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_remote_page_buffer", setting)) {
+		return 0;
+	}
+	return ParseRemotePageBufferSetting(setting);
+}
+
+idx_t ParseRemoteMetadataCacheSetting(const Value &setting_value) {
+	auto size = ParseDisableableSizeSetting(setting_value, "h5db_remote_metadata_cache",
+	                                        H5DB_MAX_REMOTE_METADATA_CACHE_BYTES);
+	return size == 0 ? 0 : MaxValue<idx_t>(size, H5DB_MIN_REMOTE_METADATA_CACHE_BYTES);
+}
+
+idx_t ResolveRemoteMetadataCacheOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_remote_metadata_cache", setting)) {
+		return 0;
+	}
+	return ParseRemoteMetadataCacheSetting(setting);
+}
+
+idx_t ResolveSftpPipelineDepthOption(ClientContext &context) {
+	auto depth = ResolvePositiveCountOption(context, "h5db_sftp_pipeline_depth", H5DB_DEFAULT_SFTP_PIPELINE_DEPTH);
+	return MinValue<idx_t>(depth, H5DB_MAX_SFTP_PIPELINE_DEPTH);
+}
+
+idx_t ParseSftpPoolSizeSetting(const Value &setting_value) {
+	if (setting_value.IsNull()) {
+		throw InvalidInputException("Invalid value for h5db_sftp_pool_size: NULL");
+	}
+	return setting_value.GetValue<uint64_t>();
+}
+
+idx_t ResolveSftpPoolSizeOption(ClientContext &context) {
+	Value setting;
+	if (!context.TryGetCurrentSetting("h5db_sftp_pool_size", setting)) {
+		return H5DB_DEFAULT_SFTP_POOL_SIZE;
+	}
+	return ParseSftpPoolSizeSetting(setting);
+}
+
+idx_t ResolveSftpPoolIdleTimeoutOption(ClientContext &context) {
+	return ResolvePositiveCountOption(context, "h5db_sftp_pool_idle_timeout",
+	                                  H5DB_DEFAULT_SFTP_POOL_IDLE_TIMEOUT_SECONDS);
+}
+
+idx_t ResolveSftpGlobConcurrencyOption(ClientContext &context) {
+	auto concurrency =
+	    ResolvePositiveCountOption(context, "h5db_sftp_glob_concurrency", H5DB_DEFAULT_SFTP_GLOB_CONCURRENCY);
+	return MinValue<idx_t>(concurrency, H5DB_MAX_SFTP_GLOB_CONCURRENCY);
+}
+
 bool IsInterrupted(ClientContext &context) {
 	return context.interrupted.load(std::memory_order_relaxed);
 }
@@ -388,23 +658,27 @@ std::string H5NormalizeExceptionMessage(const std::string &message) {
 	return message;
 }
 
-bool H5StringMatchesCharset(const std::string &value, H5T_cset_t cset) {
+bool H5StringMatchesCharset(const char *data, size_t size, H5T_cset_t cset) {
 	switch (cset) {
 	case H5T_CSET_ASCII:
-		for (auto byte : value) {
-			if (static_cast<unsigned char>(byte) > 0x7F) {
+		for (size_t i = 0; i < size; i++) {
+			if (static_cast<unsigned char>(data[i]) > 0x7F) {
 				return false;
 			}
 		}
 		return true;
 	case H5T_CSET_UTF8:
-		return Value::StringIsValid(value);
+		return Value::StringIsValid(data, size);
 	default:
-		return Value::StringIsValid(value);
+		return Value::StringIsValid(data, size);
 	}
 }
 
-std::string H5DecodeFixedLengthString(const char *raw_data, size_t raw_size, H5T_str_t strpad) {
+bool H5StringMatchesCharset(const std::string &value, H5T_cset_t cset) {
+	return H5StringMatchesCharset(value.data(), value.size(), cset);
+}
+
+size_t H5FixedLengthStringSize(const char *raw_data, size_t raw_size, H5T_str_t strpad) {
 	size_t decoded_size = raw_size;
 	switch (strpad) {
 	case H5T_STR_NULLTERM: {
@@ -425,7 +699,11 @@ std::string H5DecodeFixedLengthString(const char *raw_data, size_t raw_size, H5T
 	default:
 		break;
 	}
-	return std::string(raw_data, decoded_size);
+	return decoded_size;
+}
+
+std::string H5DecodeFixedLengthString(const char *raw_data, size_t raw_size, H5T_str_t strpad) {
+	return std::string(raw_data, H5FixedLengthStringSize(raw_data, raw_size, strpad));
 }
 
 static bool H5StringDecodeModePreservesRawBytes(H5StringDecodeMode string_decode_mode) {
@@ -0,0 +1,288 @@
+#include "h5_file_cache.hpp"
+#include "h5_internal.hpp"
+#include "h5_remote_backend.hpp"
+#include "h5_scan_stats.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#include "duckdb/main/extension_helper.hpp"
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace duckdb {
+
+static std::optional<H5FileIdentity> H5TryStatFile(ClientContext &context, const std::string &filename,
+                                                   bool with_version_tag) {
+	try {
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto handle = fs.OpenFile(filename, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (!handle) {
+			return std::nullopt;
+		}
+		H5FileIdentity result;
+		result.file_size = static_cast<idx_t>(fs.GetFileSize(*handle));
+		result.last_modified = static_cast<int64_t>(fs.GetLastModifiedTime(*handle));
+		if (with_version_tag) {
+			result.version_tag = fs.GetVersionTag(*handle);
+		}
+		return result;
+	} catch (std::exception &) {
+		return std::nullopt;
+	}
+}
+
+std::optional<H5FileIdentity> H5TryGetLocalFileIdentity(ClientContext &context, const std::string &filename) {
+	if (H5RemoteVFD::IsRemotePath(filename)) {
+		return std::nullopt;
+	}
+	return H5TryStatFile(context, filename, false);
+}
+
+std::optional<H5FileIdentity> H5TryGetFileIdentity(ClientContext &context, const std::string &filename) {
+	if (!H5RemoteVFD::IsRemotePath(filename)) {
+		return H5TryStatFile(context, filename, false);
+	}
+	auto descriptor = DescribeH5RemotePath(filename);
+	if (descriptor.type != H5RemoteBackendType::DUCKDB_FS) {
+		// SFTP connections are closed at the end of every query, so their files cannot stay open.
+		return std::nullopt;
+	}
+	if (!descriptor.required_extension.empty()) {
+		ExtensionHelper::AutoLoadExtension(context, descriptor.required_extension);
+	}
+	return H5TryStatFile(context, filename, true);
+}
+
+namespace {
+
+struct H5FileCacheEntry {
+	H5FileIdentity identity;
+	H5FileHandle file;
+	std::unordered_map<string, shared_ptr<H5FileCacheMetadata>> metadata; // Protected by the cache lock
+	bool validated = false; // Identity checked during the current query (protected by the cache lock)
+	std::list<string>::iterator lru_position;
+};
+
+// Entries hold open HDF5 files, so they are only ever destroyed after the cache lock is released: closing a file
+// takes hdf5_global_mutex, and threads already holding hdf5_global_mutex call into the cache.
+using H5FileCacheGarbage = vector<shared_ptr<H5FileCacheEntry>>;
+
+class H5FileCacheState;
+
+// The file caches of all connections, so that a SWMR read can close the handles other connections keep of its file.
+struct H5FileCacheRegistry {
+	std::mutex lock;
+	std::unordered_set<H5FileCacheState *> states; // Protected by lock
+};
+
+H5FileCacheRegistry &GetFileCacheRegistry() {
+	static H5FileCacheRegistry registry;
+	return registry;
+}
+
+class H5FileCacheState : public ClientContextState {
+public:
+	H5FileCacheState() {
+		auto &registry = GetFileCacheRegistry();
+		std::lock_guard<std::mutex> guard(registry.lock);
+		registry.states.insert(this);
+	}
+
+	~H5FileCacheState() override {
+		auto &registry = GetFileCacheRegistry();
+		std::lock_guard<std::mutex> guard(registry.lock);
+		registry.states.erase(this);
+	}
+
+	void QueryBegin(ClientContext &) override {
+		std::lock_guard<std::mutex> guard(lock);
+		for (auto &entry : entries) {
+			entry.second->validated = false;
+		}
+	}
+
+	// Returns the entry for filename if it is still current. Stale entries are dropped; identity is set to the
+	// file's current identity whenever it had to be looked up.
+	shared_ptr<H5FileCacheEntry> Validate(ClientContext &context, const string &filename,
+	                                      std::optional<H5FileIdentity> &identity, H5FileCacheGarbage &garbage) {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			auto it = entries.find(filename);
+			if (it == entries.end()) {
+				// Fall through to look up the identity for the caller.
+			} else if (it->second->validated) {
+				Touch(*it->second);
+				return it->second;
+			}
+		}
+		identity = H5TryGetFileIdentity(context, filename);
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entries.find(filename);
+		if (it == entries.end()) {
+			return nullptr;
+		}
+		if (!identity || *identity != it->second->identity) {
+			RemoveLocked(it, garbage);
+			return nullptr;
+		}
+		it->second->validated = true;
+		Touch(*it->second);
+		return it->second;
+	}
+
+	void Insert(const string &filename, shared_ptr<H5FileCacheEntry> entry, idx_t capacity,
+	            H5FileCacheGarbage &garbage) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entries.find(filename);
+		if (it != entries.end()) {
+			RemoveLocked(it, garbage);
+		}
+		entry->validated = true;
+		lru.push_front(filename);
+		entry->lru_position = lru.begin();
+		entries.emplace(filename, std::move(entry));
+		EvictLocked(capacity, garbage);
+	}
+
+	void Remove(const string &filename, H5FileCacheGarbage &garbage) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entries.find(filename);
+		if (it != entries.end()) {
+			RemoveLocked(it, garbage);
+		}
+	}
+
+	void Evict(idx_t capacity, H5FileCacheGarbage &garbage) {
+		std::lock_guard<std::mutex> guard(lock);
+		EvictLocked(capacity, garbage);
+	}
+
+	shared_ptr<H5FileCacheMetadata> GetMetadata(H5FileCacheEntry &entry, const string &key) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entry.metadata.find(key);
+		return it == entry.metadata.end() ? nullptr : it->second;
+	}
+
+	void SetMetadata(const string &filename, const string &key, shared_ptr<H5FileCacheMetadata> metadata) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entries.find(filename);
+		if (it != entries.end() && it->second->validated) {
+			it->second->metadata[key] = std::move(metadata);
+		}
+	}
+
+private:
+	void Touch(H5FileCacheEntry &entry) {
+		lru.splice(lru.begin(), lru, entry.lru_position);
+	}
+
+	void RemoveLocked(std::unordered_map<string, shared_ptr<H5FileCacheEntry>>::iterator it,
+	                  H5FileCacheGarbage &garbage) {
+		lru.erase(it->second->lru_position);
+		garbage.push_back(std::move(it->second));
+		entries.erase(it);
+	}
+
+	void EvictLocked(idx_t capacity, H5FileCacheGarbage &garbage) {
+		while (entries.size() > capacity) {
+			RemoveLocked(entries.find(lru.back()), garbage);
+		}
+	}
+
+	std::mutex lock;
+	std::list<string> lru; // Most recently used first
+	std::unordered_map<string, shared_ptr<H5FileCacheEntry>> entries;
+};
+
+shared_ptr<H5FileCacheState> GetFileCacheState(ClientContext &context) {
+	return context.registered_state->GetOrCreate<H5FileCacheState>("h5db_file_cache");
+}
+
+// Drops the cached handles of filename from the caches of all connections.
+void RemoveFromAllFileCaches(const string &filename, H5FileCacheGarbage &garbage) {
+	auto &registry = GetFileCacheRegistry();
+	std::lock_guard<std::mutex> guard(registry.lock);
+	for (auto state : registry.states) {
+		state->Remove(filename, garbage);
+	}
+}
+
+// Returns the cache when it is enabled and may hold filename, after trimming it to the configured size. SWMR reads
+// also drop every connection's cached handle of filename: HDF5 shares one open file per process and refuses to open a
+// file for SWMR reading while it is open without SWMR.
+shared_ptr<H5FileCacheState> GetUsableFileCache(ClientContext &context, const string &filename, bool swmr,
+                                                idx_t &capacity, H5FileCacheGarbage &garbage) {
+	capacity = ResolveFileCacheSizeOption(context);
+	auto state = capacity == 0 ? context.registered_state->Get<H5FileCacheState>("h5db_file_cache")
+	                           : GetFileCacheState(context);
+	if (state) {
+		state->Evict(capacity, garbage);
+	}
+	if (swmr) {
+		RemoveFromAllFileCaches(filename, garbage);
+	}
+	if (capacity == 0 || swmr) {
+		return nullptr;
+	}
+	return state;
+}
+
+} // namespace
+
+H5FileHandle H5OpenFile(ClientContext &context, const std::string &filename, bool swmr) {
+	H5FileCacheGarbage garbage;
+	idx_t capacity;
+	auto cache = GetUsableFileCache(context, filename, swmr, capacity, garbage);
+	if (!cache) {
+		// Close evicted files first, so a SWMR open does not find the file still open.
+		garbage.clear();
+		return H5FileHandle(&context, filename.c_str(), H5F_ACC_RDONLY, swmr);
+	}
+
+	std::optional<H5FileIdentity> identity;
+	if (auto entry = cache->Validate(context, filename, identity, garbage)) {
+		auto result = H5FileHandle::Reopen(entry->file);
+		if (result.is_valid()) {
+			H5RecordScanStat(H5ScanCounter::FILE_CACHE_HITS);
+			return result;
+		}
+	}
+	H5RecordScanStat(H5ScanCounter::FILE_CACHE_MISSES);
+	auto result = H5FileHandle(&context, filename.c_str(), H5F_ACC_RDONLY, swmr);
+	if (!identity || !result.is_valid()) {
+		return result;
+	}
+	auto entry = make_shared_ptr<H5FileCacheEntry>();
+	entry->identity = std::move(*identity);
+	entry->file = H5FileHandle::Reopen(result);
+	if (entry->file.is_valid()) {
+		cache->Insert(filename, std::move(entry), capacity, garbage);
+	}
+	return result;
+}
+
+shared_ptr<H5FileCacheMetadata> H5FileCacheGetMetadata(ClientContext &context, const std::string &filename, bool swmr,
+                                                       const std::string &key) {
+	H5FileCacheGarbage garbage;
+	idx_t capacity;
+	auto cache = GetUsableFileCache(context, filename, swmr, capacity, garbage);
+	if (!cache) {
+		return nullptr;
+	}
+	std::optional<H5FileIdentity> identity;
+	auto entry = cache->Validate(context, filename, identity, garbage);
+	return entry ? cache->GetMetadata(*entry, key) : nullptr;
+}
+
+void H5FileCacheSetMetadata(ClientContext &context, const std::string &filename, bool swmr, const std::string &key,
+                            shared_ptr<H5FileCacheMetadata> metadata) {
+	H5FileCacheGarbage garbage;
+	idx_t capacity;
+	auto cache = GetUsableFileCache(context, filename, swmr, capacity, garbage);
+	if (cache) {
+		cache->SetMetadata(filename, key, std::move(metadata));
+	}
+}
+
+} // namespace duckdb
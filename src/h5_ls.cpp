@@ -1,5 +1,6 @@
 #include "h5_functions.hpp"
 #include "h5_internal.hpp"
+#include "h5_scalar_cache.hpp"
 #include "h5_tree_shared.hpp"
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/multi_file/multi_file_reader.hpp"
@@ -20,7 +21,7 @@
 #include "duckdb/common/types/vector.hpp"
 #endif
 #include <algorithm>
-#include <unordered_map>
+#include <atomic>
 #include <vector>
 
 namespace duckdb {
@@ -76,17 +77,23 @@ private:
 	bool exhausted = false;
 };
 
+// Files are handed out to local scan states one at a time, like h5_tree.
 struct H5LsGlobalState : public GlobalTableFunctionState {
-	unique_ptr<H5LsFileScanner> scanner;
-	std::vector<H5TreeNamedRow> batch_rows;
-	idx_t file_idx = 0;
 	H5LsScanLayout output_layout;
+	idx_t file_count = 0;
+	std::atomic<idx_t> next_file_idx {0};
 
 	idx_t MaxThreads() const override {
-		return 1;
+		return MaxValue<idx_t>(file_count, 1);
 	}
 };
 
+struct H5LsLocalState : public LocalTableFunctionState {
+	unique_ptr<H5LsFileScanner> scanner;
+	std::vector<H5TreeNamedRow> batch_rows;
+	idx_t file_idx = 0; // Current file, also the batch index of its rows
+};
+
 struct H5LsScalarBindData : public FunctionData {
 	vector<H5TreeProjectedAttributeSpec> projected_attributes;
 	bool swmr = false;
@@ -306,14 +313,19 @@ static void H5LsPushdownComplexFilter(ClientContext &context, LogicalGet &get, F
 	H5ApplyFilenameFilterPushdown(context, get, bind_data.visible_filename_idx, bind_data.filenames, filters);
 }
 
-static void H5LsOpenFileScanner(ClientContext &context, const H5LsBindData &bind_data, idx_t file_idx,
-                                H5LsGlobalState &state) {
+// Claims the next unscanned file for a local state. Returns false once every file has been claimed.
+static bool H5LsOpenNextFileScanner(ClientContext &context, const H5LsBindData &bind_data, H5LsGlobalState &gstate,
+                                    H5LsLocalState &lstate) {
 	ThrowIfInterrupted(context);
-	D_ASSERT(file_idx < bind_data.filenames.size());
-	state.file_idx = file_idx;
-	state.scanner =
+	auto file_idx = gstate.next_file_idx.fetch_add(1);
+	if (file_idx >= bind_data.filenames.size()) {
+		return false;
+	}
+	lstate.file_idx = file_idx;
+	lstate.scanner =
 	    make_uniq<H5LsFileScanner>(context, bind_data.filenames[file_idx], bind_data.group_path, bind_data.swmr,
-	                               bind_data.projected_attributes, state.output_layout.read_options);
+	                               bind_data.projected_attributes, gstate.output_layout.read_options);
+	return true;
 }
 
 static unique_ptr<GlobalTableFunctionState> H5LsInit(ClientContext &context, TableFunctionInitInput &input) {
@@ -321,35 +333,32 @@ static unique_ptr<GlobalTableFunctionState> H5LsInit(ClientContext &context, Tab
 	auto &bind_data = input.bind_data->Cast<H5LsBindData>();
 	auto result = make_uniq<H5LsGlobalState>();
 	result->output_layout = H5LsBuildOutputLayout(bind_data, input.column_ids);
-	if (!bind_data.filenames.empty()) {
-		H5LsOpenFileScanner(context, bind_data, 0, *result);
-	}
+	result->file_count = bind_data.filenames.size();
 	return std::move(result);
 }
 
+static unique_ptr<LocalTableFunctionState> H5LsInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                         GlobalTableFunctionState *global_state) {
+	return make_uniq<H5LsLocalState>();
+}
+
 static void H5LsScan(ClientContext &context, TableFunctionInput &input, DataChunk &output) {
 	ThrowIfInterrupted(context);
 	auto &bind_data = input.bind_data->Cast<H5LsBindData>();
 	auto &gstate = input.global_state->Cast<H5LsGlobalState>();
-	auto &rows = gstate.batch_rows;
-	if (!gstate.scanner) {
-		D_ASSERT(bind_data.filenames.empty());
-		output.SetCardinality(0);
-		return;
-	}
+	auto &lstate = input.local_state->Cast<H5LsLocalState>();
+	auto &rows = lstate.batch_rows;
 	while (true) {
-		D_ASSERT(gstate.scanner);
-		auto exhausted = gstate.scanner->ReadRows(context, rows);
+		if (!lstate.scanner && !H5LsOpenNextFileScanner(context, bind_data, gstate, lstate)) {
+			output.SetCardinality(0);
+			return;
+		}
+		auto exhausted = lstate.scanner->ReadRows(context, rows);
 		if (!rows.empty()) {
 			break;
 		}
 		D_ASSERT(exhausted);
-		auto next_file_idx = gstate.file_idx + 1;
-		if (next_file_idx >= bind_data.filenames.size()) {
-			output.SetCardinality(0);
-			return;
-		}
-		H5LsOpenFileScanner(context, bind_data, next_file_idx, gstate);
+		lstate.scanner.reset();
 	}
 
 	auto count = rows.size();
@@ -380,11 +389,20 @@ static void H5LsScan(ClientContext &context, TableFunctionInput &input, DataChun
 	if (shape_output_idx.has_value()) {
 		ListVector::SetListSize(output.data[*shape_output_idx], shape_offset);
 	}
-	H5LsPopulateFilenameColumns(bind_data.filenames[gstate.file_idx], gstate.output_layout.filename_output_idxs,
+	H5LsPopulateFilenameColumns(bind_data.filenames[lstate.file_idx], gstate.output_layout.filename_output_idxs,
 	                            output);
 	H5LsPopulateEmptyColumns(gstate.output_layout.empty_output_idxs, output);
 }
 
+// All rows of a file carry its index as batch index, as in h5_tree, so order-preserving sinks return the files in
+// input order.
+static OperatorPartitionData H5LsGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	if (input.partition_info.RequiresPartitionColumns()) {
+		throw InternalException("h5_ls does not support partition columns");
+	}
+	return OperatorPartitionData(input.local_state->Cast<H5LsLocalState>().file_idx);
+}
+
 static unique_ptr<FunctionData> H5LsScalarBindInternal(ClientContext &context, ScalarFunction &bound_function,
                                                        vector<unique_ptr<Expression>> &arguments,
                                                        const char *function_name, bool force_swmr) {
@@ -443,129 +461,50 @@ static unique_ptr<FunctionData> H5LsSwmrScalarBind(ClientContext &context, Scala
 	return H5LsScalarBindInternal(context, bound_function, arguments, "h5_ls_swmr", true);
 }
 
-static void H5LsScalarWriteRow(H5TreeFileReader &reader, const string_t &path_value, Vector &result, idx_t row_idx,
-                               const vector<H5TreeProjectedAttributeSpec> &projected_attributes,
-                               const vector<string> &names, const vector<LogicalType> &return_types) {
-	auto group_path = H5TreeNormalizeObjectPath(path_value.GetString());
+static Value H5LsScalarReadGroup(H5TreeFileReader &reader, const string &path_value,
+                                 const vector<H5TreeProjectedAttributeSpec> &projected_attributes,
+                                 const vector<string> &names, const vector<LogicalType> &return_types) {
+	auto group_path = H5TreeNormalizeObjectPath(path_value);
 	std::vector<H5TreeNamedRow> rows;
 	H5TreeListImmediateEntries(reader, group_path, rows);
-	result.SetValue(row_idx, H5LsBuildMapValue(rows, projected_attributes, names, return_types));
+	return H5LsBuildMapValue(rows, projected_attributes, names, return_types);
 }
 
-struct H5LsScalarFileRows {
-	string filename;
-	vector<idx_t> row_idxs;
-};
-
-static void H5LsScalarWriteFileRows(ClientContext &context, const H5LsScalarFileRows &file_rows,
-                                    const UnifiedVectorFormat &path_data, const string_t *path_ptr, Vector &result,
-                                    const H5LsScalarBindData &bind_data, const vector<string> &names,
-                                    const vector<LogicalType> &return_types) {
-	if (file_rows.row_idxs.empty()) {
-		return;
-	}
-	ThrowIfInterrupted(context);
-	H5TreeFileReader reader(context, file_rows.filename, bind_data.swmr, bind_data.projected_attributes,
-	                        H5TreeReadAll(bind_data.projected_attributes.size()));
-	for (auto row_idx : file_rows.row_idxs) {
-		auto path_idx = path_data.sel->get_index(row_idx);
-		H5LsScalarWriteRow(reader, path_ptr[path_idx], result, row_idx, bind_data.projected_attributes, names,
-		                   return_types);
+// Projected attributes change the result, so they are part of the scalar cache key.
+static string H5LsScalarCacheKey(const vector<H5TreeProjectedAttributeSpec> &projected_attributes) {
+	string result = "h5_ls";
+	auto append = [&](const string &part) { result += std::to_string(part.size()) + ":" + part; };
+	for (const auto &spec : projected_attributes) {
+		append(spec.all_attributes ? "*" : "=" + spec.attribute_name);
+		append(spec.output_column_name);
+		append(spec.output_type.ToString());
+		append(spec.default_value.ToString());
 	}
+	return result;
 }
 
 static void H5LsScalarFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 	auto &bind_data = func_expr.bind_info->Cast<H5LsScalarBindData>();
-	if (args.size() == 0) {
-		result.SetVectorType(VectorType::FLAT_VECTOR);
-		return;
-	}
-
-	auto &filename_vec = args.data[0];
-	auto &path_vec = args.data[1];
-	UnifiedVectorFormat filename_data;
-	UnifiedVectorFormat path_data;
-	filename_vec.ToUnifiedFormat(args.size(), filename_data);
-	path_vec.ToUnifiedFormat(args.size(), path_data);
-	auto filename_ptr = UnifiedVectorFormat::GetData<string_t>(filename_data);
-	auto path_ptr = UnifiedVectorFormat::GetData<string_t>(path_data);
-
 	vector<string> names;
 	vector<LogicalType> return_types;
 	H5LsGetReturnSchema(bind_data.projected_attributes, names, return_types);
 	auto &context = state.GetContext();
-	auto constant_filename = filename_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
-	auto constant_path = path_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
-
-	if (constant_filename && constant_path) {
-		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-		auto filename_idx = filename_data.sel->get_index(0);
-		auto path_idx = path_data.sel->get_index(0);
-		if (!filename_data.validity.RowIsValid(filename_idx) || !path_data.validity.RowIsValid(path_idx)) {
-			ConstantVector::SetNull(result, true);
-			return;
-		}
-		auto filename = filename_ptr[filename_idx].GetString();
+	auto read_paths = [&](const string &filename, const vector<string> &paths, const vector<idx_t> &path_idxs,
+	                      Vector &values, vector<idx_t> &sizes, bool estimate_sizes) {
 		H5TreeFileReader reader(context, filename, bind_data.swmr, bind_data.projected_attributes,
 		                        H5TreeReadAll(bind_data.projected_attributes.size()));
-		H5LsScalarWriteRow(reader, path_ptr[path_idx], result, 0, bind_data.projected_attributes, names, return_types);
-		return;
-	}
-
-	result.SetVectorType(VectorType::FLAT_VECTOR);
-	auto &validity = FlatVector::Validity(result);
-
-	if (constant_filename) {
-		auto filename_idx = filename_data.sel->get_index(0);
-		if (!filename_data.validity.RowIsValid(filename_idx)) {
-			for (idx_t i = 0; i < args.size(); i++) {
-				validity.SetInvalid(i);
+		for (auto path_idx : path_idxs) {
+			auto value =
+			    H5LsScalarReadGroup(reader, paths[path_idx], bind_data.projected_attributes, names, return_types);
+			if (estimate_sizes) {
+				sizes[path_idx] = H5ScalarValueSize(value);
 			}
-			return;
+			values.SetValue(path_idx, value);
 		}
-
-		H5LsScalarFileRows file_rows;
-		file_rows.filename = filename_ptr[filename_idx].GetString();
-		file_rows.row_idxs.reserve(args.size());
-		for (idx_t i = 0; i < args.size(); i++) {
-			auto path_idx = path_data.sel->get_index(i);
-			if (!path_data.validity.RowIsValid(path_idx)) {
-				validity.SetInvalid(i);
-				continue;
-			}
-			validity.SetValid(i);
-			file_rows.row_idxs.push_back(i);
-		}
-
-		H5LsScalarWriteFileRows(context, file_rows, path_data, path_ptr, result, bind_data, names, return_types);
-		return;
-	}
-
-	std::unordered_map<string, idx_t> file_group_lookup;
-	vector<H5LsScalarFileRows> file_groups;
-	file_group_lookup.reserve(args.size());
-	file_groups.reserve(args.size());
-	for (idx_t i = 0; i < args.size(); i++) {
-		auto filename_idx = filename_data.sel->get_index(i);
-		auto path_idx = path_data.sel->get_index(i);
-		if (!filename_data.validity.RowIsValid(filename_idx) || !path_data.validity.RowIsValid(path_idx)) {
-			validity.SetInvalid(i);
-			continue;
-		}
-		validity.SetValid(i);
-		auto filename = filename_ptr[filename_idx].GetString();
-		auto inserted = file_group_lookup.emplace(filename, file_groups.size());
-		if (inserted.second) {
-			file_groups.emplace_back();
-			file_groups.back().filename = std::move(filename);
-		}
-		file_groups[inserted.first->second].row_idxs.push_back(i);
-	}
-
-	for (const auto &file_group : file_groups) {
-		H5LsScalarWriteFileRows(context, file_group, path_data, path_ptr, result, bind_data, names, return_types);
-	}
+	};
+	H5ScalarExecute(args, state, result, bind_data.swmr, H5LsScalarCacheKey(bind_data.projected_attributes),
+	                read_paths);
 }
 
 void RegisterH5LsFunctions(ExtensionLoader &loader) {
@@ -576,6 +515,8 @@ void RegisterH5LsFunctions(ExtensionLoader &loader) {
 	h5_ls_table_function.projection_pushdown = true;
 	h5_ls_table_function.pushdown_complex_filter = H5LsPushdownComplexFilter;
 	h5_ls_table_function.get_virtual_columns = H5GetFilenameVirtualColumns;
+	h5_ls_table_function.init_local = H5LsInitLocal;
+	h5_ls_table_function.get_partition_data = H5LsGetPartitionData;
 	auto h5_ls_table_set = MultiFileReader::CreateFunctionSet(std::move(h5_ls_table_function));
 	CreateTableFunctionInfo table_info(std::move(h5_ls_table_set));
 	table_info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
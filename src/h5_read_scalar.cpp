@@ -1,6 +1,8 @@
 #include "h5_functions.hpp"
 #include "h5_internal.hpp"
 #include "h5_read_shared.hpp"
+#include "h5_file_cache.hpp"
+#include "h5_scalar_cache.hpp"
 #include "duckdb/common/error_data.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
@@ -16,7 +18,6 @@
 #else
 #include "duckdb/common/types/vector.hpp"
 #endif
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -136,6 +137,26 @@ public:
 		retained_bytes = H5ReadScalarSaturatingAdd(retained_bytes, estimate.retained_bytes);
 	}
 
+	// Charges a value that the output chunk repeats from an earlier row or takes from the scalar cache, given the
+	// retained size estimated when it was read.
+	void ChargeReused(const string &filename, const string &dataset_path, idx_t value_retained_bytes) {
+		if (limit == NumericLimits<idx_t>::Maximum()) {
+			return;
+		}
+		// Copying the value has the peak of reading it: three times its retained size, as in the estimates above.
+		auto total_peak = H5ReadScalarSaturatingAdd(H5ReadScalarSaturatingMultiply(retained_bytes, 2),
+		                                            H5ReadScalarSaturatingMultiply(value_retained_bytes, 3));
+		if (total_peak > limit) {
+			throw InvalidInputException(
+			    "Scalar h5_read memory limit exceeded for dataset %s in file %s: the values of this output chunk are "
+			    "estimated to require %s at peak; the h5db_scalar_read_memory_limit is %s. Use table-valued h5_read "
+			    "to stream large datasets, or increase the setting explicitly",
+			    dataset_path, filename, StringUtil::BytesToHumanReadableString(total_peak),
+			    StringUtil::BytesToHumanReadableString(limit));
+		}
+		retained_bytes = H5ReadScalarSaturatingAdd(retained_bytes, value_retained_bytes);
+	}
+
 private:
 	idx_t limit;
 	idx_t retained_bytes = 0;
@@ -219,9 +240,10 @@ static void H5ReadScalarCastVectorToResult(Vector &source, Vector &result, idx_t
 	VectorOperations::Copy(variant, result, 1, 0, result_idx);
 }
 
-static void H5ReadScalarDatasetIntoResult(ClientContext &context, hid_t file, const string &filename,
-                                          const string &dataset_path, Vector &result, idx_t result_idx,
-                                          H5ReadScalarMemoryBudget &memory_budget) {
+// Returns the retained size of the value as charged to the memory budget.
+static idx_t H5ReadScalarDatasetIntoResult(ClientContext &context, hid_t file, const string &filename,
+                                           const string &dataset_path, Vector &result, idx_t result_idx,
+                                           H5ReadScalarMemoryBudget &memory_budget) {
 	std::unique_lock<std::recursive_mutex> hdf5_lock(hdf5_global_mutex);
 	auto [dataset, h5_type] = OpenDatasetAndGetType(file, filename, dataset_path);
 
@@ -242,7 +264,7 @@ static void H5ReadScalarDatasetIntoResult(ClientContext &context, hid_t file, co
 	if (space_class == H5S_NULL) {
 		hdf5_lock.unlock();
 		result.SetValue(result_idx, Value(LogicalType::VARIANT()));
-		return;
+		return 0;
 	}
 	if (space_class != H5S_SCALAR && space_class != H5S_SIMPLE) {
 		throw IOException(FormatDatasetError("Unsupported dataset dataspace class", filename, dataset_path));
@@ -259,19 +281,22 @@ static void H5ReadScalarDatasetIntoResult(ClientContext &context, hid_t file, co
 	ThrowIfInterrupted(context);
 
 	auto array_node_count = H5ReadScalarArrayNodeCount(dims);
+	idx_t retained_bytes = 0;
 	if (is_string) {
 		if (known_string_payload.IsValid()) {
-			memory_budget.Charge(
-			    H5ReadScalarStringMemoryEstimate(element_count, known_string_payload.GetIndex(), array_node_count),
-			    filename, dataset_path, dims, element_count);
+			auto estimate =
+			    H5ReadScalarStringMemoryEstimate(element_count, known_string_payload.GetIndex(), array_node_count);
+			memory_budget.Charge(estimate, filename, dataset_path, dims, element_count);
+			retained_bytes = estimate.retained_bytes;
 		} else {
 			memory_budget.Check(H5ReadScalarStringMemoryEstimate(element_count, 0, array_node_count), filename,
 			                    dataset_path, dims, element_count);
 		}
 	} else {
 		auto element_width = GetTypeIdSize(duckdb_type.InternalType());
-		memory_budget.Charge(H5ReadScalarNumericMemoryEstimate(element_count, element_width, array_node_count),
-		                     filename, dataset_path, dims, element_count);
+		auto estimate = H5ReadScalarNumericMemoryEstimate(element_count, element_width, array_node_count);
+		memory_budget.Charge(estimate, filename, dataset_path, dims, element_count);
+		retained_bytes = estimate.retained_bytes;
 	}
 
 	auto source_type = space_class == H5S_SCALAR ? duckdb_type : H5ReadScalarNestedListType(duckdb_type, dims.size());
@@ -297,8 +322,9 @@ static void H5ReadScalarDatasetIntoResult(ClientContext &context, hid_t file, co
 			                string_data[string_idx] = StringVector::AddString(leaf, str);
 		                });
 		if (!known_string_payload.IsValid()) {
-			memory_budget.Charge(H5ReadScalarStringMemoryEstimate(element_count, decoded_bytes, array_node_count),
-			                     filename, dataset_path, dims, element_count);
+			auto estimate = H5ReadScalarStringMemoryEstimate(element_count, decoded_bytes, array_node_count);
+			memory_budget.Charge(estimate, filename, dataset_path, dims, element_count);
+			retained_bytes = estimate.retained_bytes;
 		}
 	} else {
 		DispatchOnNumericType(duckdb_type, [&](auto type_tag) {
@@ -320,6 +346,7 @@ static void H5ReadScalarDatasetIntoResult(ClientContext &context, hid_t file, co
 	ThrowIfInterrupted(context);
 	H5ReadScalarCastVectorToResult(source, result, result_idx, filename, dataset_path);
 	ThrowIfInterrupted(context);
+	return retained_bytes;
 }
 
 class H5ReadScalarFileReader {
@@ -327,17 +354,17 @@ public:
 	H5ReadScalarFileReader(ClientContext &context_p, string filename_p, bool swmr_p)
 	    : context(context_p), filename(std::move(filename_p)) {
 		H5ErrorSuppressor suppress;
-		file = H5FileHandle(&context, filename.c_str(), H5F_ACC_RDONLY, swmr_p);
+		file = H5OpenFile(context, filename, swmr_p);
 		if (!file.is_valid()) {
 			throw IOException(FormatRemoteHDF5Error("Failed to open HDF5 file", filename));
 		}
 	}
 
-	void ReadDataset(const string_t &path_value, Vector &result, idx_t result_idx,
-	                 H5ReadScalarMemoryBudget &memory_budget) {
+	idx_t ReadDataset(const string &dataset_path, Vector &result, idx_t result_idx,
+	                  H5ReadScalarMemoryBudget &memory_budget) {
 		ThrowIfInterrupted(context);
-		auto dataset_path = path_value.GetString();
-		H5ReadScalarDatasetIntoResult(context, file, filename, dataset_path, result, result_idx, memory_budget);
+		return H5ReadScalarDatasetIntoResult(context, file, filename, dataset_path, result, result_idx,
+		                                     memory_budget);
 	}
 
 private:
@@ -346,11 +373,6 @@ private:
 	H5FileHandle file;
 };
 
-struct H5ReadScalarFileRows {
-	string filename;
-	vector<idx_t> row_idxs;
-};
-
 static unique_ptr<FunctionData> H5ReadScalarBind(ClientContext &context, ScalarFunction &,
                                                  vector<unique_ptr<Expression>> &arguments) {
 	if (arguments.size() != 2) {
@@ -360,109 +382,24 @@ static unique_ptr<FunctionData> H5ReadScalarBind(ClientContext &context, ScalarF
 	return make_uniq<H5ReadScalarBindData>(swmr, ResolveScalarReadMemoryLimitOption(context));
 }
 
-static void H5ReadScalarWriteFileRows(ClientContext &context, const H5ReadScalarFileRows &file_rows,
-                                      const UnifiedVectorFormat &path_data, const string_t *path_ptr, Vector &result,
-                                      const H5ReadScalarBindData &bind_data, H5ReadScalarMemoryBudget &memory_budget) {
-	if (file_rows.row_idxs.empty()) {
-		return;
-	}
-	ThrowIfInterrupted(context);
-	H5ReadScalarFileReader reader(context, file_rows.filename, bind_data.swmr);
-	for (auto row_idx : file_rows.row_idxs) {
-		auto path_idx = path_data.sel->get_index(row_idx);
-		reader.ReadDataset(path_ptr[path_idx], result, row_idx, memory_budget);
-	}
-}
-
 static void H5ReadScalarFunction(DataChunk &args, ExpressionState &state, Vector &result) {
 	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 	auto &bind_data = func_expr.bind_info->Cast<H5ReadScalarBindData>();
-	if (args.size() == 0) {
-		result.SetVectorType(VectorType::FLAT_VECTOR);
-		return;
-	}
-
-	auto &filename_vec = args.data[0];
-	auto &path_vec = args.data[1];
-	UnifiedVectorFormat filename_data;
-	UnifiedVectorFormat path_data;
-	filename_vec.ToUnifiedFormat(args.size(), filename_data);
-	path_vec.ToUnifiedFormat(args.size(), path_data);
-	auto filename_ptr = UnifiedVectorFormat::GetData<string_t>(filename_data);
-	auto path_ptr = UnifiedVectorFormat::GetData<string_t>(path_data);
 	auto &context = state.GetContext();
-	auto constant_filename = filename_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
-	auto constant_path = path_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
 	H5ReadScalarMemoryBudget memory_budget(bind_data.memory_limit);
 
-	if (constant_filename && constant_path) {
-		result.SetVectorType(VectorType::CONSTANT_VECTOR);
-		auto filename_idx = filename_data.sel->get_index(0);
-		auto path_idx = path_data.sel->get_index(0);
-		if (!filename_data.validity.RowIsValid(filename_idx) || !path_data.validity.RowIsValid(path_idx)) {
-			ConstantVector::SetNull(result, true);
-			return;
-		}
-
-		auto filename = filename_ptr[filename_idx].GetString();
+	auto read_paths = [&](const string &filename, const vector<string> &paths, const vector<idx_t> &path_idxs,
+	                      Vector &values, vector<idx_t> &sizes, bool estimate_sizes) {
+		// The size is the value's charge against the memory budget, so it is needed whether or not it is cached.
 		H5ReadScalarFileReader reader(context, filename, bind_data.swmr);
-		reader.ReadDataset(path_ptr[path_idx], result, 0, memory_budget);
-		return;
-	}
-
-	result.SetVectorType(VectorType::FLAT_VECTOR);
-	auto &validity = FlatVector::Validity(result);
-
-	if (constant_filename) {
-		auto filename_idx = filename_data.sel->get_index(0);
-		if (!filename_data.validity.RowIsValid(filename_idx)) {
-			for (idx_t i = 0; i < args.size(); i++) {
-				validity.SetInvalid(i);
-			}
-			return;
-		}
-
-		H5ReadScalarFileRows file_rows;
-		file_rows.filename = filename_ptr[filename_idx].GetString();
-		file_rows.row_idxs.reserve(args.size());
-		for (idx_t i = 0; i < args.size(); i++) {
-			auto path_idx = path_data.sel->get_index(i);
-			if (!path_data.validity.RowIsValid(path_idx)) {
-				validity.SetInvalid(i);
-				continue;
-			}
-			validity.SetValid(i);
-			file_rows.row_idxs.push_back(i);
-		}
-
-		H5ReadScalarWriteFileRows(context, file_rows, path_data, path_ptr, result, bind_data, memory_budget);
-		return;
-	}
-
-	std::unordered_map<string, idx_t> file_group_lookup;
-	vector<H5ReadScalarFileRows> file_groups;
-	file_group_lookup.reserve(args.size());
-	file_groups.reserve(args.size());
-	for (idx_t i = 0; i < args.size(); i++) {
-		auto filename_idx = filename_data.sel->get_index(i);
-		auto path_idx = path_data.sel->get_index(i);
-		if (!filename_data.validity.RowIsValid(filename_idx) || !path_data.validity.RowIsValid(path_idx)) {
-			validity.SetInvalid(i);
-			continue;
+		for (auto path_idx : path_idxs) {
+			sizes[path_idx] = reader.ReadDataset(paths[path_idx], values, path_idx, memory_budget);
 		}
-		validity.SetValid(i);
-		auto filename = filename_ptr[filename_idx].GetString();
-		auto inserted = file_group_lookup.emplace(filename, file_groups.size());
-		if (inserted.second) {
-			file_groups.emplace_back();
-			file_groups.back().filename = std::move(filename);
-		}
-		file_groups[inserted.first->second].row_idxs.push_back(i);
-	}
-
-	for (const auto &file_group : file_groups) {
-		H5ReadScalarWriteFileRows(context, file_group, path_data, path_ptr, result, bind_data, memory_budget);
-	}
+	};
+	auto reuse_row = [&](const string &filename, const string &dataset_path, idx_t size) {
+		memory_budget.ChargeReused(filename, dataset_path, size);
+	};
+	H5ScalarExecute(args, state, result, bind_data.swmr, "h5_read", read_paths, reuse_row);
 }
 
 void RegisterH5ReadScalarFunction(ExtensionLoader &loader) {
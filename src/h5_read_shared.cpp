@@ -2,6 +2,7 @@
 #include "h5_functions.hpp"
 #include "h5_internal.hpp"
 #include "duckdb/common/exception.hpp"
+#include <cstring>
 #include <vector>
 
 namespace duckdb {
@@ -22,14 +23,6 @@ static string FormatInvalidDatasetStringError(const string &filename, const stri
 	return FormatDatasetError("Invalid unicode (byte sequence mismatch) detected in dataset", filename, dataset_path);
 }
 
-static string ValidateHDF5StringValue(string value, H5T_cset_t cset, const string &filename,
-                                      const string &dataset_path) {
-	if (!H5StringMatchesCharset(value, cset)) {
-		throw IOException(FormatInvalidDatasetStringError(filename, dataset_path));
-	}
-	return value;
-}
-
 idx_t CheckedDatasetSizeProduct(idx_t left, idx_t right, const string &filename, const string &dataset_path) {
 	if (right != 0 && left > NumericLimits<idx_t>::Maximum() / right) {
 		throw IOException(
@@ -59,107 +52,137 @@ std::pair<H5DatasetHandle, H5TypeHandle> OpenDatasetAndGetType(hid_t file, const
 	return {std::move(dataset), H5TypeHandle::TakeOwnershipOf(type_id)};
 }
 
-void ReadHDF5Strings(hid_t dataset_id, hid_t h5_type, hid_t mem_space, hid_t file_space, idx_t count,
-                     const string &filename, const string &dataset_path,
-                     std::function<void(idx_t, const string &)> callback) {
-	if (count == 0) {
-		return;
+H5StringReadInfo InspectHDF5StringType(hid_t h5_type, const string &filename, const string &dataset_path) {
+	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	H5StringReadInfo result;
+	auto is_variable = H5Tis_variable_str(h5_type);
+	if (is_variable < 0) {
+		throw IOException(FormatDatasetError("Failed to inspect string type for dataset", filename, dataset_path));
 	}
-	htri_t is_variable;
-	H5T_cset_t cset;
-	size_t str_len = 0;
-	H5T_str_t strpad = H5T_STR_ERROR;
-	{
-		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
-		is_variable = H5Tis_variable_str(h5_type);
-		if (is_variable < 0) {
-			throw IOException(FormatDatasetError("Failed to inspect string type for dataset", filename, dataset_path));
+	result.is_variable = is_variable > 0;
+	result.cset = H5Tget_cset(h5_type);
+	if (result.cset == H5T_CSET_ERROR) {
+		throw IOException(FormatDatasetError("Failed to inspect string charset for dataset", filename, dataset_path));
+	}
+	if (!result.is_variable) {
+		result.fixed_length = H5Tget_size(h5_type);
+		if (result.fixed_length == 0) {
+			throw IOException(FormatDatasetError("Failed to inspect string width for dataset", filename, dataset_path));
 		}
-		cset = H5Tget_cset(h5_type);
-		if (cset == H5T_CSET_ERROR) {
+		result.strpad = H5Tget_strpad(h5_type);
+		if (result.strpad == H5T_STR_ERROR) {
 			throw IOException(
-			    FormatDatasetError("Failed to inspect string charset for dataset", filename, dataset_path));
-		}
-		if (is_variable == 0) {
-			str_len = H5Tget_size(h5_type);
-			if (str_len == 0) {
-				throw IOException(
-				    FormatDatasetError("Failed to inspect string width for dataset", filename, dataset_path));
-			}
-			strpad = H5Tget_strpad(h5_type);
-			if (strpad == H5T_STR_ERROR) {
-				throw IOException(
-				    FormatDatasetError("Failed to inspect string padding for dataset", filename, dataset_path));
-			}
+			    FormatDatasetError("Failed to inspect string padding for dataset", filename, dataset_path));
 		}
 	}
+	return result;
+}
 
-	if (is_variable > 0) {
-		hsize_t reclaim_dim = count;
-		H5DataspaceHandle reclaim_space(1, &reclaim_dim);
-		if (!reclaim_space.is_valid()) {
-			throw IOException(FormatDatasetError("Failed to create variable-length string reclaim dataspace", filename,
-			                                     dataset_path));
-		}
-		std::vector<char *> string_data(count);
+void ValidateHDF5String(const char *data, idx_t size, H5T_cset_t cset, const string &filename,
+                        const string &dataset_path) {
+	if (!H5StringMatchesCharset(data, size, cset)) {
+		throw IOException(FormatInvalidDatasetStringError(filename, dataset_path));
+	}
+}
 
-		herr_t status;
-		{
-			std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
-			H5ErrorSuppressor suppress;
-			status = H5Dread(dataset_id, h5_type, mem_space, file_space, H5P_DEFAULT, string_data.data());
-		}
+void ReadHDF5VariableStrings(hid_t dataset_id, hid_t h5_type, hid_t mem_space, hid_t file_space, idx_t count,
+                             const string &filename, const string &dataset_path,
+                             const std::function<void(char *const *values)> &consume) {
+	if (count == 0) {
+		return;
+	}
+	hsize_t reclaim_dim = count;
+	H5DataspaceHandle reclaim_space(1, &reclaim_dim);
+	if (!reclaim_space.is_valid()) {
+		throw IOException(
+		    FormatDatasetError("Failed to create variable-length string reclaim dataspace", filename, dataset_path));
+	}
+	std::vector<char *> string_data(count);
 
-		if (status < 0) {
-			throw IOException(FormatRemoteDatasetReadError(filename, dataset_path));
-		}
+	herr_t status;
+	{
+		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+		H5ErrorSuppressor suppress;
+		status = H5Dread(dataset_id, h5_type, mem_space, file_space, H5P_DEFAULT, string_data.data());
+	}
 
-		auto reclaim = [&]() {
-			std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
-			if (H5Dvlen_reclaim(h5_type, reclaim_space, H5P_DEFAULT, string_data.data()) < 0) {
-				throw IOException(FormatDatasetError("Failed to reclaim variable-length string data from dataset",
-				                                     filename, dataset_path));
-			}
-		};
+	if (status < 0) {
+		throw IOException(FormatRemoteDatasetReadError(filename, dataset_path));
+	}
 
+	auto reclaim = [&]() {
+		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+		if (H5Dvlen_reclaim(h5_type, reclaim_space, H5P_DEFAULT, string_data.data()) < 0) {
+			throw IOException(FormatDatasetError("Failed to reclaim variable-length string data from dataset", filename,
+			                                     dataset_path));
+		}
+	};
+
+	try {
+		consume(string_data.data());
+	} catch (...) {
 		try {
-			for (idx_t i = 0; i < count; i++) {
-				if (string_data[i]) {
-					callback(i, ValidateHDF5StringValue(string(string_data[i]), cset, filename, dataset_path));
-				} else {
-					callback(i, string());
-				}
-			}
+			reclaim();
 		} catch (...) {
-			try {
-				reclaim();
-			} catch (...) {
-			}
-			throw;
 		}
-		reclaim();
-		return;
+		throw;
 	}
+	reclaim();
+}
 
-	auto buffer_size = CheckedDatasetSizeProduct(count, static_cast<idx_t>(str_len), filename, dataset_path);
-	std::vector<char> buffer(buffer_size);
-
+void ReadHDF5FixedStrings(hid_t dataset_id, hid_t h5_type, hid_t mem_space, hid_t file_space, const string &filename,
+                          const string &dataset_path, data_ptr_t buffer) {
 	herr_t status;
 	{
 		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
 		H5ErrorSuppressor suppress;
-		status = H5Dread(dataset_id, h5_type, mem_space, file_space, H5P_DEFAULT, buffer.data());
+		status = H5Dread(dataset_id, h5_type, mem_space, file_space, H5P_DEFAULT, buffer);
 	}
-
 	if (status < 0) {
 		throw IOException(FormatRemoteDatasetReadError(filename, dataset_path));
 	}
+}
+
+void ReadHDF5StringViews(hid_t dataset_id, hid_t h5_type, const H5StringReadInfo &info, hid_t mem_space,
+                         hid_t file_space, idx_t count, const string &filename, const string &dataset_path,
+                         const std::function<void(idx_t, const char *, idx_t)> &callback) {
+	if (count == 0) {
+		return;
+	}
+	if (info.is_variable) {
+		ReadHDF5VariableStrings(dataset_id, h5_type, mem_space, file_space, count, filename, dataset_path,
+		                        [&](char *const *values) {
+			                        for (idx_t i = 0; i < count; i++) {
+				                        auto value = values[i] ? values[i] : "";
+				                        auto size = strlen(value);
+				                        ValidateHDF5String(value, size, info.cset, filename, dataset_path);
+				                        callback(i, value, size);
+			                        }
+		                        });
+		return;
+	}
 
+	auto buffer_size = CheckedDatasetSizeProduct(count, info.fixed_length, filename, dataset_path);
+	std::vector<char> buffer(buffer_size);
+	ReadHDF5FixedStrings(dataset_id, h5_type, mem_space, file_space, filename, dataset_path,
+	                     data_ptr_cast(buffer.data()));
 	for (idx_t i = 0; i < count; i++) {
-		auto *str_ptr = buffer.data() + (i * str_len);
-		auto decoded = H5DecodeFixedLengthString(str_ptr, str_len, strpad);
-		callback(i, ValidateHDF5StringValue(std::move(decoded), cset, filename, dataset_path));
+		auto *str_ptr = buffer.data() + (i * info.fixed_length);
+		auto size = H5FixedLengthStringSize(str_ptr, info.fixed_length, info.strpad);
+		ValidateHDF5String(str_ptr, size, info.cset, filename, dataset_path);
+		callback(i, str_ptr, size);
+	}
+}
+
+void ReadHDF5Strings(hid_t dataset_id, hid_t h5_type, hid_t mem_space, hid_t file_space, idx_t count,
+                     const string &filename, const string &dataset_path,
+                     std::function<void(idx_t, const string &)> callback) {
+	if (count == 0) {
+		return;
 	}
+	auto info = InspectHDF5StringType(h5_type, filename, dataset_path);
+	ReadHDF5StringViews(dataset_id, h5_type, info, mem_space, file_space, count, filename, dataset_path,
+	                    [&](idx_t i, const char *data, idx_t size) { callback(i, string(data, size)); });
 }
 
 } // namespace duckdb
@@ -2,14 +2,27 @@
 #include "h5_internal.hpp"
 #include "h5_read_shared.hpp"
 #include "h5_raii.hpp"
+#include "h5_chunk_direct.hpp"
+#include "h5_file_cache.hpp"
+#include "h5_zone_map.hpp"
+#include "h5_scan_stats.hpp"
+#include "h5_type_convert.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/multi_file/multi_file_reader.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/function/scalar/nested_functions.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/optimizer/optimizer_extension.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_scalar_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/string_map_set.hpp"
 #if __has_include("duckdb/common/vector/array_vector.hpp")
 #include "duckdb/common/vector/array_vector.hpp"
 #include "duckdb/common/vector/constant_vector.hpp"
@@ -28,17 +41,24 @@
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/operator/list.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include <utility>
 #include <vector>
 #include <string>
 #include <limits>
 #include <variant>
+#include <list>
 #include <optional>
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <unordered_map>
 #include <unordered_set>
 #include <map>
+#include <condition_variable>
+#include <future>
+#include <functional>
 
 namespace duckdb {
 
@@ -53,8 +73,28 @@ static T &GetStructChild(unique_ptr<T> &child) {
 }
 
 static constexpr idx_t H5_READ_WIDE_ROW_THRESHOLD_BYTES = 64 * 1024;
-// Bounds the combined storage of a column's one or two cache windows.
+// Bounds the combined storage of a column's cache windows.
 static constexpr idx_t H5_READ_CACHE_LIMIT_BYTES = 128 * 1024 * 1024;
+// Assumed average payload of a variable-length string when sizing its cache windows
+static constexpr idx_t H5_READ_VARIABLE_STRING_ESTIMATE_BYTES = 32;
+// Run-encoded columns load their runs in windows of this many runs, aligned to multiples of it, and keep
+// the most recently used windows of each column.
+static constexpr idx_t H5_READ_RUN_WINDOW_RUNS = 16 * STANDARD_VECTOR_SIZE;
+static constexpr idx_t H5_READ_RUN_WINDOW_CACHE = 8;
+// Scan batches per logical partition (before capping partitions to the cache window size).
+static constexpr idx_t H5_READ_PARTITION_SCAN_BATCHES = 8;
+// Upper bound on chunk index lookups when planning the remote reads of one cache refresh.
+static constexpr idx_t H5_READ_PLAN_MAX_CHUNKS = 16384;
+// Batch indexes a multi-file scan hands out stay below this, well under the limit DuckDB's pipelines accept.
+static constexpr idx_t H5_READ_MAX_BATCH_INDEX = 1000000000000ULL;
+// Late materialization: wide columns with rows of at least this many bytes are read only for the rows that pass the
+// claimed filters on 1-D columns. A batch reads them sparsely while at most half of its rows pass, in at most this
+// many runs of consecutive rows; otherwise one hyperslab covering the batch is cheaper.
+static constexpr idx_t H5_READ_LATE_MIN_ROW_BYTES = 64;
+static constexpr idx_t H5_READ_LATE_MAX_RUNS = 256;
+// Dictionary mode (h5db_string_dictionary): fixed-length string windows keep their distinct values once while they
+// hold at most one distinct value per this many rows, and one string per row otherwise.
+static constexpr idx_t H5_READ_DICTIONARY_MIN_ROWS_PER_VALUE = 8;
 
 // =============================================================================
 // Type-safe index wrappers for projection pushdown
@@ -89,12 +129,35 @@ struct RegularColumnSpec {
 	std::string column_name;
 	LogicalType column_type;
 	bool is_string;
-	std::optional<H5TypeHandle> string_h5_type; // Present only for string datasets
+	std::optional<H5TypeHandle> string_h5_type; // Present only for string datasets (or string fields)
+	// Fields of compound datasets: the member name and a memory type holding only that member at offset 0, so
+	// H5Dread converts and copies just its bytes into a dense buffer of the column's values.
+	std::optional<std::string> compound_member;
+	std::optional<H5TypeHandle> compound_read_type;
+	// Enum datasets: a memory enum type whose values are the column's ENUM codes, see CreateH5ReadEnumType
+	std::optional<H5TypeHandle> enum_read_type;
 	int ndims;
-	std::vector<hsize_t> dims;
+	std::vector<hsize_t> dims; // Selected shape: the dataset shape unless h5_slice() narrows inner dimensions
+	// Hyperslab of the inner dimensions selected with h5_slice(). Empty when every dimension is read in full;
+	// otherwise one entry per dimension, with the row dimension always starting at 0 with stride 1.
+	std::vector<hsize_t> slice_start;
+	std::vector<hsize_t> slice_stride;
+	std::vector<hsize_t> stored_dims; // Dataset shape as stored in the file
+	// Array fields of compound datasets: the member's array shape, read as inner dimensions after dims
+	std::vector<hsize_t> member_dims;
 	// Per-column DuckDB output footprint for one scan row.
 	idx_t output_bytes_per_row; // Zero for strings or zero-sized values
 	idx_t elements_per_row;     // Output elements in the same scan-row value
+
+	bool IsSliced() const {
+		return !slice_start.empty();
+	}
+	// Shape of the column's values: dims followed by member_dims
+	std::vector<hsize_t> ValueShape() const {
+		auto shape = dims;
+		shape.insert(shape.end(), member_dims.begin(), member_dims.end());
+		return shape;
+	}
 };
 
 // Scalar dataset specification (rank-0 value or null dataspace)
@@ -104,6 +167,7 @@ struct ScalarColumnSpec {
 	LogicalType column_type;
 	bool is_null_dataspace = false;
 	std::optional<H5TypeHandle> string_h5_type; // Present only for non-null string datasets
+	std::optional<H5TypeHandle> enum_read_type; // Present only for enum datasets
 };
 
 enum class RunEncodingKind : uint8_t { START, END };
@@ -141,31 +205,52 @@ static string FormatRunEncodedDatasetPairError(const string &message, const stri
 struct IndexColumnSpec {
 	std::string column_name;
 	LogicalType column_type;
+	bool global = false; // Numbers rows across all matched files instead of within each file
 };
 
 // A column can be regular, scalar, run-encoded, or virtual index
 using ColumnSpec = std::variant<RegularColumnSpec, ScalarColumnSpec, RunEncodedColumnSpec, IndexColumnSpec>;
 
-// Logical row window stored by the extension cache.
+// Logical row window stored by the extension cache. Every field except the storage is
+// protected by H5ReadGlobalState::cache_lock. A window may only be refilled while no scan
+// call has it pinned, and pins are never held across Scan() calls, so a local state that
+// stops scanning cannot keep a window (or cache progress) hostage.
 struct CacheWindow {
-	using CacheStorage =
-	    std::variant<std::monostate, // Uninitialized
-	                 std::vector<int8_t>, std::vector<int16_t>, std::vector<int32_t>, std::vector<int64_t>,
-	                 std::vector<uint8_t>, std::vector<uint16_t>, std::vector<uint32_t>, std::vector<uint64_t>,
-	                 std::vector<float>, std::vector<double>>;
-	CacheStorage cache;
-
-	// end_row is one past the logical cache window start plus window_rows.
-	// This makes the cache window start recoverable as (end_row - window_rows).
-	// Zero marks an uninitialized window as reusable.
-	std::atomic<idx_t> end_row {0};
+	// Typed rows (of the column's base type) in a buffer-manager allocation, so windows count against
+	// memory_limit and show up in duckdb_memory(). Stays pinned while the scan runs. String windows
+	// hold string_t values followed by the bytes they point to, and get a fresh allocation per fill:
+	// output vectors keep their own pin on the block they reference.
+	BufferHandle storage;
+	// Fixed-length string windows filled in dictionary mode: the window's distinct values, pointing into storage,
+	// which then holds one sel_t code per row in place of the string_t values. Scans emit dictionary vectors over it.
+	shared_ptr<Vector> dictionary;
+
+	template <class T>
+	T *Data() const {
+		return reinterpret_cast<T *>(storage.Ptr());
+	}
+
+	idx_t start_row = 0;
+	idx_t end_row = 0;    // Window holds rows [start_row, end_row); zero marks an empty window
+	bool loading = false; // Storage is being filled outside cache_lock
+	idx_t pins = 0;       // Scan calls currently copying rows out of the window
+	idx_t last_used = 0;  // H5ReadGlobalState::cache_use_tick of the latest pin
 };
 
 struct RegularColumnCache {
-	static constexpr idx_t MAX_WINDOWS = 2;
-
 	idx_t window_rows = 0;
-	CacheWindow windows[MAX_WINDOWS]; // Atomic members prevent std::vector usage
+	// A ring of h5db_cache_windows windows, or fewer when they cover every row of the dataset
+	vector<CacheWindow> windows;
+	// The column's spec, owned here because the prefetch task can outlive the bind data it was copied from
+	RegularColumnSpec spec;
+};
+
+// Where a cached column's rows live in the file, for planning remote window fills.
+struct H5ReadPlanLayout {
+	bool chunked = false;
+	std::vector<hsize_t> chunk_dims; // Chunk extent per dimension (chunked only)
+	haddr_t address = HADDR_UNDEF;   // First byte of the data (contiguous only)
+	idx_t stored_row_bytes = 0;      // Bytes of one stored row (contiguous only)
 };
 
 // Regular column runtime state
@@ -174,6 +259,21 @@ struct RegularColumnState {
 	H5DataspaceHandle file_space; // Cached dataspace handle (reused across reads)
 
 	std::unique_ptr<RegularColumnCache> cache;
+	std::optional<H5StringReadInfo> string_info; // Present only for string datasets
+	// Present when raw chunks can be decoded by scan threads instead of inside H5Dread
+	std::optional<H5ChunkDirectLayout> chunk_direct;
+	// Present when rows are read from H5ReadGlobalState::direct_file instead of through H5Dread
+	std::optional<H5ContiguousDirectLayout> contiguous_direct;
+	// Present when values are read in their stored representation and converted by scan threads after the read
+	std::optional<H5StoredConversion> stored_conversion;
+	// Per-chunk min/max for chunked 1-D numeric datasets (filled in while scanning)
+	shared_ptr<H5ZoneMap> zone_map;
+	// Present for cached columns of remote files whose window fills are prefetched as planned byte ranges
+	std::optional<H5ReadPlanLayout> read_plan;
+	// Read after the other columns of a batch, only for rows passing H5ReadGlobalState::late_filters. Never cached.
+	bool late_materialized = false;
+	// Cache windows of this fixed-length string column are filled in dictionary mode (h5db_string_dictionary)
+	bool string_dictionary = false;
 };
 
 // Scalar column runtime state (cached value)
@@ -183,19 +283,58 @@ struct ScalarColumnState {
 	ScalarValue value;
 };
 
-// Run-encoded column runtime state
+// Consecutive runs [first_run, first_run + RunCount()) of a run-encoded column. Immutable once loaded, so
+// scan threads share windows without locking.
+struct RunEncodedWindow {
+	RunEncodedWindow(const LogicalType &type, idx_t first_run_p, idx_t run_count)
+	    : first_run(first_run_p), run_starts(run_count), dictionary(type, run_count + 1) {
+	}
+
+	idx_t first_run;
+	std::vector<idx_t> run_starts; // First row of every run
+	idx_t end_row = 0;             // First row after the last run
+	// Run values followed by one NULL entry at NullIndex(); scans emit dictionary vectors over it
+	Vector dictionary;
+
+	idx_t RunCount() const {
+		return run_starts.size();
+	}
+	idx_t NullIndex() const {
+		return run_starts.size();
+	}
+	idx_t StartRow() const {
+		return run_starts[0];
+	}
+	bool Contains(idx_t row) const {
+		return StartRow() <= row && row < end_row;
+	}
+	// Index of the run holding row, which must be contained in the window
+	idx_t FindRun(idx_t row) const {
+		return static_cast<idx_t>(std::upper_bound(run_starts.begin(), run_starts.end(), row) - run_starts.begin()) -
+		       1;
+	}
+	idx_t RunEnd(idx_t run) const {
+		return run + 1 < RunCount() ? run_starts[run + 1] : end_row;
+	}
+};
+
+struct RunEncodedWindowCache {
+	std::mutex lock;
+	std::list<shared_ptr<RunEncodedWindow>> windows; // Most recently used first
+};
+
+// Run-encoded column runtime state. Runs are loaded lazily in windows (see RunEncodedWindow).
 struct RunEncodedColumnState {
-	std::vector<idx_t> run_starts;
-	idx_t non_null_end = 0;
+	H5DatasetHandle boundaries_ds;
+	H5DatasetHandle values_ds;
+	std::optional<H5StringReadInfo> values_string_info; // Present only for string values datasets
 
-	// Typed storage for values (eliminates Value object overhead)
-	using RunEncodedValueStorage =
-	    std::variant<std::vector<int8_t>, std::vector<int16_t>, std::vector<int32_t>, std::vector<int64_t>,
-	                 std::vector<uint8_t>, std::vector<uint16_t>, std::vector<uint32_t>, std::vector<uint64_t>,
-	                 std::vector<float>, std::vector<double>, std::vector<string>>;
-	RunEncodedValueStorage values;
+	idx_t num_rows = 0;
+	idx_t num_runs = 0;
+	idx_t first_start = 0;  // Rows before the first run are NULL
+	idx_t non_null_end = 0; // Rows at or after this are NULL
 
-	// Note: No mutable state needed - ScanRunEncodedColumn is now stateless (thread-safe)
+	std::unique_ptr<RunEncodedWindowCache> window_cache;
 };
 
 struct IndexColumnState {};
@@ -209,6 +348,14 @@ struct RowRange {
 	idx_t end_row;
 };
 
+// Logical partition owned by one local scan state. Rows [position, position_end) are still to
+// be scanned; the partition is exhausted once position == position_end.
+struct H5ReadPartition {
+	idx_t position = 0;
+	idx_t position_end = 0;
+	idx_t ordinal = 0; // Partition index within the file
+};
+
 // Filter claimed during pushdown complex filter callback
 struct ClaimedFilter {
 	idx_t column_index;        // Which column (index into the shared output schema)
@@ -217,17 +364,57 @@ struct ClaimedFilter {
 	LogicalType comparison_type;
 };
 
+// A claimed filter on a 1-D regular column that scans evaluate on the values they read, so late-materialized columns
+// are only read for the rows that pass.
+struct H5ReadLateFilter {
+	LocalColumnIdx local_idx = LocalColumnIdx(0);
+	ClaimedFilter filter;
+	// The constant was cast to the column's type and the comparison happens in it, so rows compare natively
+	bool typed = false;
+};
+
 struct PushdownColumnRef {
 	const BoundColumnRefExpression *column_ref = nullptr;
 	LogicalType comparison_type;
 };
 
+// Value range of a column within one file, reported to DuckDB's optimizer (see H5ReadStatistics).
+struct H5ReadColumnRange {
+	Value min;
+	Value max;
+	idx_t distinct_count = 0; // 0 when unknown
+};
+
+// Rows [first_row, first_row + num_rows) of a file whose regular columns are all virtual datasets, stored in one
+// source file as one whole source dataset per column (see GetH5ReadVirtualSources).
+struct H5ReadVirtualSource {
+	std::string filename; // Resolved against the directory of the virtual datasets' file
+	idx_t first_row = 0;
+	idx_t num_rows = 0;
+	unordered_map<string, string> dataset_paths; // Virtual dataset path -> source dataset path
+};
+
+// The virtual datasets' file a bind entry scans one H5ReadVirtualSource of, in place of that file.
+struct H5ReadVirtualBlock {
+	std::string filename; // Reported in the filename column and looked up in since := ...
+	idx_t first_row = 0;  // Row of the virtual datasets the source starts at
+	idx_t num_rows = 0;   // Rows of the virtual datasets
+};
+
 // Single-file bind data for the inner h5_read implementation.
 struct H5ReadSingleFileBindData {
 	std::string filename;
 	vector<ColumnSpec> columns; // Unified column specifications
 	hsize_t num_rows;           // Row count from regular datasets
 	bool swmr = false;
+	// False for files h5db_bind_sample_files leaves to the scan; only filename and swmr are set until it opens them
+	bool bound = true;
+	// Ranges known at bind (from h5db_range_attributes or small run-encoded values datasets), indexed like columns
+	vector<std::optional<H5ReadColumnRange>> column_ranges;
+	// Sources covering every row, in row order, when the file's columns can be scanned from their sources directly
+	vector<H5ReadVirtualSource> virtual_sources;
+	// Present for an entry that scans one source in place of its virtual datasets' file
+	std::optional<H5ReadVirtualBlock> virtual_block;
 };
 
 struct H5ReadSingleFileBindView {
@@ -236,14 +423,35 @@ struct H5ReadSingleFileBindView {
 	hsize_t num_rows;
 	const vector<ClaimedFilter> &claimed_filters;
 	bool swmr = false;
+	idx_t row_base = 0;   // Global row index of the first row of this file
+	idx_t first_row = 0;  // Rows before it were returned by an earlier scan (since := ...) and are skipped
+	idx_t index_base = 0; // Per-file index of the first row: its row within the virtual datasets for virtual blocks
+};
+
+// Rows of each file that earlier scans already returned (since := ...): one row count for every file, or a MAP from
+// filename to row count, where files that are not listed are read from their first row.
+struct H5ReadSinceOption {
+	idx_t all_files = 0;
+	unordered_map<string, idx_t> by_file;
+
+	idx_t FirstRow(const string &filename) const {
+		auto it = by_file.find(filename);
+		return it == by_file.end() ? all_files : it->second;
+	}
 };
 
 // Data for h5_read table function.
 struct H5ReadBindData : public TableFunctionData {
 	vector<H5ReadSingleFileBindData> file_bind_data;
-	hsize_t total_num_rows = 0;            // Total row count across all matched files
+	// Total row count across all matched files, extrapolated from the bound files when some are bound lazily
+	hsize_t total_num_rows = 0;
+	vector<idx_t> file_row_base;           // Global row index of the first row of each file
+	vector<Value> inputs;                  // Bind arguments, kept for files that are bound when the scan opens them
 	vector<ClaimedFilter> claimed_filters; // Filters we claimed during pushdown
 	std::optional<idx_t> visible_filename_idx;
+	// Rows the plan consumes at most (a LIMIT directly above the scan), set by the h5_read optimizer.
+	std::optional<idx_t> row_limit;
+	H5ReadSinceOption since;
 
 	bool SupportStatementCache() const override {
 		return false;
@@ -263,12 +471,17 @@ struct H5ReadGlobalState {
 	vector<LocalColumnIdx> cache_refresh_order;  // Refreshable regular columns in file-friendly order
 
 	// Position tracking
-	// position is the next globally unclaimed scan range start.
+	// position is the next globally unclaimed row; rows are claimed in whole logical partitions.
 	idx_t position = 0;                   // Protected by range_selection_mutex
 	std::atomic<idx_t> position_done {0}; // All rows in [0, position_done) have been returned or filtered out
+	// Rows per logical partition. A local state owns one partition at a time and reports its
+	// ordinal as the DuckDB batch index.
+	idx_t partition_rows = STANDARD_VECTOR_SIZE;
 
-	// Row range filtering (for predicate pushdown on run-encoded or index columns)
+	// Row range filtering (for predicate pushdown on run-encoded, index, or zone-mapped columns)
 	vector<RowRange> valid_row_ranges; // Sorted, non-overlapping ranges to scan
+	// Filters deciding which rows late-materialized columns are read for. Empty when no column is late-materialized.
+	vector<H5ReadLateFilter> late_filters;
 	idx_t scan_batch_size = STANDARD_VECTOR_SIZE;
 
 	// Mutex for thread-safe range selection (enables parallel scanning)
@@ -279,11 +492,57 @@ struct H5ReadGlobalState {
 	// that couldn't be merged into position_done yet (due to gaps)
 	std::map<idx_t, idx_t> completed_ranges;
 
-	// Cache loading coordination: only one thread loads windows at a time
-	// Other threads proceed with scanning cached data (enables parallel processing)
+	// Cache window bookkeeping for every cached column of this file
+	std::mutex cache_lock;
+	idx_t cache_use_tick = 0; // Protected by cache_lock
+
+	// Read-ahead coordination: only one thread (the prefetch task, when it runs) prefetches windows
+	// ahead of position_done at a time. Scan calls that miss the cache load the window they need
+	// themselves, so read-ahead never has to wait for rows that a stopped local state has not returned.
 	std::atomic<bool> someone_is_fetching {false};
+	// Bumped whenever a window is filled or unpinned, the prefetching thread finishes, position_done
+	// advances under a prefetch task, or chunk decode work is published, so waiting threads wake up to
+	// help decode or re-check the windows.
+	std::atomic<idx_t> fetch_signal {0};
+	std::mutex pending_decode_lock;
+	shared_ptr<H5ChunkDirectDecodeBatch> pending_decode; // Protected by pending_decode_lock
+
+	// The file is read through the remote VFD, which can prefetch the byte ranges of upcoming window fills
+	bool plan_remote_reads = false;
+	// The local file, opened through DuckDB's file system for contiguous-direct reads. Positional reads are
+	// thread-safe, so scan threads share it without locking.
+	unique_ptr<FileHandle> direct_file;
+	BufferManager *buffer_manager = nullptr; // Allocates string cache windows
+
+	// Copies of the bind data cache refreshes use, see RegularColumnCache::spec
+	string filename;
+	idx_t num_rows = 0;
+	// Schema of a file that was bound when the scan opened it, used instead of the file's bind data entry
+	unique_ptr<H5ReadSingleFileBindData> lazy_bind_data;
+
+	// Background task filling cache windows ahead of position_done (h5db_cache_prefetch). While it runs, scan threads
+	// only copy from windows and load the ones they miss, never read ahead themselves.
+	std::future<void> prefetch_task;
+	std::atomic<bool> prefetch_running {false};
+	std::atomic<bool> prefetch_stop {false};
+	shared_ptr<H5ScanStats> prefetch_stats; // The scan the task records to
+
+	// RAII wrappers handle all other cleanup automatically
+	~H5ReadGlobalState() {
+		// The task reads through this state's handles into its windows, so it has to finish first.
+		if (prefetch_task.valid()) {
+			prefetch_stop.store(true, std::memory_order_release);
+			fetch_signal.fetch_add(1, std::memory_order_acq_rel);
+			fetch_signal.notify_all();
+			prefetch_task.wait();
+		}
+	}
+};
 
-	// No destructor needed - RAII wrappers handle all cleanup automatically
+struct H5ReadOpenFile {
+	idx_t file_idx;
+	shared_ptr<H5ReadGlobalState> state;
+	bool has_scanner = false; // Some local state has attached to this file
 };
 
 struct H5ReadMultiFileGlobalState : public GlobalTableFunctionState {
@@ -291,9 +550,32 @@ struct H5ReadMultiFileGlobalState : public GlobalTableFunctionState {
 	vector<idx_t> data_output_column_positions;
 	vector<idx_t> filename_output_positions;
 	vector<idx_t> empty_output_positions;
-	shared_ptr<H5ReadGlobalState> current_file;
-	idx_t current_file_idx = 0;
-	std::mutex current_file_lock;
+
+	// File work queue. Up to max_files_in_flight files are open at once; threads
+	// open the next file while earlier ones are still being scanned, and otherwise
+	// join an open file to claim row ranges from it. All fields below are
+	// protected by file_queue_lock.
+	vector<H5ReadOpenFile> open_files; // Open files with rows left to claim, in file order
+	idx_t next_file_idx = 0;           // Next entry of scan_files to open
+	idx_t files_opening = 0;           // Files currently being opened outside file_queue_lock
+	idx_t next_attach_idx = 0;         // Round-robin cursor into open_files
+	idx_t max_files_in_flight = 1;
+	std::mutex file_queue_lock;
+	std::condition_variable file_queue_cv;
+
+	// Files the scan opens, in file order. Files without rows that pass the claimed index filters,
+	// and files past the point where earlier files already hold enough rows for a LIMIT, are skipped.
+	vector<idx_t> scan_files;
+
+	// Batch index of the first logical partition of each file. A file has at most one partition
+	// per row, so prefix sums of row counts keep batch indexes increasing with file order.
+	vector<idx_t> file_batch_base;
+	// Batch indexes reserved for each lazily bound file, whose row count is unknown until it is opened
+	idx_t lazy_file_batches = 0;
+
+	// Counters of this scan, recorded by every thread working for it and reported in the profiling output. Shared with
+	// the prefetch tasks of its files.
+	shared_ptr<H5ScanStats> stats = make_shared_ptr<H5ScanStats>();
 
 	idx_t MaxThreads() const override {
 		return GlobalTableFunctionState::MAX_THREADS;
@@ -302,7 +584,11 @@ struct H5ReadMultiFileGlobalState : public GlobalTableFunctionState {
 
 struct H5ReadMultiFileLocalState : public LocalTableFunctionState {
 	shared_ptr<H5ReadGlobalState> file;
+	// Current file, or the last one scanned. Batch indexes must not decrease for a local state,
+	// so it only moves on to files at or after this one.
 	idx_t file_idx = 0;
+	H5ReadPartition partition; // Owned logical partition of the current file
+	idx_t batch_index = 0;     // Batch index of the last chunk this local state returned
 };
 
 // =============================================================================
@@ -380,9 +666,10 @@ static Vector &PrepareRegularResultVector(Vector &result_vector, const RegularCo
 
 	Vector *current_vector = &result_vector;
 	idx_t parent_count = row_count;
-	for (int dimension_idx = 1; dimension_idx < spec.ndims; dimension_idx++) {
+	auto shape = spec.ValueShape();
+	for (idx_t dimension_idx = 1; dimension_idx < shape.size(); dimension_idx++) {
 		D_ASSERT(current_vector->GetType().id() == LogicalTypeId::LIST);
-		auto dimension = static_cast<idx_t>(spec.dims[dimension_idx]);
+		auto dimension = static_cast<idx_t>(shape[dimension_idx]);
 		auto child_count = CheckedDatasetSizeProduct(parent_count, dimension, filename, spec.path);
 
 		ListVector::Reserve(*current_vector, child_count);
@@ -496,6 +783,13 @@ static idx_t H5ReadNumericOutputElementSize(const LogicalType &base_type) {
 	});
 }
 
+// Bytes of row_count rows of a regular column in DuckDB's in-memory layout; strings count their string_t only.
+static idx_t RegularColumnReturnedBytes(const RegularColumnSpec &spec, idx_t row_count) {
+	auto element_size =
+	    spec.is_string ? sizeof(string_t) : H5ReadNumericOutputElementSize(GetBaseType(spec.column_type));
+	return row_count * spec.elements_per_row * element_size;
+}
+
 // Helper: select hyperslab and create matching memory dataspace
 static H5DataspaceHandle CreateMemspaceAndSelect(hid_t file_space_id, const RegularColumnSpec &spec, idx_t position,
                                                  idx_t to_read) {
@@ -513,9 +807,13 @@ static H5DataspaceHandle CreateMemspaceAndSelect(hid_t file_space_id, const Regu
 		start[0] = position;
 		count[0] = to_read;
 		for (int i = 1; i < spec.ndims; i++) {
+			if (spec.IsSliced()) {
+				start[i] = spec.slice_start[i];
+			}
 			count[i] = spec.dims[i];
 		}
-		H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, start.data(), nullptr, count.data(), nullptr);
+		H5Sselect_hyperslab(file_space_id, H5S_SELECT_SET, start.data(),
+		                    spec.IsSliced() ? spec.slice_stride.data() : nullptr, count.data(), nullptr);
 
 		std::vector<hsize_t> mem_dims(spec.ndims);
 		mem_dims[0] = to_read;
@@ -527,8 +825,59 @@ static H5DataspaceHandle CreateMemspaceAndSelect(hid_t file_space_id, const Regu
 	return mem_space;
 }
 
-static idx_t ComputeCacheWindowRows(const RegularColumnSpec &spec, hid_t dataset_id, idx_t target_batch_size_bytes,
-                                    idx_t total_rows) {
+// Helper: select the batch rows [position + run.start_row, position + run.end_row) of every run, and a memory dataspace
+// of to_read rows with the same rows selected, so each run lands where a full read of the batch would put it.
+static H5DataspaceHandle CreateMemspaceAndSelectRuns(hid_t file_space_id, const RegularColumnSpec &spec,
+                                                     idx_t position, idx_t to_read, const vector<RowRange> &runs) {
+	D_ASSERT(!runs.empty());
+	std::vector<hsize_t> file_start(spec.ndims, 0);
+	std::vector<hsize_t> mem_start(spec.ndims, 0);
+	std::vector<hsize_t> count(spec.ndims);
+	std::vector<hsize_t> mem_dims(spec.ndims);
+	mem_dims[0] = to_read;
+	for (int i = 1; i < spec.ndims; i++) {
+		if (spec.IsSliced()) {
+			file_start[i] = spec.slice_start[i];
+		}
+		count[i] = spec.dims[i];
+		mem_dims[i] = spec.dims[i];
+	}
+	H5DataspaceHandle mem_space(spec.ndims, mem_dims.data());
+	auto op = H5S_SELECT_SET;
+	for (const auto &run : runs) {
+		file_start[0] = position + run.start_row;
+		mem_start[0] = run.start_row;
+		count[0] = run.end_row - run.start_row;
+		H5Sselect_hyperslab(file_space_id, op, file_start.data(), spec.IsSliced() ? spec.slice_stride.data() : nullptr,
+		                    count.data(), nullptr);
+		H5Sselect_hyperslab(mem_space, op, mem_start.data(), nullptr, count.data(), nullptr);
+		op = H5S_SELECT_OR;
+	}
+	return mem_space;
+}
+
+// Zone maps cover 1-D numeric datasets, where one row is one value.
+static bool H5ReadColumnSupportsZoneMap(const ColumnSpec &column) {
+	auto spec = std::get_if<RegularColumnSpec>(&column);
+	return spec && spec->ndims == 1 && spec->member_dims.empty() && !spec->is_string &&
+	       spec->column_type.id() != LogicalTypeId::ENUM &&
+	       !spec->dims.empty() && spec->dims[0] > 0;
+}
+
+// Identifies the values of a column within its file for the zone map cache: the dataset path, plus the member name
+// for fields of compound datasets (separated by '\0', which cannot occur in HDF5 paths).
+static string RegularColumnZoneMapKey(const RegularColumnSpec &spec) {
+	if (!spec.compound_member) {
+		return spec.path;
+	}
+	string key = spec.path;
+	key += '\0';
+	key += *spec.compound_member;
+	return key;
+}
+
+// Returns the first-dimension chunk extent of a chunked dataset, or 0 for other layouts.
+static idx_t GetDatasetChunkRows(const RegularColumnSpec &spec, hid_t dataset_id) {
 	idx_t chunk_rows = 0;
 	hid_t dcpl = H5Dget_create_plist(dataset_id);
 	if (dcpl >= 0) {
@@ -541,10 +890,35 @@ static idx_t ComputeCacheWindowRows(const RegularColumnSpec &spec, hid_t dataset
 		}
 		H5Pclose(dcpl);
 	}
+	return chunk_rows;
+}
+
+// Bytes one row takes up in a cache window.
+static idx_t CacheBytesPerRow(const RegularColumnSpec &spec, const RegularColumnState &state) {
+	if (state.contiguous_direct) {
+		// Every scan reads its rows straight into the output vector, so a cache window would only add a copy.
+		return 0;
+	}
+	if (state.late_materialized) {
+		// Windows would read every row ahead of the filters that decide which rows are needed.
+		return 0;
+	}
+	if (!spec.is_string) {
+		return spec.output_bytes_per_row;
+	}
+	D_ASSERT(state.string_info);
+	auto payload_bytes = state.string_info->is_variable ? H5_READ_VARIABLE_STRING_ESTIMATE_BYTES
+	                                                    : state.string_info->fixed_length;
+	return sizeof(string_t) + payload_bytes;
+}
+
+static idx_t ComputeCacheWindowRows(const RegularColumnSpec &spec, idx_t cache_bytes_per_row, hid_t dataset_id,
+                                    idx_t target_batch_size_bytes, idx_t total_rows) {
+	idx_t chunk_rows = GetDatasetChunkRows(spec, dataset_id);
+	auto row_bytes = MaxValue<idx_t>(cache_bytes_per_row, 1);
 
 	idx_t window_rows;
 	if (chunk_rows > 0) {
-		auto row_bytes = MaxValue<idx_t>(spec.output_bytes_per_row, 1);
 		idx_t target_rows = MaxValue<idx_t>(target_batch_size_bytes / row_bytes, 1);
 		target_rows = MaxValue<idx_t>(target_rows, chunk_rows);
 		idx_t remainder = target_rows % chunk_rows;
@@ -554,7 +928,7 @@ static idx_t ComputeCacheWindowRows(const RegularColumnSpec &spec, hid_t dataset
 		window_rows = target_rows;
 		D_ASSERT(window_rows % chunk_rows == 0);
 	} else {
-		window_rows = MaxValue<idx_t>(target_batch_size_bytes / MaxValue<idx_t>(spec.output_bytes_per_row, 1), 1);
+		window_rows = MaxValue<idx_t>(target_batch_size_bytes / row_bytes, 1);
 	}
 	if (total_rows == 0) {
 		return 0;
@@ -562,15 +936,17 @@ static idx_t ComputeCacheWindowRows(const RegularColumnSpec &spec, hid_t dataset
 	return MinValue<idx_t>(window_rows, total_rows);
 }
 
-static idx_t ComputeCacheWindowCount(idx_t window_rows, idx_t total_rows) {
-	return window_rows < total_rows ? RegularColumnCache::MAX_WINDOWS : 1;
+// Windows of a cached column: max_windows, but no more than it takes to hold every row at once.
+static idx_t ComputeCacheWindowCount(idx_t window_rows, idx_t total_rows, idx_t max_windows) {
+	D_ASSERT(window_rows > 0);
+	return MinValue<idx_t>(max_windows, (total_rows + window_rows - 1) / window_rows);
 }
 
-static bool H5ReadShouldCreateCache(const RegularColumnSpec &spec, idx_t window_rows, idx_t total_rows,
-                                    idx_t scan_batch_size) {
-	D_ASSERT(spec.output_bytes_per_row > 0);
-	auto window_count = ComputeCacheWindowCount(window_rows, total_rows);
-	auto max_window_rows = H5_READ_CACHE_LIMIT_BYTES / window_count / spec.output_bytes_per_row;
+static bool H5ReadShouldCreateCache(idx_t cache_bytes_per_row, idx_t window_rows, idx_t total_rows,
+                                    idx_t scan_batch_size, idx_t max_windows) {
+	D_ASSERT(cache_bytes_per_row > 0);
+	auto window_count = ComputeCacheWindowCount(window_rows, total_rows, max_windows);
+	auto max_window_rows = H5_READ_CACHE_LIMIT_BYTES / window_count / cache_bytes_per_row;
 	return window_rows > scan_batch_size && window_rows <= max_window_rows;
 }
 
@@ -606,6 +982,39 @@ static std::optional<haddr_t> TryGetDatasetReadOrderAddress(const RegularColumnS
 	return result;
 }
 
+static std::optional<H5ReadPlanLayout> TryGetDatasetPlanLayout(const RegularColumnSpec &spec, hid_t dataset_id) {
+	hid_t dcpl = H5Dget_create_plist(dataset_id);
+	if (dcpl < 0) {
+		return std::nullopt;
+	}
+
+	std::optional<H5ReadPlanLayout> result;
+	H5ReadPlanLayout plan;
+	auto layout = H5Pget_layout(dcpl);
+	if (layout == H5D_CHUNKED) {
+		plan.chunked = true;
+		plan.chunk_dims.resize(spec.ndims);
+		if (H5Pget_chunk(dcpl, spec.ndims, plan.chunk_dims.data()) == spec.ndims &&
+		    std::all_of(plan.chunk_dims.begin(), plan.chunk_dims.end(), [](hsize_t extent) { return extent > 0; })) {
+			result = std::move(plan);
+		}
+	} else if (layout == H5D_CONTIGUOUS) {
+		plan.address = H5Dget_offset(dataset_id);
+		auto stored_type = H5TypeHandle::TakeOwnershipOf(H5Dget_type(dataset_id));
+		auto type_size = stored_type.get() >= 0 ? H5Tget_size(stored_type.get()) : 0;
+		if (plan.address != HADDR_UNDEF && type_size > 0) {
+			plan.stored_row_bytes = type_size;
+			for (int i = 1; i < spec.ndims; i++) {
+				plan.stored_row_bytes *= spec.stored_dims[i];
+			}
+			result = std::move(plan);
+		}
+	}
+
+	H5Pclose(dcpl);
+	return result;
+}
+
 // Predicate Pushdown Helpers (for run-encoded columns)
 //===--------------------------------------------------------------------===//
 
@@ -640,14 +1049,15 @@ static bool EvaluateIndexComparison(idx_t index, const ClaimedFilter &filter, Ex
 	return result == H5ReadFilterEvalResult::TRUE;
 }
 
-static vector<RowRange> BuildIndexRanges(const vector<ClaimedFilter> &filters, idx_t num_rows) {
+// Rows of a file whose index value row_base + row passes every filter, as file-local row ranges.
+static vector<RowRange> BuildIndexRanges(const vector<ClaimedFilter> &filters, idx_t row_base, idx_t num_rows) {
 	auto build_single_filter_ranges = [&](const ClaimedFilter &filter) -> vector<RowRange> {
 		auto find_first_true = [&](ExpressionType comparison) -> idx_t {
 			idx_t lo = 0;
 			idx_t hi = num_rows;
 			while (lo < hi) {
 				idx_t mid = lo + (hi - lo) / 2;
-				if (EvaluateIndexComparison(mid, filter, comparison)) {
+				if (EvaluateIndexComparison(row_base + mid, filter, comparison)) {
 					hi = mid;
 				} else {
 					lo = mid + 1;
@@ -661,7 +1071,7 @@ static vector<RowRange> BuildIndexRanges(const vector<ClaimedFilter> &filters, i
 			idx_t hi = num_rows;
 			while (lo < hi) {
 				idx_t mid = lo + (hi - lo) / 2;
-				if (EvaluateIndexComparison(mid, filter, comparison)) {
+				if (EvaluateIndexComparison(row_base + mid, filter, comparison)) {
 					lo = mid + 1;
 				} else {
 					hi = mid;
@@ -745,28 +1155,26 @@ static H5ReadFilterEvalResult EvaluateValueComparison(const Value &value, Expres
 	return result ? H5ReadFilterEvalResult::TRUE : H5ReadFilterEvalResult::FALSE;
 }
 
-static vector<RowRange> BuildRangesForRunEncodedColumn(const RunEncodedColumnSpec &encoded_spec,
+static shared_ptr<RunEncodedWindow> LoadRunEncodedWindow(const string &filename, const RunEncodedColumnSpec &spec,
+                                                         const RunEncodedColumnState &state, idx_t window_idx);
+
+// Streams through the runs window by window, so only one window is in memory at a time.
+static vector<RowRange> BuildRangesForRunEncodedColumn(const string &filename, const RunEncodedColumnSpec &encoded_spec,
                                                        const RunEncodedColumnState &encoded_state,
                                                        const vector<ClaimedFilter> &col_filters) {
-	return DispatchOnDuckDBType(encoded_spec.column_type, [&](auto type_tag) -> vector<RowRange> {
-		using T = typename decltype(type_tag)::type;
-		auto &typed_values = std::get<std::vector<T>>(encoded_state.values);
-		D_ASSERT(encoded_state.run_starts.size() == typed_values.size());
-
-		// Loop through runs, building ranges where ALL filters are satisfied
-		vector<RowRange> col_result;
-		idx_t current_start = 0;
-		bool in_range = false;
+	// Loop through runs, building ranges where ALL filters are satisfied
+	vector<RowRange> col_result;
+	idx_t current_start = 0;
+	bool in_range = false;
 
-		// Leading NULL segment (if any) never satisfies comparison filters.
-		if (!encoded_state.run_starts.empty()) {
-			current_start = encoded_state.run_starts[0];
-		}
+	// Leading NULL segment (if any) never satisfies comparison filters.
+	current_start = encoded_state.first_start;
 
-		for (size_t i = 0; i < typed_values.size(); i++) {
-			const T &value = typed_values[i];
-			Value run_value = Value::CreateValue(value);
-			idx_t run_start = encoded_state.run_starts[i];
+	for (idx_t window_idx = 0; window_idx * H5_READ_RUN_WINDOW_RUNS < encoded_state.num_runs; window_idx++) {
+		auto window = LoadRunEncodedWindow(filename, encoded_spec, encoded_state, window_idx);
+		for (idx_t i = 0; i < window->RunCount(); i++) {
+			Value run_value = window->dictionary.GetValue(i);
+			idx_t run_start = window->run_starts[i];
 
 			// Check if this run's value satisfies ALL filters
 			bool satisfies_all = true;
@@ -791,93 +1199,276 @@ static vector<RowRange> BuildRangesForRunEncodedColumn(const RunEncodedColumnSpe
 				in_range = false;
 			}
 		}
+	}
+
+	// Close final range if still open. Rows at or after non_null_end are NULLs.
+	if (in_range && current_start < encoded_state.non_null_end) {
+		col_result.push_back({current_start, encoded_state.non_null_end});
+	}
+
+	return col_result;
+}
 
-		// Close final range if still open. Rows at or after non_null_end are NULLs.
-		if (in_range && current_start < encoded_state.non_null_end) {
-			col_result.push_back({current_start, encoded_state.non_null_end});
+// A chunk can be skipped when some filter is FALSE for every value in [min_value, max_value].
+static bool ZoneMapChunkMayMatch(const Value &min_value, const Value &max_value,
+                                 const vector<ClaimedFilter> &col_filters) {
+	for (const auto &filter : col_filters) {
+		auto may_match = [&](const Value &bound, ExpressionType comparison) {
+			return EvaluateValueComparison(bound, comparison, filter.constant, filter.comparison_type) !=
+			       H5ReadFilterEvalResult::FALSE;
+		};
+		switch (filter.comparison) {
+		case ExpressionType::COMPARE_EQUAL:
+			if (!may_match(max_value, ExpressionType::COMPARE_GREATERTHANOREQUALTO) ||
+			    !may_match(min_value, ExpressionType::COMPARE_LESSTHANOREQUALTO)) {
+				return false;
+			}
+			break;
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			if (!may_match(max_value, filter.comparison)) {
+				return false;
+			}
+			break;
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			if (!may_match(min_value, filter.comparison)) {
+				return false;
+			}
+			break;
+		default:
+			break;
 		}
+	}
+	return true;
+}
 
-		return col_result;
+static vector<RowRange> BuildRangesForZoneMap(const H5ZoneMap &zone_map, const vector<ClaimedFilter> &col_filters,
+                                              idx_t num_rows) {
+	// Chunks without statistics are kept; they get recorded once a scan reads them.
+	vector<RowRange> col_result;
+	idx_t current_start = 0;
+	zone_map.ForEachKnownChunk([&](idx_t chunk_idx, const Value &min_value, const Value &max_value) {
+		if (ZoneMapChunkMayMatch(min_value, max_value, col_filters)) {
+			return;
+		}
+		idx_t chunk_start = chunk_idx * zone_map.ChunkRows();
+		idx_t chunk_end = MinValue<idx_t>(chunk_start + zone_map.ChunkRows(), num_rows);
+		if (current_start < chunk_start) {
+			col_result.push_back({current_start, chunk_start});
+		}
+		current_start = MaxValue<idx_t>(current_start, chunk_end);
 	});
+	if (current_start < num_rows) {
+		col_result.push_back({current_start, num_rows});
+	}
+	return col_result;
 }
 
 //===--------------------------------------------------------------------===//
 // Run-Encoding Helpers
 //===--------------------------------------------------------------------===//
 
-static vector<idx_t> LoadRunBoundaries(const string &filename, const RunEncodedColumnSpec &spec, hid_t boundaries_ds,
-                                       size_t num_runs, hsize_t num_rows, idx_t &non_null_end) {
-	vector<idx_t> boundaries(num_runs);
-	H5ErrorSuppressor suppress;
-	herr_t status = H5Dread(boundaries_ds, H5T_NATIVE_UINT64, H5S_ALL, H5S_ALL, H5P_DEFAULT, boundaries.data());
-	if (status < 0) {
-		throw IOException(FormatDatasetError(string("Failed to read ") + RunBoundaryName(spec.encoding) + " from",
-		                                     filename, spec.boundaries_path));
-	}
+static idx_t ClampRunStart(idx_t run_start, idx_t num_rows) {
+	return MinValue<idx_t>(run_start, num_rows);
+}
 
-	if (!std::is_sorted(boundaries.begin(), boundaries.end())) {
-		throw IOException(FormatDatasetError(string(RunEncodingName(spec.encoding)) + " " +
-		                                         RunBoundaryName(spec.encoding) + " must be non-decreasing",
-		                                     filename, spec.boundaries_path));
+static idx_t RunEndToExclusive(idx_t run_end, idx_t num_rows) {
+	// Clamp before adding 1 to prevent hypothetical overflow.
+	if (run_end >= num_rows) {
+		return num_rows;
 	}
+	return run_end + 1;
+}
 
-	const auto row_count = static_cast<idx_t>(num_rows);
-	auto clamp_to_row_count = [row_count](idx_t boundary) {
-		return std::min(boundary, row_count);
-	};
-	auto exclusive_end_from_inclusive = [row_count](idx_t run_end) {
-		// Clamp before adding 1 to prevent hypothetical overflow.
-		if (run_end >= row_count) {
-			return row_count;
-		}
-		return run_end + 1;
-	};
+static IOException RunBoundariesNotSortedError(const string &filename, const RunEncodedColumnSpec &spec) {
+	return IOException(FormatDatasetError(string(RunEncodingName(spec.encoding)) + " " +
+	                                          RunBoundaryName(spec.encoding) + " must be non-decreasing",
+	                                      filename, spec.boundaries_path));
+}
 
-	if (spec.encoding == RunEncodingKind::START) {
-		non_null_end = row_count;
-		std::transform(boundaries.begin(), boundaries.end(), boundaries.begin(), clamp_to_row_count);
-		return boundaries;
+// Helper: Read boundaries [first, first + count) of a run-encoded column.
+static void ReadRunBoundaries(const string &filename, const RunEncodedColumnSpec &spec,
+                              const RunEncodedColumnState &state, idx_t first, idx_t count, idx_t *out) {
+	auto lock = H5LockForScan();
+	H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
+	H5ErrorSuppressor suppress;
+	hsize_t start = first;
+	hsize_t extent = count;
+	H5DataspaceHandle file_space(state.boundaries_ds);
+	H5DataspaceHandle mem_space(1, &extent);
+	if (!file_space.is_valid() || !mem_space.is_valid() ||
+	    H5Sselect_hyperslab(file_space, H5S_SELECT_SET, &start, nullptr, &extent, nullptr) < 0 ||
+	    H5Dread(state.boundaries_ds, H5T_NATIVE_UINT64, mem_space, file_space, H5P_DEFAULT, out) < 0) {
+		throw IOException(FormatDatasetError(string("Failed to read ") + RunBoundaryName(spec.encoding) + " from",
+		                                     filename, spec.boundaries_path));
 	}
+}
 
-	non_null_end = 0;
-	if (num_runs == 0) {
-		return boundaries;
+// Helper: First row of run by reading its boundary (RSE) or the previous run's end (REE).
+static idx_t ReadRunStart(const string &filename, const RunEncodedColumnSpec &spec, const RunEncodedColumnState &state,
+                          idx_t run) {
+	if (spec.encoding == RunEncodingKind::END && run == 0) {
+		return 0;
 	}
+	idx_t boundary;
+	ReadRunBoundaries(filename, spec, state, spec.encoding == RunEncodingKind::START ? run : run - 1, 1, &boundary);
+	return spec.encoding == RunEncodingKind::START ? ClampRunStart(boundary, state.num_rows)
+	                                               : RunEndToExclusive(boundary, state.num_rows);
+}
 
-	vector<idx_t> run_starts(num_runs);
-	run_starts[0] = 0;
-	for (size_t i = 1; i < num_runs; i++) {
-		run_starts[i] = exclusive_end_from_inclusive(boundaries[i - 1]);
+// Helper: Read the first and last boundary to find the non-NULL rows of a run-encoded column.
+static void InitRunEncodedRowSpan(const string &filename, const RunEncodedColumnSpec &spec,
+                                  RunEncodedColumnState &state) {
+	if (spec.encoding == RunEncodingKind::START) {
+		state.non_null_end = state.num_rows;
+		state.first_start = state.num_runs > 0 ? ReadRunStart(filename, spec, state, 0) : state.num_rows;
+		return;
 	}
-	non_null_end = exclusive_end_from_inclusive(boundaries.back());
-	return run_starts;
+	state.first_start = 0;
+	state.non_null_end = state.num_runs > 0 ? ReadRunStart(filename, spec, state, state.num_runs) : 0;
 }
 
-static RunEncodedColumnState::RunEncodedValueStorage
-LoadRunEncodedValues(const string &filename, const RunEncodedColumnSpec &spec, hid_t values_ds, size_t num_values) {
-	return DispatchOnDuckDBType(spec.column_type, [&](auto type_tag) -> RunEncodedColumnState::RunEncodedValueStorage {
+// Helper: Read values of runs [first, first + count) into the front of dictionary.
+static void ReadRunValues(const string &filename, const RunEncodedColumnSpec &spec, const RunEncodedColumnState &state,
+                          idx_t first, idx_t count, Vector &dictionary) {
+	auto lock = H5LockForScan();
+	H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
+	hsize_t start = first;
+	hsize_t extent = count;
+	H5DataspaceHandle file_space(state.values_ds);
+	H5DataspaceHandle mem_space(1, &extent);
+	{
+		H5ErrorSuppressor suppress;
+		if (!file_space.is_valid() || !mem_space.is_valid() ||
+		    H5Sselect_hyperslab(file_space, H5S_SELECT_SET, &start, nullptr, &extent, nullptr) < 0) {
+			throw IOException(FormatDatasetError("Failed to read values from", filename, spec.values_path));
+		}
+	}
+	DispatchOnDuckDBType(spec.column_type, [&](auto type_tag) {
 		using T = typename decltype(type_tag)::type;
 
 		if constexpr (std::is_same_v<T, string>) {
-			D_ASSERT(spec.values_string_h5_type.has_value());
-			std::vector<string> string_values;
-			string_values.reserve(num_values);
-			ReadHDF5Strings(values_ds, *spec.values_string_h5_type, H5S_ALL, H5S_ALL, num_values, filename,
-			                spec.values_path, [&](idx_t i, const std::string &str) { string_values.push_back(str); });
-			return string_values;
+			D_ASSERT(spec.values_string_h5_type.has_value() && state.values_string_info);
+			auto values = FlatVector::GetData<string_t>(dictionary);
+			ReadHDF5StringViews(state.values_ds, *spec.values_string_h5_type, *state.values_string_info, mem_space,
+			                    file_space, count, filename, spec.values_path,
+			                    [&](idx_t i, const char *data, idx_t size) {
+				                    values[i] = StringVector::AddString(dictionary, data, size);
+			                    });
 		} else {
-			std::vector<T> typed_values(num_values);
 			H5ErrorSuppressor suppress;
-			herr_t status =
-			    H5Dread(values_ds, GetNativeH5Type<T>(), H5S_ALL, H5S_ALL, H5P_DEFAULT, typed_values.data());
+			herr_t status = H5Dread(state.values_ds, GetNativeH5Type<T>(), mem_space, file_space, H5P_DEFAULT,
+			                        FlatVector::GetData<T>(dictionary));
 			if (status < 0) {
 				throw IOException(FormatDatasetError("Failed to read values from", filename, spec.values_path));
 			}
-			return typed_values;
 		}
 	});
 }
 
+// Helper: Load window window_idx of a run-encoded column. Besides the window's own boundaries this reads
+// the one before it, which orders the window after its predecessor and holds the previous run's end for
+// REE, and for RSE the start of the next run.
+static shared_ptr<RunEncodedWindow> LoadRunEncodedWindow(const string &filename, const RunEncodedColumnSpec &spec,
+                                                         const RunEncodedColumnState &state, idx_t window_idx) {
+	auto first_run = window_idx * H5_READ_RUN_WINDOW_RUNS;
+	D_ASSERT(first_run < state.num_runs);
+	auto run_count = MinValue<idx_t>(H5_READ_RUN_WINDOW_RUNS, state.num_runs - first_run);
+	auto read_first = first_run > 0 ? first_run - 1 : 0;
+	auto read_end = first_run + run_count;
+	if (spec.encoding == RunEncodingKind::START && read_end < state.num_runs) {
+		read_end++;
+	}
+	vector<idx_t> boundaries(read_end - read_first);
+	ReadRunBoundaries(filename, spec, state, read_first, boundaries.size(), boundaries.data());
+	if (!std::is_sorted(boundaries.begin(), boundaries.end())) {
+		throw RunBoundariesNotSortedError(filename, spec);
+	}
+
+	auto window = make_shared_ptr<RunEncodedWindow>(spec.column_type, first_run, run_count);
+	auto base = first_run - read_first; // Position of first_run in boundaries
+	for (idx_t i = 0; i < run_count; i++) {
+		if (spec.encoding == RunEncodingKind::START) {
+			window->run_starts[i] = ClampRunStart(boundaries[base + i], state.num_rows);
+		} else {
+			window->run_starts[i] =
+			    first_run + i == 0 ? 0 : RunEndToExclusive(boundaries[base + i - 1], state.num_rows);
+		}
+	}
+	if (spec.encoding == RunEncodingKind::START) {
+		window->end_row = first_run + run_count < state.num_runs ? ClampRunStart(boundaries.back(), state.num_rows)
+		                                                         : state.non_null_end;
+	} else {
+		window->end_row = RunEndToExclusive(boundaries.back(), state.num_rows);
+	}
+	ReadRunValues(filename, spec, state, first_run, run_count, window->dictionary);
+	FlatVector::SetNull(window->dictionary, window->NullIndex(), true);
+	return window;
+}
+
+// Helper: Binary search the boundaries on disk for the run holding row.
+static idx_t FindRunOnDisk(const string &filename, const RunEncodedColumnSpec &spec, const RunEncodedColumnState &state,
+                           idx_t row) {
+	idx_t low = 0; // ReadRunStart(low) <= row
+	idx_t high = state.num_runs;
+	while (high - low > 1) {
+		auto mid = low + (high - low) / 2;
+		if (ReadRunStart(filename, spec, state, mid) <= row) {
+			low = mid;
+		} else {
+			high = mid;
+		}
+	}
+	return low;
+}
+
+// Helper: Return a loaded window holding row, which must be in [first_start, non_null_end).
+static shared_ptr<RunEncodedWindow> GetRunEncodedWindow(const string &filename, const RunEncodedColumnSpec &spec,
+                                                        const RunEncodedColumnState &state, idx_t row) {
+	D_ASSERT(state.first_start <= row && row < state.non_null_end);
+	auto &cache = *state.window_cache;
+	optional_idx next_window;
+	{
+		std::lock_guard<std::mutex> guard(cache.lock);
+		idx_t latest_end = 0;
+		for (auto it = cache.windows.begin(); it != cache.windows.end(); ++it) {
+			auto &window = *it;
+			if (window->Contains(row)) {
+				auto result = window;
+				cache.windows.splice(cache.windows.begin(), cache.windows, it);
+				return result;
+			}
+			if (window->end_row <= row && window->end_row >= latest_end) {
+				latest_end = window->end_row;
+				next_window = window->first_run / H5_READ_RUN_WINDOW_RUNS + 1;
+			}
+		}
+	}
+
+	// Sequential scans continue in the window after the furthest one before row; otherwise (or if
+	// runs without rows sit in between) search the boundaries.
+	shared_ptr<RunEncodedWindow> window;
+	if (next_window.IsValid() && next_window.GetIndex() * H5_READ_RUN_WINDOW_RUNS < state.num_runs) {
+		window = LoadRunEncodedWindow(filename, spec, state, next_window.GetIndex());
+	}
+	if (!window || !window->Contains(row)) {
+		auto run = FindRunOnDisk(filename, spec, state, row);
+		window = LoadRunEncodedWindow(filename, spec, state, run / H5_READ_RUN_WINDOW_RUNS);
+		if (!window->Contains(row)) {
+			// The search only lands outside its window if boundaries elsewhere are out of order.
+			throw RunBoundariesNotSortedError(filename, spec);
+		}
+	}
+
+	std::lock_guard<std::mutex> guard(cache.lock);
+	cache.windows.push_front(window);
+	while (cache.windows.size() > H5_READ_RUN_WINDOW_CACHE) {
+		cache.windows.pop_back();
+	}
+	return window;
+}
+
 static bool IsAliasStructType(const LogicalType &type) {
 	if (type.id() != LogicalTypeId::STRUCT) {
 		return false;
@@ -900,6 +1491,15 @@ static bool IsIndexStructType(const LogicalType &type) {
 	return children[0].second == LogicalType::VARCHAR;
 }
 
+static bool IsSliceStructType(const LogicalType &type) {
+	if (type.id() != LogicalTypeId::STRUCT) {
+		return false;
+	}
+	auto &children = StructType::GetChildTypes(type);
+	return children.size() == 3 && children[0].second == LogicalType::VARCHAR &&
+	       children[1].second == LogicalType::VARCHAR && children[2].second.id() == LogicalTypeId::LIST;
+}
+
 static Value UnwrapAliasSpec(const Value &input, std::optional<std::string> &alias_name) {
 	Value current = input;
 	while (IsAliasStructType(current.type())) {
@@ -918,72 +1518,745 @@ static Value UnwrapAliasSpec(const Value &input, std::optional<std::string> &ali
 	return current;
 }
 
-//===--------------------------------------------------------------------===//
-// h5_read - Read datasets from HDF5 files
-//===--------------------------------------------------------------------===//
+// Narrows the inner dimensions of a bound regular column to its h5_slice() selection. Every entry of slices is
+// NULL (whole dimension) or [start, stop] / [start, stop, step] with a half-open, 0-based range; missing trailing
+// entries select whole dimensions. The row dimension is always read in full.
+static void ApplyH5ReadSlice(RegularColumnSpec &spec, const Value &slices, const string &filename) {
+	if (slices.IsNull()) {
+		throw InvalidInputException("h5_slice() requires a list of dimension ranges");
+	}
+	auto &entries = ListValue::GetChildren(slices);
+	if (entries.size() > static_cast<idx_t>(spec.ndims)) {
+		auto message = StringUtil::Format("h5_slice() has %llu dimension ranges for %d-dimensional dataset",
+		                                  entries.size(), spec.ndims);
+		throw IOException(FormatDatasetError(message, filename, spec.path));
+	}
+	if (!entries.empty() && !entries[0].IsNull()) {
+		throw InvalidInputException("h5_slice() cannot select the row dimension; pass NULL as its range and filter on "
+		                            "h5_index() instead");
+	}
 
-static void PopulateH5ReadOutputSchema(const vector<ColumnSpec> &columns, vector<LogicalType> &return_types,
-                                       vector<string> &names) {
-	names.clear();
-	return_types.clear();
-	for (const auto &col : columns) {
-		std::visit(
-		    [&](auto &&spec) {
-			    names.push_back(spec.column_name);
-			    return_types.push_back(spec.column_type);
-		    },
-		    col);
+	std::vector<hsize_t> start(spec.ndims, 0);
+	std::vector<hsize_t> stride(spec.ndims, 1);
+	std::vector<hsize_t> count(spec.dims);
+	bool narrowed = false;
+	for (idx_t dim = 1; dim < entries.size(); dim++) {
+		if (entries[dim].IsNull()) {
+			continue;
+		}
+		auto &bounds = ListValue::GetChildren(entries[dim]);
+		if ((bounds.size() != 2 && bounds.size() != 3) ||
+		    std::any_of(bounds.begin(), bounds.end(), [](const Value &bound) { return bound.IsNull(); })) {
+			throw InvalidInputException("h5_slice() dimension ranges must be NULL, [start, stop], or [start, stop, "
+			                            "step]");
+		}
+		auto range_start = bounds[0].GetValue<int64_t>();
+		auto range_stop = bounds[1].GetValue<int64_t>();
+		auto range_step = bounds.size() == 3 ? bounds[2].GetValue<int64_t>() : 1;
+		auto extent = static_cast<int64_t>(spec.dims[dim]);
+		if (range_step < 1) {
+			throw InvalidInputException("h5_slice() step must be at least 1");
+		}
+		if (range_start < 0 || range_stop > extent || range_start >= range_stop) {
+			auto message = StringUtil::Format("h5_slice() range [%lld, %lld) is empty or out of bounds for dimension "
+			                                  "%llu of size %lld in dataset",
+			                                  range_start, range_stop, dim, extent);
+			throw IOException(FormatDatasetError(message, filename, spec.path));
+		}
+		start[dim] = static_cast<hsize_t>(range_start);
+		stride[dim] = static_cast<hsize_t>(range_step);
+		count[dim] = static_cast<hsize_t>((range_stop - range_start + range_step - 1) / range_step);
+		narrowed = narrowed || count[dim] != spec.dims[dim];
+	}
+	if (!narrowed) {
+		return;
 	}
+	spec.slice_start = std::move(start);
+	spec.slice_stride = std::move(stride);
+	spec.dims = std::move(count);
 }
 
-static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, const string &filename, bool swmr,
-                                                     const vector<Value> &inputs) {
-	H5ReadSingleFileBindData result;
-	result.filename = filename;
-	result.swmr = swmr;
-	size_t num_columns = inputs.size() - 1;
+// Completes a bound regular column from the DuckDB type of its elements: output footprint and collection type.
+static void SetRegularColumnType(RegularColumnSpec &spec, const LogicalType &base_type, const string &filename) {
+	// Calculate DuckDB output bytes/elements for this column in one scan row.
+	// This intentionally uses the DuckDB/native memory size, not the file size:
+	// e.g. HDF5 float16 values are widened into DuckDB FLOAT values.
+	spec.output_bytes_per_row = spec.is_string ? 0 : H5ReadNumericOutputElementSize(base_type);
+	spec.elements_per_row = 1;
+	auto shape = spec.ValueShape();
+	auto value_ndims = static_cast<int>(shape.size());
+	for (int j = 1; j < value_ndims; j++) {
+		auto dimension = static_cast<idx_t>(shape[j]);
+		spec.output_bytes_per_row =
+		    CheckedDatasetSizeProduct(spec.output_bytes_per_row, dimension, filename, spec.path);
+		spec.elements_per_row = CheckedDatasetSizeProduct(spec.elements_per_row, dimension, filename, spec.path);
+	}
+	auto uses_nested_lists = value_ndims > 1 && spec.output_bytes_per_row >= H5_READ_WIDE_ROW_THRESHOLD_BYTES;
 
-	// Lock for all HDF5 operations (not thread-safe)
-	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	// Fixed ARRAY vectors eagerly allocate STANDARD_VECTOR_SIZE rows. Use nested
+	// LIST vectors for wide rows so allocation follows the actual scan batch.
+	spec.column_type = BuildCollectionType(base_type, shape, value_ndims, uses_nested_lists, filename, spec.path);
+}
 
-	// Open file once (with error suppression) - RAII wrapper handles cleanup
-	H5FileHandle file;
-	{
-		H5ErrorSuppressor suppress;
-		file = H5FileHandle(&context, result.filename.c_str(), H5F_ACC_RDONLY, result.swmr);
+// Memory type selecting one member of a compound dataset: a compound of member_size bytes with the member at offset 0.
+static H5TypeHandle CreateCompoundFieldReadType(const string &member_name, hid_t member_type, size_t member_size,
+                                                const string &filename, const string &dataset_path) {
+	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	auto read_type = H5TypeHandle::TakeOwnershipOf(H5Tcreate(H5T_COMPOUND, member_size));
+	if (read_type.get() < 0 || H5Tinsert(read_type, member_name.c_str(), 0, member_type) < 0) {
+		throw IOException(FormatDatasetError("Failed to create read type for compound field '" + member_name + "'",
+		                                     filename, dataset_path));
 	}
+	return read_type;
+}
 
-	if (!file.is_valid()) {
-		throw IOException(FormatRemoteHDF5Error("Failed to open HDF5 file", result.filename));
-	}
+// DuckDB ENUM type of an HDF5 enum type, with the members in the order the enum type lists them, and the memory type
+// that reads stored values as the ENUM's codes.
+struct H5ReadEnumType {
+	LogicalType column_type;
+	H5TypeHandle read_type;
+};
 
-	// Track minimum rows across all non-scalar regular columns
-	hsize_t min_rows = std::numeric_limits<hsize_t>::max();
-	size_t num_regular_columns = 0;
-	size_t non_scalar_regular_columns = 0;
-	bool has_run_encoded_columns = false;
+// The read type is an enum of the same members whose values are their codes, so H5Dread maps stored values to codes
+// by member name. When the stored values already are the codes, in an integer of the code's size and byte order, the
+// stored type itself is the read type: values are copied as stored, which also lets chunks be decoded and
+// contiguous rows read without H5Dread.
+static H5ReadEnumType CreateH5ReadEnumType(hid_t enum_type, const string &filename, const string &dataset_path) {
+	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	auto member_count = H5Tget_nmembers(enum_type);
+	if (member_count <= 0) {
+		throw IOException(FormatDatasetError("Enum dataset has no members", filename, dataset_path));
+	}
+	auto base_type = H5TypeHandle::TakeOwnershipOf(H5Tget_super(enum_type));
+	if (base_type.get() < 0) {
+		throw IOException(FormatDatasetError("Failed to get base type of enum dataset", filename, dataset_path));
+	}
 
-	// Process each column (regular dataset, run-encoded, or index)
-	for (size_t i = 0; i < num_columns; i++) {
-		const auto &input_val = inputs[i + 1];
-		std::optional<std::string> alias_name;
-		Value column_val = UnwrapAliasSpec(input_val, alias_name);
+	vector<string> member_names;
+	Vector names(LogicalType::VARCHAR, static_cast<idx_t>(member_count));
+	auto name_data = FlatVector::GetData<string_t>(names);
+	bool values_are_codes = true;
+	std::vector<uint8_t> member_value(MaxValue<size_t>(H5Tget_size(base_type), sizeof(int64_t)));
+	for (int member_idx = 0; member_idx < member_count; member_idx++) {
+		char *raw_name = H5Tget_member_name(enum_type, static_cast<unsigned>(member_idx));
+		if (!raw_name) {
+			throw IOException(
+			    FormatDatasetError("Failed to get enum member name of dataset", filename, dataset_path));
+		}
+		member_names.emplace_back(raw_name);
+		H5free_memory(raw_name);
+		name_data[member_idx] = StringVector::AddString(names, member_names.back());
+
+		int64_t value = -1;
+		if (H5Tget_member_value(enum_type, static_cast<unsigned>(member_idx), member_value.data()) >= 0 &&
+		    H5Tconvert(base_type, H5T_NATIVE_INT64, 1, member_value.data(), nullptr, H5P_DEFAULT) >= 0) {
+			std::memcpy(&value, member_value.data(), sizeof(value));
+		}
+		values_are_codes = values_are_codes && value == member_idx;
+	}
 
-		// Check for virtual index or run-encoded column (STRUCT type)
-		if (column_val.type().id() == LogicalTypeId::STRUCT) {
-			auto &children = StructValue::GetChildren(column_val);
+	H5ReadEnumType result;
+	result.column_type = LogicalType::ENUM(names, static_cast<idx_t>(member_count));
+	auto code_type = DispatchOnNumericType(result.column_type, [](auto type_tag) {
+		using T = typename decltype(type_tag)::type;
+		return GetNativeH5Type<T>();
+	});
+	if (values_are_codes && H5Tget_size(base_type) == H5Tget_size(code_type) &&
+	    H5Tget_order(base_type) == H5Tget_order(code_type)) {
+		result.read_type = H5TypeHandle(enum_type);
+		return result;
+	}
 
-			if (IsIndexStructType(column_val.type())) {
-				if (children[0].GetValue<string>() != "__index__") {
-					throw InvalidInputException("Unknown struct argument for h5_read");
-				}
+	result.read_type = H5TypeHandle::TakeOwnershipOf(H5Tenum_create(code_type));
+	if (result.read_type.get() < 0) {
+		throw IOException(FormatDatasetError("Failed to create read type for enum dataset", filename, dataset_path));
+	}
+	for (idx_t code = 0; code < member_names.size(); code++) {
+		auto status = DispatchOnNumericType(result.column_type, [&](auto type_tag) {
+			using T = typename decltype(type_tag)::type;
+			auto code_value = static_cast<T>(code);
+			return H5Tenum_insert(result.read_type, member_names[code].c_str(), &code_value);
+		});
+		if (status < 0) {
+			throw IOException(
+			    FormatDatasetError("Failed to create read type for enum dataset", filename, dataset_path));
+		}
+	}
+	return result;
+}
 
-				IndexColumnSpec index_spec;
-				index_spec.column_name = alias_name ? *alias_name : "index";
-				index_spec.column_type = LogicalType::BIGINT;
+// Expands a compound dataset into one regular column per member, named after the member (prefixed with the alias
+// and '_' when the dataset was aliased). Projection pushdown then reads only the referenced members. Array members
+// become ARRAY columns whose inner dimensions follow the dataset's. Members without a DuckDB representation (e.g.
+// nested compounds) are skipped, so the other fields stay readable; binding fails only when no member is left.
+static void AppendCompoundFieldColumns(const RegularColumnSpec &dataset_spec, hid_t compound_type,
+                                       const std::optional<string> &alias_name, const string &filename,
+                                       vector<ColumnSpec> &columns) {
+	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	auto member_count = H5Tget_nmembers(compound_type);
+	if (member_count <= 0) {
+		throw IOException(FormatDatasetError("Compound dataset has no members", filename, dataset_spec.path));
+	}
+	string first_skipped_error;
+	idx_t field_count = 0;
+	for (int member_idx = 0; member_idx < member_count; member_idx++) {
+		char *raw_name = H5Tget_member_name(compound_type, static_cast<unsigned>(member_idx));
+		if (!raw_name) {
+			throw IOException(
+			    FormatDatasetError("Failed to get compound member name of dataset", filename, dataset_spec.path));
+		}
+		string member_name(raw_name);
+		H5free_memory(raw_name);
+		auto value_type = H5TypeHandle::TakeOwnershipOf(H5Tget_member_type(compound_type, member_idx));
+		if (value_type.get() < 0) {
+			throw IOException(
+			    FormatDatasetError("Failed to get compound member type of dataset", filename, dataset_spec.path));
+		}
 
-				result.columns.push_back(std::move(index_spec));
-				continue;
+		RegularColumnSpec field;
+		field.path = dataset_spec.path;
+		field.column_name = alias_name ? *alias_name + "_" + member_name : member_name;
+		field.ndims = dataset_spec.ndims;
+		field.dims = dataset_spec.dims;
+		field.slice_start = dataset_spec.slice_start;
+		field.slice_stride = dataset_spec.slice_stride;
+		field.stored_dims = dataset_spec.stored_dims;
+		if (H5Tget_class(value_type) == H5T_ARRAY) {
+			auto rank = H5Tget_array_ndims(value_type);
+			field.member_dims.resize(static_cast<idx_t>(MaxValue(rank, 0)));
+			if (rank <= 0 || H5Tget_array_dims2(value_type, field.member_dims.data()) < 0) {
+				throw IOException(FormatDatasetError("Failed to get array dimensions of compound field '" +
+				                                         member_name + "' of dataset",
+				                                     filename, dataset_spec.path));
+			}
+			auto element_type = H5TypeHandle::TakeOwnershipOf(H5Tget_super(value_type));
+			if (element_type.get() < 0) {
+				throw IOException(FormatDatasetError("Failed to get element type of compound field '" + member_name +
+				                                         "' of dataset",
+				                                     filename, dataset_spec.path));
+			}
+			value_type = std::move(element_type);
+		}
+		field.is_string = H5Tget_class(value_type) == H5T_STRING;
+
+		LogicalType base_type;
+		std::optional<H5ReadEnumType> enum_type;
+		try {
+			if (field.is_string && (field.ndims > 1 || !field.member_dims.empty())) {
+				throw IOException("String fields of compound datasets with more than 1 dimension are not supported");
+			}
+			if (H5Tget_class(value_type) == H5T_ENUM) {
+				enum_type = CreateH5ReadEnumType(value_type, filename, dataset_spec.path);
+				base_type = enum_type->column_type;
+			} else {
+				base_type = H5TypeToDuckDBType(value_type);
+			}
+			SetRegularColumnType(field, base_type, filename);
+		} catch (IOException &ex) {
+			if (first_skipped_error.empty()) {
+				first_skipped_error =
+				    "Compound field '" + member_name + "' has unsupported type (" + ErrorData(ex).RawMessage() + ")";
+			}
+			continue;
+		}
+
+		field.compound_member = member_name;
+		if (field.is_string) {
+			field.compound_read_type = CreateCompoundFieldReadType(member_name, value_type, H5Tget_size(value_type),
+			                                                       filename, dataset_spec.path);
+			field.string_h5_type = std::move(value_type);
+		} else {
+			auto read_type = enum_type ? std::move(enum_type->read_type)
+			                           : DispatchOnNumericType(base_type, [](auto type_tag) {
+				                             using T = typename decltype(type_tag)::type;
+				                             return H5TypeHandle(GetNativeH5Type<T>());
+			                             });
+			if (!field.member_dims.empty()) {
+				read_type = H5TypeHandle::TakeOwnershipOf(H5Tarray_create2(
+				    read_type, static_cast<unsigned>(field.member_dims.size()), field.member_dims.data()));
+				if (read_type.get() < 0) {
+					throw IOException(FormatDatasetError("Failed to create read type for compound field '" +
+					                                         member_name + "'",
+					                                     filename, dataset_spec.path));
+				}
+			}
+			field.compound_read_type = CreateCompoundFieldReadType(member_name, read_type, H5Tget_size(read_type),
+			                                                       filename, dataset_spec.path);
+		}
+		columns.push_back(std::move(field));
+		field_count++;
+	}
+	if (field_count == 0) {
+		throw IOException(FormatDatasetError(first_skipped_error + " in dataset", filename, dataset_spec.path));
+	}
+}
+
+// HDF5 memory type for reading the values of a regular column: value_type (the native numeric type or the stored
+// string type), the single-member read type for a field of a compound dataset, or the code type of an enum dataset.
+static hid_t RegularColumnReadType(const RegularColumnSpec &spec, hid_t value_type) {
+	if (spec.compound_read_type) {
+		return spec.compound_read_type->get();
+	}
+	return spec.enum_read_type ? spec.enum_read_type->get() : value_type;
+}
+
+// Memory type numeric reads of a column use: its stored representation when scan threads convert the values
+// themselves, otherwise the type from RegularColumnReadType.
+static hid_t RegularColumnNumericReadType(const RegularColumnSpec &spec, const RegularColumnState &state,
+                                          hid_t native_type) {
+	return state.stored_conversion ? state.stored_conversion->read_type.get()
+	                               : RegularColumnReadType(spec, native_type);
+}
+
+// Converts rows read with RegularColumnNumericReadType into the column's native values. Must run after
+// hdf5_global_mutex is released, so conversion never holds up other threads' HDF5 reads.
+static void ApplyRegularColumnConversion(const RegularColumnSpec &spec, const RegularColumnState &state,
+                                         data_ptr_t data, idx_t rows) {
+	if (state.stored_conversion) {
+		H5ApplyStoredConversion(*state.stored_conversion, data, rows * spec.elements_per_row);
+	}
+}
+
+// Whether value, read with the memory type from CreateH5ReadEnumType, is the code of a member of the ENUM type. Stored
+// values that are not members of the HDF5 enum read as codes past the members: as stored when the stored values are
+// the codes, otherwise as all ones from HDF5's conversion by member name. The fill value of an unallocated dataset
+// reads the same way.
+template <class T>
+static bool H5ReadIsEnumCode(const LogicalType &type, T value) {
+	if constexpr (std::is_integral<T>::value) {
+		return static_cast<uint64_t>(value) < EnumType::GetSize(type);
+	} else {
+		return true;
+	}
+}
+
+// Marks the values of an enum column in the rows just read into target_vector NULL when they are not member codes.
+static void MarkInvalidEnumCodesNull(const RegularColumnSpec &spec, Vector &target_vector, idx_t rows) {
+	auto base_type = GetBaseType(spec.column_type);
+	if (base_type.id() != LogicalTypeId::ENUM) {
+		return;
+	}
+	DispatchOnNumericType(base_type, [&](auto type_tag) {
+		using T = typename decltype(type_tag)::type;
+		auto codes = FlatVector::GetData<T>(target_vector);
+		auto &validity = FlatVector::Validity(target_vector);
+		auto count = rows * spec.elements_per_row;
+		for (idx_t i = 0; i < count; i++) {
+			if (!H5ReadIsEnumCode(base_type, codes[i])) {
+				validity.SetInvalid(i);
+			}
+		}
+	});
+}
+
+//===--------------------------------------------------------------------===//
+// h5_read - Read datasets from HDF5 files
+//===--------------------------------------------------------------------===//
+
+static void PopulateH5ReadOutputSchema(const vector<ColumnSpec> &columns, vector<LogicalType> &return_types,
+                                       vector<string> &names) {
+	names.clear();
+	return_types.clear();
+	for (const auto &col : columns) {
+		std::visit(
+		    [&](auto &&spec) {
+			    names.push_back(spec.column_name);
+			    return_types.push_back(spec.column_type);
+		    },
+		    col);
+	}
+}
+
+// Run-encoded values datasets up to this many values are read at bind for the column's statistics.
+static constexpr idx_t H5_READ_RUN_VALUES_STATS_MAX = 65536;
+
+// Reads count numeric values with type file_type through read(mem_type, buffer), converted by HDF5 to 64-bit
+// integers or doubles, and returns them as values of column_type. Returns an empty vector for non-numeric types,
+// NaN, and values column_type cannot represent exactly.
+template <class READ>
+static vector<Value> ReadH5RangeValues(hid_t file_type, idx_t count, const LogicalType &column_type, READ &&read) {
+	vector<Value> result;
+	auto type_class = H5Tget_class(file_type);
+	if (type_class == H5T_INTEGER && H5Tget_sign(file_type) == H5T_SGN_NONE) {
+		vector<uint64_t> values(count);
+		if (read(H5T_NATIVE_UINT64, values.data()) < 0) {
+			return {};
+		}
+		for (auto value : values) {
+			result.push_back(Value::UBIGINT(value));
+		}
+	} else if (type_class == H5T_INTEGER) {
+		vector<int64_t> values(count);
+		if (read(H5T_NATIVE_INT64, values.data()) < 0) {
+			return {};
+		}
+		for (auto value : values) {
+			result.push_back(Value::BIGINT(value));
+		}
+	} else if (type_class == H5T_FLOAT) {
+		vector<double> values(count);
+		if (read(H5T_NATIVE_DOUBLE, values.data()) < 0) {
+			return {};
+		}
+		for (auto value : values) {
+			if (std::isnan(value)) {
+				return {};
+			}
+			result.push_back(Value::DOUBLE(value));
+		}
+	} else {
+		return {};
+	}
+	// Casts that round (e.g. a fractional attribute of an integer dataset) would no longer bound the values
+	for (auto &value : result) {
+		auto read_value = value;
+		if (!value.DefaultTryCastAs(column_type) || value.DefaultCastAs(read_value.type()) != read_value) {
+			return {};
+		}
+	}
+	return result;
+}
+
+// Reads the numeric attribute name of object, which must hold count values. See ReadH5RangeValues.
+static vector<Value> ReadH5RangeAttribute(hid_t object, const string &name, idx_t count,
+                                          const LogicalType &column_type) {
+	if (H5Aexists(object, name.c_str()) <= 0) {
+		return {};
+	}
+	H5AttributeHandle attribute(object, name.c_str());
+	if (!attribute.is_valid()) {
+		return {};
+	}
+	auto space = H5DataspaceHandle::TakeOwnershipOf(H5Aget_space(attribute));
+	if (!space.is_valid() || H5Sget_simple_extent_npoints(space) != static_cast<hssize_t>(count)) {
+		return {};
+	}
+	auto type = H5TypeHandle::TakeOwnershipOf(H5Aget_type(attribute));
+	if (!type.is_valid()) {
+		return {};
+	}
+	return ReadH5RangeValues(type, count, column_type,
+	                         [&](hid_t mem_type, void *buffer) { return H5Aread(attribute, mem_type, buffer); });
+}
+
+// Value range of a regular column from the h5db_range_attributes of its dataset: one attribute holding [min, max],
+// or a min and a max attribute. The attributes are trusted to bound every value of the dataset.
+static std::optional<H5ReadColumnRange> ReadH5RangeAttributes(hid_t dataset, const vector<string> &range_attributes,
+                                                              const LogicalType &column_type) {
+	H5ErrorSuppressor suppress;
+	vector<Value> bounds;
+	if (range_attributes.size() == 1) {
+		bounds = ReadH5RangeAttribute(dataset, range_attributes[0], 2, column_type);
+	} else {
+		auto min_value = ReadH5RangeAttribute(dataset, range_attributes[0], 1, column_type);
+		auto max_value = ReadH5RangeAttribute(dataset, range_attributes[1], 1, column_type);
+		if (!min_value.empty() && !max_value.empty()) {
+			bounds = {std::move(min_value[0]), std::move(max_value[0])};
+		}
+	}
+	if (bounds.size() != 2 || bounds[1] < bounds[0]) {
+		return std::nullopt;
+	}
+	H5ReadColumnRange range;
+	range.min = std::move(bounds[0]);
+	range.max = std::move(bounds[1]);
+	return range;
+}
+
+// Value range and distinct count of a run-encoded column, from its whole values dataset when that is small. The
+// scan itself loads values in windows, so this is the only point where all of them are known up front.
+static std::optional<H5ReadColumnRange> ReadH5RunValuesRange(hid_t values_ds, hid_t values_type,
+                                                             const LogicalType &column_type) {
+	H5ErrorSuppressor suppress;
+	H5DataspaceHandle space(values_ds);
+	if (!space.is_valid() || H5Sget_simple_extent_ndims(space) != 1) {
+		return std::nullopt;
+	}
+	auto count = H5Sget_simple_extent_npoints(space);
+	if (count <= 0 || static_cast<idx_t>(count) > H5_READ_RUN_VALUES_STATS_MAX) {
+		return std::nullopt;
+	}
+	auto read = [&](hid_t mem_type, void *buffer) {
+		return H5Dread(values_ds, mem_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer);
+	};
+	auto values = ReadH5RangeValues(values_type, static_cast<idx_t>(count), column_type, read);
+	if (values.empty()) {
+		return std::nullopt;
+	}
+	std::sort(values.begin(), values.end());
+	H5ReadColumnRange range;
+	range.min = values.front();
+	range.max = values.back();
+	range.distinct_count = static_cast<idx_t>(std::unique(values.begin(), values.end()) - values.begin());
+	return range;
+}
+
+// Rows [first, first + count) selected in a dataspace of extent dims, when the selection is one box that spans every
+// other dimension. Unlimited selections, which printf-style virtual dataset mappings use, are never boxes.
+static std::optional<std::pair<idx_t, idx_t>> GetSelectedRowBlock(hid_t space, const std::vector<hsize_t> &dims) {
+	auto ndims = static_cast<idx_t>(dims.size());
+	if (ndims == 0 || H5Sget_simple_extent_ndims(space) != static_cast<int>(ndims)) {
+		return std::nullopt;
+	}
+	auto select_type = H5Sget_select_type(space);
+	if (select_type == H5S_SEL_HYPERSLAB) {
+		if (H5Sis_regular_hyperslab(space) <= 0) {
+			return std::nullopt;
+		}
+		std::vector<hsize_t> start(ndims), stride(ndims), count(ndims), block(ndims);
+		if (H5Sget_regular_hyperslab(space, start.data(), stride.data(), count.data(), block.data()) < 0) {
+			return std::nullopt;
+		}
+		for (idx_t d = 0; d < ndims; d++) {
+			if (count[d] == H5S_UNLIMITED || block[d] == H5S_UNLIMITED) {
+				return std::nullopt;
+			}
+		}
+	} else if (select_type != H5S_SEL_ALL) {
+		return std::nullopt;
+	}
+
+	std::vector<hsize_t> start(ndims), end(ndims);
+	if (H5Sget_select_bounds(space, start.data(), end.data()) < 0) {
+		return std::nullopt;
+	}
+	hsize_t box_points = 1;
+	for (idx_t d = 0; d < ndims; d++) {
+		if (d > 0 && (start[d] != 0 || end[d] + 1 != dims[d])) {
+			return std::nullopt;
+		}
+		box_points *= end[d] - start[d] + 1;
+	}
+	auto points = H5Sget_select_npoints(space);
+	if (points <= 0 || static_cast<hsize_t>(points) != box_points) {
+		return std::nullopt;
+	}
+	return std::make_pair(static_cast<idx_t>(start[0]), static_cast<idx_t>(end[0] - start[0] + 1));
+}
+
+// Source file or dataset name of a virtual dataset mapping, read with H5Pget_virtual_filename or
+// H5Pget_virtual_dsetname.
+template <class GET_NAME>
+static std::optional<string> GetH5VirtualMappingName(GET_NAME get_name) {
+	auto length = get_name(nullptr, 0);
+	if (length < 0) {
+		return std::nullopt;
+	}
+	std::vector<char> buffer(static_cast<size_t>(length) + 1);
+	if (get_name(buffer.data(), buffer.size()) < 0) {
+		return std::nullopt;
+	}
+	return string(buffer.data(), static_cast<size_t>(length));
+}
+
+// The file a virtual dataset mapping reads from, as HDF5 finds it when no prefix is configured: "." is the virtual
+// dataset's own file, and relative names are relative to its directory.
+static string ResolveH5ReadVirtualSourceFile(const string &filename, const string &source_filename) {
+	if (source_filename == ".") {
+		return filename;
+	}
+	if (StringUtil::StartsWith(source_filename, "/") || source_filename.find("://") != string::npos) {
+		return source_filename;
+	}
+	auto slash = filename.find_last_of('/');
+	if (slash == string::npos) {
+		return source_filename;
+	}
+	return filename.substr(0, slash + 1) + source_filename;
+}
+
+// One mapping of a virtual dataset, when it places a whole source dataset of the same inner shape at a range of rows.
+static std::optional<H5ReadVirtualSource> GetH5ReadVirtualMapping(hid_t dcpl, size_t mapping,
+                                                                  const RegularColumnSpec &spec,
+                                                                  const string &filename) {
+	auto virtual_space = H5DataspaceHandle::TakeOwnershipOf(H5Pget_virtual_vspace(dcpl, mapping));
+	auto source_space = H5DataspaceHandle::TakeOwnershipOf(H5Pget_virtual_srcspace(dcpl, mapping));
+	if (!virtual_space.is_valid() || !source_space.is_valid()) {
+		return std::nullopt;
+	}
+	auto rows = GetSelectedRowBlock(virtual_space, spec.stored_dims);
+	std::vector<hsize_t> source_dims(spec.stored_dims.size());
+	if (!rows || H5Sget_simple_extent_ndims(source_space) != spec.ndims ||
+	    H5Sget_simple_extent_dims(source_space, source_dims.data(), nullptr) < 0) {
+		return std::nullopt;
+	}
+	auto source_rows = GetSelectedRowBlock(source_space, source_dims);
+	if (!source_rows || source_rows->first != 0 || source_rows->second != rows->second ||
+	    !std::equal(source_dims.begin() + 1, source_dims.end(), spec.stored_dims.begin() + 1)) {
+		return std::nullopt;
+	}
+
+	auto source_file = GetH5VirtualMappingName(
+	    [&](char *name, size_t size) { return H5Pget_virtual_filename(dcpl, mapping, name, size); });
+	auto source_dataset = GetH5VirtualMappingName(
+	    [&](char *name, size_t size) { return H5Pget_virtual_dsetname(dcpl, mapping, name, size); });
+	// '%' starts a printf-style substitution, which only unlimited mappings use, or escapes a literal '%'
+	if (!source_file || !source_dataset || source_file->find('%') != string::npos ||
+	    source_dataset->find('%') != string::npos) {
+		return std::nullopt;
+	}
+	H5ReadVirtualSource source;
+	source.filename = ResolveH5ReadVirtualSourceFile(filename, *source_file);
+	source.first_row = rows->first;
+	source.num_rows = rows->second;
+	source.dataset_paths[spec.path] = *source_dataset;
+	return source;
+}
+
+// Sources of a regular column's rows, in row order, when its dataset is virtual and every mapping places a whole
+// source dataset at a range of rows, together covering each row once. Other datasets and mappings (unlimited or
+// partial selections, gaps that read as fill values, overlaps) return nothing and are read through H5Dread.
+static std::optional<vector<H5ReadVirtualSource>> GetH5ReadVirtualSources(hid_t dataset_id,
+                                                                         const RegularColumnSpec &spec,
+                                                                         const string &filename) {
+	if (std::getenv("HDF5_VDS_PREFIX")) {
+		// HDF5 looks for relative source files under the prefix first
+		return std::nullopt;
+	}
+	H5ErrorSuppressor suppress;
+	hid_t dcpl = H5Dget_create_plist(dataset_id);
+	if (dcpl < 0) {
+		return std::nullopt;
+	}
+	std::optional<vector<H5ReadVirtualSource>> result;
+	size_t mapping_count = 0;
+	if (H5Pget_layout(dcpl) == H5D_VIRTUAL && H5Pget_virtual_count(dcpl, &mapping_count) >= 0 && mapping_count > 0) {
+		result.emplace();
+		for (size_t mapping = 0; mapping < mapping_count; mapping++) {
+			auto source = GetH5ReadVirtualMapping(dcpl, mapping, spec, filename);
+			if (!source) {
+				result.reset();
+				break;
+			}
+			result->push_back(std::move(*source));
+		}
+	}
+	H5Pclose(dcpl);
+	if (!result) {
+		return std::nullopt;
+	}
+
+	std::sort(result->begin(), result->end(), [](const H5ReadVirtualSource &a, const H5ReadVirtualSource &b) {
+		return a.first_row < b.first_row;
+	});
+	idx_t next_row = 0;
+	for (auto &source : *result) {
+		if (source.first_row != next_row) {
+			return std::nullopt;
+		}
+		next_row += source.num_rows;
+	}
+	if (next_row != spec.stored_dims[0]) {
+		return std::nullopt;
+	}
+	return result;
+}
+
+// Adds the sources of one more virtual column to those of the file's earlier columns. The columns are only scanned
+// from their sources when every column's rows come from the same source files at the same rows.
+static bool MergeH5ReadVirtualSources(vector<H5ReadVirtualSource> &sources,
+                                      vector<H5ReadVirtualSource> column_sources) {
+	if (sources.empty()) {
+		sources = std::move(column_sources);
+		return true;
+	}
+	if (sources.size() != column_sources.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < sources.size(); i++) {
+		auto &source = sources[i];
+		auto &column_source = column_sources[i];
+		if (source.filename != column_source.filename || source.first_row != column_source.first_row ||
+		    source.num_rows != column_source.num_rows) {
+			return false;
+		}
+		for (auto &entry : column_source.dataset_paths) {
+			auto inserted = source.dataset_paths.insert(entry);
+			if (!inserted.second && inserted.first->second != entry.second) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+// Binds the columns of h5_read arguments in one file. With source_paths, the file is a source file of virtual datasets
+// and each virtual dataset path of the arguments is read from its source dataset; column names still come from the
+// arguments.
+static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, const string &filename, bool swmr,
+                                                     const vector<Value> &inputs,
+                                                     const vector<string> &range_attributes,
+                                                     const unordered_map<string, string> *source_paths = nullptr) {
+	H5ReadSingleFileBindData result;
+	result.filename = filename;
+	result.swmr = swmr;
+	size_t num_columns = inputs.size() - 1;
+
+	// Open the file before taking the lock, so that file system requests of files bound on other threads overlap.
+	// The RAII wrapper handles cleanup.
+	H5FileHandle file;
+	{
+		H5ErrorSuppressor suppress;
+		file = H5OpenFile(context, result.filename, result.swmr);
+	}
+
+	if (!file.is_valid()) {
+		throw IOException(FormatRemoteHDF5Error("Failed to open HDF5 file", result.filename));
+	}
+
+	// Lock for all HDF5 operations (not thread-safe)
+	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+
+	// Track minimum rows across all non-scalar regular columns
+	hsize_t min_rows = std::numeric_limits<hsize_t>::max();
+	size_t num_regular_columns = 0;
+	size_t non_scalar_regular_columns = 0;
+	bool has_run_encoded_columns = false;
+	// Cleared by columns that cannot be scanned from the sources of virtual datasets, see GetH5ReadVirtualSources
+	bool plan_virtual_sources = !result.swmr;
+	vector<H5ReadVirtualSource> virtual_sources;
+
+	auto set_column_range = [&](std::optional<H5ReadColumnRange> range) {
+		if (range) {
+			result.column_ranges.resize(result.columns.size());
+			result.column_ranges.back() = std::move(range);
+		}
+	};
+
+	// Process each column (regular dataset, run-encoded, or index)
+	for (size_t i = 0; i < num_columns; i++) {
+		const auto &input_val = inputs[i + 1];
+		std::optional<std::string> alias_name;
+		Value column_val = UnwrapAliasSpec(input_val, alias_name);
+
+		// h5_slice() wraps a regular dataset path together with the selection of its inner dimensions
+		std::optional<Value> slice_val;
+		if (IsSliceStructType(column_val.type())) {
+			auto &children = StructValue::GetChildren(column_val);
+			if (children[0].GetValue<string>() != "__slice__") {
+				throw InvalidInputException("Unknown struct argument for h5_read");
+			}
+			slice_val = children[2];
+			column_val = children[1];
+		}
+
+		// Check for virtual index or run-encoded column (STRUCT type)
+		if (column_val.type().id() == LogicalTypeId::STRUCT) {
+			auto &children = StructValue::GetChildren(column_val);
+
+			if (IsIndexStructType(column_val.type())) {
+				auto tag = children[0].GetValue<string>();
+				if (tag != "__index__" && tag != "__global_index__") {
+					throw InvalidInputException("Unknown struct argument for h5_read");
+				}
+
+				IndexColumnSpec index_spec;
+				index_spec.column_name = alias_name ? *alias_name : "index";
+				index_spec.column_type = LogicalType::BIGINT;
+				index_spec.global = tag == "__global_index__";
+
+				result.columns.push_back(std::move(index_spec));
+				continue;
 			}
 
 			// Run-encoded column - extract struct fields
@@ -1010,6 +2283,7 @@ static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, con
 			encoded_spec.values_path = values;
 			encoded_spec.column_name = alias_name ? *alias_name : GetColumnName(values);
 			has_run_encoded_columns = true;
+			plan_virtual_sources = false;
 
 			// Open boundary dataset and get type
 			auto [boundaries_ds, boundaries_type] = OpenDatasetAndGetType(file, result.filename, boundaries);
@@ -1023,25 +2297,41 @@ static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, con
 			auto [values_ds, values_type] = OpenDatasetAndGetType(file, result.filename, values);
 			// Determine DuckDB column type from values (before move)
 			encoded_spec.column_type = H5TypeToDuckDBType(values_type);
+			std::optional<H5ReadColumnRange> values_range;
 			if (H5Tget_class(values_type) == H5T_STRING) {
 				encoded_spec.values_string_h5_type = std::move(values_type);
+			} else if (encoded_spec.column_type.IsNumeric()) {
+				values_range = ReadH5RunValuesRange(values_ds, values_type, encoded_spec.column_type);
 			}
 
 			result.columns.push_back(std::move(encoded_spec));
+			set_column_range(std::move(values_range));
 
 		} else {
 			// Regular column (may be scalar)
 			if (column_val.type().id() != LogicalTypeId::VARCHAR) {
 				throw InvalidInputException("h5_read dataset path arguments must be VARCHAR, h5_rse(), h5_ree(), "
-				                            "h5_index(), or h5_alias(...)");
+				                            "h5_index(), h5_slice(), or h5_alias(...)");
 			}
 			RegularColumnSpec ds_info;
 			ds_info.path = GetRequiredStringArgument(column_val, "h5_read", "dataset path");
 			ds_info.column_name = alias_name ? *alias_name : GetColumnName(ds_info.path);
 			num_regular_columns++;
+			if (source_paths) {
+				auto source_path = source_paths->find(ds_info.path);
+				if (source_path != source_paths->end()) {
+					ds_info.path = source_path->second;
+				}
+			}
 
 			// Open dataset and get type
 			auto [dataset, type] = OpenDatasetAndGetType(file, result.filename, ds_info.path);
+			if (result.swmr) {
+				// HDF5 shares an open file between handles, so a file another handle of this process still holds
+				// open keeps its old extent until the dataset is refreshed.
+				H5ErrorSuppressor suppress;
+				H5Drefresh(dataset);
+			}
 
 			// Check if it's a string type
 			ds_info.is_string = (H5Tget_class(type) == H5T_STRING);
@@ -1059,13 +2349,24 @@ static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, con
 			}
 
 			if (space_class == H5S_SCALAR || space_class == H5S_NULL) {
+				if (slice_val) {
+					throw IOException(FormatDatasetError("h5_slice() cannot be applied to scalar dataset",
+					                                     result.filename, ds_info.path));
+				}
 				// Null dataspaces use scalar row and broadcast semantics with a NULL value.
 				ScalarColumnSpec scalar_info;
 				scalar_info.path = ds_info.path;
 				scalar_info.column_name = ds_info.column_name;
 				scalar_info.is_null_dataspace = space_class == H5S_NULL;
+				plan_virtual_sources = false;
 
-				scalar_info.column_type = H5TypeToDuckDBType(type);
+				if (H5Tget_class(type) == H5T_ENUM) {
+					auto enum_type = CreateH5ReadEnumType(type, result.filename, ds_info.path);
+					scalar_info.column_type = enum_type.column_type;
+					scalar_info.enum_read_type = std::move(enum_type.read_type);
+				} else {
+					scalar_info.column_type = H5TypeToDuckDBType(type);
+				}
 				if (ds_info.is_string && !scalar_info.is_null_dataspace) {
 					scalar_info.string_h5_type = std::move(type);
 				}
@@ -1090,6 +2391,15 @@ static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, con
 
 			ds_info.dims.resize(ds_info.ndims);
 			H5Sget_simple_extent_dims(space, ds_info.dims.data(), nullptr);
+			ds_info.stored_dims = ds_info.dims;
+			if (plan_virtual_sources) {
+				auto column_sources = GetH5ReadVirtualSources(dataset, ds_info, result.filename);
+				plan_virtual_sources =
+				    column_sources && MergeH5ReadVirtualSources(virtual_sources, std::move(*column_sources));
+			}
+			if (slice_val) {
+				ApplyH5ReadSlice(ds_info, *slice_val, result.filename);
+			}
 
 			// Track minimum rows for non-scalar regular columns
 			non_scalar_regular_columns++;
@@ -1097,37 +2407,33 @@ static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, con
 				min_rows = ds_info.dims[0];
 			}
 
-			// Map HDF5 type to DuckDB type
-			LogicalType base_type = H5TypeToDuckDBType(type);
-
-			// Calculate DuckDB output bytes/elements for this column in one scan row.
-			// This intentionally uses the DuckDB/native memory size, not the file size:
-			// e.g. HDF5 float16 values are widened into DuckDB FLOAT values.
-			ds_info.output_bytes_per_row = ds_info.is_string ? 0 : H5ReadNumericOutputElementSize(base_type);
-			ds_info.elements_per_row = 1;
-			for (int j = 1; j < ds_info.ndims; j++) {
-				auto dimension = static_cast<idx_t>(ds_info.dims[j]);
-				ds_info.output_bytes_per_row =
-				    CheckedDatasetSizeProduct(ds_info.output_bytes_per_row, dimension, result.filename, ds_info.path);
-				ds_info.elements_per_row =
-				    CheckedDatasetSizeProduct(ds_info.elements_per_row, dimension, result.filename, ds_info.path);
+			if (H5Tget_class(type) == H5T_COMPOUND) {
+				AppendCompoundFieldColumns(ds_info, type, alias_name, result.filename, result.columns);
+				continue;
 			}
-			auto uses_nested_lists =
-			    ds_info.ndims > 1 && ds_info.output_bytes_per_row >= H5_READ_WIDE_ROW_THRESHOLD_BYTES;
 
+			// Map HDF5 type to DuckDB type. Enum datasets become ENUM columns read as their codes.
+			if (H5Tget_class(type) == H5T_ENUM) {
+				auto enum_type = CreateH5ReadEnumType(type, result.filename, ds_info.path);
+				SetRegularColumnType(ds_info, enum_type.column_type, result.filename);
+				ds_info.enum_read_type = std::move(enum_type.read_type);
+			} else {
+				SetRegularColumnType(ds_info, H5TypeToDuckDBType(type), result.filename);
+			}
 			if (ds_info.is_string) {
 				// Preserve file-local string metadata for runtime string decoding.
 				ds_info.string_h5_type = std::move(type);
 			}
-
-			// Fixed ARRAY vectors eagerly allocate STANDARD_VECTOR_SIZE rows. Use nested
-			// LIST vectors for wide rows so allocation follows the actual scan batch.
-			ds_info.column_type = BuildCollectionType(base_type, ds_info.dims, ds_info.ndims, uses_nested_lists,
-			                                          result.filename, ds_info.path);
+			std::optional<H5ReadColumnRange> attribute_range;
+			if (!range_attributes.empty() && ds_info.ndims == 1 && ds_info.column_type.IsNumeric()) {
+				attribute_range = ReadH5RangeAttributes(dataset, range_attributes, ds_info.column_type);
+			}
 
 			result.columns.push_back(std::move(ds_info));
+			set_column_range(std::move(attribute_range));
 		}
 	}
+	result.column_ranges.resize(result.columns.size());
 
 	// Require at least one regular column (scalar or non-scalar)
 	if (num_regular_columns == 0) {
@@ -1148,10 +2454,133 @@ static H5ReadSingleFileBindData BindSingleH5ReadFile(ClientContext &context, con
 		// Only scalar datasets - return a single row
 		result.num_rows = 1;
 	}
+	if (plan_virtual_sources) {
+		result.virtual_sources = std::move(virtual_sources);
+	}
 
 	return result;
 }
 
+static std::optional<H5TypeHandle> CopyOptionalTypeHandle(const std::optional<H5TypeHandle> &type) {
+	if (!type) {
+		return std::nullopt;
+	}
+	return H5TypeHandle(type->get());
+}
+
+// Deep copy of a file's bind data. Column specs own HDF5 type handles, which are copied with H5Tcopy.
+static H5ReadSingleFileBindData CopyH5ReadSingleFileBindData(const H5ReadSingleFileBindData &source) {
+	H5ReadSingleFileBindData result;
+	result.filename = source.filename;
+	result.num_rows = source.num_rows;
+	result.swmr = source.swmr;
+	result.column_ranges = source.column_ranges;
+	result.virtual_sources = source.virtual_sources;
+	result.virtual_block = source.virtual_block;
+	result.columns.reserve(source.columns.size());
+	for (const auto &column : source.columns) {
+		std::visit(
+		    [&](auto &&spec) {
+			    using T = std::decay_t<decltype(spec)>;
+			    if constexpr (std::is_same_v<T, RegularColumnSpec>) {
+				    RegularColumnSpec copy;
+				    copy.path = spec.path;
+				    copy.column_name = spec.column_name;
+				    copy.column_type = spec.column_type;
+				    copy.is_string = spec.is_string;
+				    copy.string_h5_type = CopyOptionalTypeHandle(spec.string_h5_type);
+				    copy.compound_member = spec.compound_member;
+				    copy.compound_read_type = CopyOptionalTypeHandle(spec.compound_read_type);
+				    copy.enum_read_type = CopyOptionalTypeHandle(spec.enum_read_type);
+				    copy.ndims = spec.ndims;
+				    copy.dims = spec.dims;
+				    copy.slice_start = spec.slice_start;
+				    copy.slice_stride = spec.slice_stride;
+				    copy.stored_dims = spec.stored_dims;
+				    copy.member_dims = spec.member_dims;
+				    copy.output_bytes_per_row = spec.output_bytes_per_row;
+				    copy.elements_per_row = spec.elements_per_row;
+				    result.columns.push_back(std::move(copy));
+			    } else if constexpr (std::is_same_v<T, ScalarColumnSpec>) {
+				    ScalarColumnSpec copy;
+				    copy.path = spec.path;
+				    copy.column_name = spec.column_name;
+				    copy.column_type = spec.column_type;
+				    copy.is_null_dataspace = spec.is_null_dataspace;
+				    copy.string_h5_type = CopyOptionalTypeHandle(spec.string_h5_type);
+				    copy.enum_read_type = CopyOptionalTypeHandle(spec.enum_read_type);
+				    result.columns.push_back(std::move(copy));
+			    } else if constexpr (std::is_same_v<T, RunEncodedColumnSpec>) {
+				    RunEncodedColumnSpec copy;
+				    copy.encoding = spec.encoding;
+				    copy.boundaries_path = spec.boundaries_path;
+				    copy.values_path = spec.values_path;
+				    copy.column_name = spec.column_name;
+				    copy.column_type = spec.column_type;
+				    copy.values_string_h5_type = CopyOptionalTypeHandle(spec.values_string_h5_type);
+				    result.columns.push_back(std::move(copy));
+			    } else if constexpr (std::is_same_v<T, IndexColumnSpec>) {
+				    result.columns.push_back(spec);
+			    }
+		    },
+		    column);
+	}
+	return result;
+}
+
+// Bind-time schema of one file, kept next to its cached handle across queries.
+struct H5ReadCachedBindData : public H5FileCacheMetadata {
+	H5ReadSingleFileBindData bind_data;
+};
+
+// The bind result depends only on the file, the column arguments, h5db_range_attributes, and the source dataset
+// paths a virtual datasets' source file is bound with.
+static string H5ReadBindCacheKey(const vector<Value> &inputs, const vector<string> &range_attributes,
+                                 const unordered_map<string, string> *source_paths) {
+	string key = "h5_read";
+	for (idx_t i = 1; i < inputs.size(); i++) {
+		key += '\0';
+		key += inputs[i].type().ToString();
+		key += '\0';
+		key += inputs[i].ToSQLString();
+	}
+	for (auto &name : range_attributes) {
+		key += '\0';
+		key += name;
+	}
+	if (source_paths) {
+		key += '\0';
+		key += "virtual";
+		std::map<string, string> sorted_paths(source_paths->begin(), source_paths->end());
+		for (auto &entry : sorted_paths) {
+			key += '\0';
+			key += entry.first;
+			key += '\0';
+			key += entry.second;
+		}
+	}
+	return key;
+}
+
+// BindSingleH5ReadFile with the schema served from the file cache when it is enabled and the file is unchanged.
+static H5ReadSingleFileBindData
+BindSingleH5ReadFileCached(ClientContext &context, const string &filename, bool swmr, const vector<Value> &inputs,
+                           const unordered_map<string, string> *source_paths = nullptr) {
+	auto range_attributes = ResolveRangeAttributesOption(context);
+	if (swmr || ResolveFileCacheSizeOption(context) == 0) {
+		return BindSingleH5ReadFile(context, filename, swmr, inputs, range_attributes, source_paths);
+	}
+	auto key = H5ReadBindCacheKey(inputs, range_attributes, source_paths);
+	if (auto cached = H5FileCacheGetMetadata(context, filename, swmr, key)) {
+		return CopyH5ReadSingleFileBindData(static_cast<H5ReadCachedBindData &>(*cached).bind_data);
+	}
+	auto result = BindSingleH5ReadFile(context, filename, swmr, inputs, range_attributes, source_paths);
+	auto cached = make_shared_ptr<H5ReadCachedBindData>();
+	cached->bind_data = CopyH5ReadSingleFileBindData(result);
+	H5FileCacheSetMetadata(context, filename, swmr, key, std::move(cached));
+	return result;
+}
+
 static bool H5ReadSchemasMatch(const H5ReadSingleFileBindData &expected, const H5ReadSingleFileBindData &actual) {
 	if (expected.columns.size() != actual.columns.size()) {
 		return false;
@@ -1176,9 +2605,11 @@ static bool H5ReadSchemasMatch(const H5ReadSingleFileBindData &expected, const H
 					    // LIST types do not encode their extents. Preserve the previous
 					    // multi-file requirement that inner dataset shapes match.
 					    if (matches && expected_spec.column_type.id() == LogicalTypeId::LIST) {
+						    auto expected_shape = expected_spec.ValueShape();
+						    auto actual_shape = actual_spec.ValueShape();
 						    matches = expected_spec.ndims == actual_spec.ndims &&
-						              std::equal(expected_spec.dims.begin() + 1, expected_spec.dims.end(),
-						                         actual_spec.dims.begin() + 1, actual_spec.dims.end());
+						              std::equal(expected_shape.begin() + 1, expected_shape.end(),
+						                         actual_shape.begin() + 1, actual_shape.end());
 					    }
 				    }
 				    if constexpr (std::is_same_v<ExpectedT, RunEncodedColumnSpec>) {
@@ -1194,11 +2625,46 @@ static bool H5ReadSchemasMatch(const H5ReadSingleFileBindData &expected, const H
 	return true;
 }
 
+static bool H5ReadHasIndexColumns(const vector<ColumnSpec> &columns) {
+	for (const auto &column : columns) {
+		if (std::holds_alternative<IndexColumnSpec>(column)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 static const vector<ColumnSpec> &GetCanonicalColumns(const H5ReadBindData &bind_data) {
 	D_ASSERT(!bind_data.file_bind_data.empty());
 	return bind_data.file_bind_data[0].columns;
 }
 
+// The file a bind entry's rows belong to for the filename column and since := ...: the virtual datasets' file for
+// entries that scan one of its sources.
+static const string &H5ReadOutputFilename(const H5ReadSingleFileBindData &file_bind_data) {
+	return file_bind_data.virtual_block ? file_bind_data.virtual_block->filename : file_bind_data.filename;
+}
+
+// Rows of a bind entry that earlier scans returned (since := ...) and the scan skips.
+static idx_t H5ReadSinceFirstRow(const H5ReadBindData &bind_data, const H5ReadSingleFileBindData &file_bind_data) {
+	auto first_row = bind_data.since.FirstRow(H5ReadOutputFilename(file_bind_data));
+	if (!file_bind_data.virtual_block) {
+		return first_row;
+	}
+	auto block_first_row = file_bind_data.virtual_block->first_row;
+	return first_row > block_first_row ? first_row - block_first_row : 0;
+}
+
+// Per-file h5_index() of a bind entry's first row, and the rows per-file indexes number: the rows of the virtual
+// datasets for entries that scan one of their sources.
+static idx_t H5ReadFileIndexBase(const H5ReadSingleFileBindData &file_bind_data) {
+	return file_bind_data.virtual_block ? file_bind_data.virtual_block->first_row : 0;
+}
+
+static idx_t H5ReadFileIndexRows(const H5ReadSingleFileBindData &file_bind_data) {
+	return file_bind_data.virtual_block ? file_bind_data.virtual_block->num_rows : file_bind_data.num_rows;
+}
+
 static idx_t EstimateScanBatchSize(const vector<ColumnSpec> &columns, const vector<column_t> &data_column_ids,
                                    idx_t target_batch_size_bytes) {
 	D_ASSERT(target_batch_size_bytes > 0);
@@ -1220,11 +2686,214 @@ static idx_t EstimateScanBatchSize(const vector<ColumnSpec> &columns, const vect
 	return MinValue<idx_t>(target_batch_size_bytes / estimated_output_bytes_per_row, STANDARD_VECTOR_SIZE);
 }
 
-static H5ReadSingleFileBindView GetSingleFileBindView(const H5ReadBindData &bind_data, idx_t file_idx) {
+// lazy_bind_data is the schema a lazily bound file got when the scan opened it, see H5ReadGlobalState.
+static H5ReadSingleFileBindView GetSingleFileBindView(const H5ReadBindData &bind_data, idx_t file_idx,
+                                                      const H5ReadSingleFileBindData *lazy_bind_data = nullptr) {
 	D_ASSERT(file_idx < bind_data.file_bind_data.size());
-	auto &file_bind_data = bind_data.file_bind_data[file_idx];
-	return {file_bind_data.filename, file_bind_data.columns, file_bind_data.num_rows, bind_data.claimed_filters,
-	        file_bind_data.swmr};
+	auto &file_bind_data = lazy_bind_data ? *lazy_bind_data : bind_data.file_bind_data[file_idx];
+	D_ASSERT(file_bind_data.bound);
+	return {file_bind_data.filename,
+	        file_bind_data.columns,
+	        file_bind_data.num_rows,
+	        bind_data.claimed_filters,
+	        file_bind_data.swmr,
+	        bind_data.file_row_base[file_idx],
+	        H5ReadSinceFirstRow(bind_data, file_bind_data),
+	        H5ReadFileIndexBase(file_bind_data)};
+}
+
+// Calls bind_file(i) for every i in [0, file_count), which binds the i-th file and returns false when it does not
+// match the expected schema. Bind threads claim files from a shared counter and stop at the first failure; HDF5
+// calls stay serialized on hdf5_global_mutex, so they overlap only in the work outside it (file cache stat calls and
+// remote backend connection setup). Returns the error of every file that threw.
+static vector<std::exception_ptr> BindH5ReadFilesInParallel(ClientContext &context, idx_t file_count,
+                                                            const std::function<bool(idx_t)> &bind_file) {
+	vector<std::exception_ptr> errors(file_count);
+	std::atomic<idx_t> next_file {0};
+	std::atomic<bool> failed {false};
+	// Files bound while a scan runs (lazily bound files, virtual dataset sources) count towards that scan.
+	auto stats = H5CurrentScanStats();
+	auto bind_files = [&]() {
+		unique_ptr<H5ScanStatsScope> stats_scope;
+		if (stats) {
+			stats_scope = make_uniq<H5ScanStatsScope>(stats);
+		}
+		while (!failed.load(std::memory_order_relaxed)) {
+			auto i = next_file.fetch_add(1);
+			if (i >= file_count) {
+				return;
+			}
+			try {
+				ThrowIfInterrupted(context);
+				if (!bind_file(i)) {
+					failed = true;
+				}
+			} catch (...) {
+				errors[i] = std::current_exception();
+				failed = true;
+			}
+		}
+	};
+
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	thread_count = MinValue<idx_t>(MaxValue<idx_t>(thread_count, 1), file_count);
+	vector<std::future<void>> workers;
+	for (idx_t i = 1; i < thread_count; i++) {
+		try {
+			workers.push_back(std::async(std::launch::async, bind_files));
+		} catch (std::exception &) {
+			// Binding continues on the threads that did start.
+			break;
+		}
+	}
+	bind_files();
+	for (auto &worker : workers) {
+		worker.wait();
+	}
+	return errors;
+}
+
+// Binds files [begin, end) of filenames and checks them against the schema of expected. Errors are reported for the
+// first failing file in file order, like a sequential bind.
+static vector<H5ReadSingleFileBindData> BindH5ReadFiles(ClientContext &context, const vector<string> &filenames,
+                                                        idx_t begin, idx_t end, bool swmr, const vector<Value> &inputs,
+                                                        const H5ReadSingleFileBindData &expected) {
+	D_ASSERT(begin <= end);
+	const auto file_count = end - begin;
+	vector<std::optional<H5ReadSingleFileBindData>> results(file_count);
+	auto errors = BindH5ReadFilesInParallel(context, file_count, [&](idx_t i) {
+		results[i].emplace(BindSingleH5ReadFileCached(context, filenames[begin + i], swmr, inputs));
+		return H5ReadSchemasMatch(expected, *results[i]);
+	});
+
+	// Files are claimed in order, so every file before the first failing one was bound.
+	vector<H5ReadSingleFileBindData> result;
+	result.reserve(file_count);
+	for (idx_t i = 0; i < file_count; i++) {
+		if (errors[i]) {
+			std::rethrow_exception(errors[i]);
+		}
+		D_ASSERT(results[i]);
+		if (!H5ReadSchemasMatch(expected, *results[i])) {
+			throw BinderException("h5_read matched file '%s' with an incompatible schema", filenames[begin + i]);
+		}
+		result.push_back(std::move(*results[i]));
+	}
+	return result;
+}
+
+// Binds the sources of a file's virtual datasets, to scan them in place of the file. Each source is one more file to
+// the scan, so sources are read concurrently (h5db_max_files_in_flight) with chunks decoded and contiguous rows read
+// outside H5Dread, and index filters and LIMITs skip whole sources. Returns nothing when a source cannot be opened,
+// or does not hold the rows its mapping names with the file's column types, which leaves the file to be read through
+// its virtual datasets.
+static std::optional<vector<H5ReadSingleFileBindData>>
+BindH5ReadVirtualSources(ClientContext &context, const H5ReadSingleFileBindData &file_bind,
+                         const vector<Value> &inputs) {
+	auto &sources = file_bind.virtual_sources;
+	vector<std::optional<H5ReadSingleFileBindData>> results(sources.size());
+	auto errors = BindH5ReadFilesInParallel(context, sources.size(), [&](idx_t i) {
+		auto &source = sources[i];
+		try {
+			results[i].emplace(
+			    BindSingleH5ReadFileCached(context, source.filename, false, inputs, &source.dataset_paths));
+		} catch (IOException &) {
+			return false;
+		} catch (InvalidInputException &) {
+			return false;
+		}
+		if (results[i]->num_rows != source.num_rows || !H5ReadSchemasMatch(file_bind, *results[i])) {
+			results[i].reset();
+			return false;
+		}
+		return true;
+	});
+
+	vector<H5ReadSingleFileBindData> result;
+	result.reserve(sources.size());
+	for (idx_t i = 0; i < sources.size(); i++) {
+		if (errors[i]) {
+			std::rethrow_exception(errors[i]);
+		}
+		if (!results[i]) {
+			return std::nullopt;
+		}
+		H5ReadVirtualBlock block;
+		block.filename = file_bind.filename;
+		block.first_row = sources[i].first_row;
+		block.num_rows = file_bind.num_rows;
+		results[i]->virtual_block = std::move(block);
+		result.push_back(std::move(*results[i]));
+	}
+	return result;
+}
+
+// Appends a bound file to the bind data, replaced by the sources of its virtual datasets when h5db_virtual_sources
+// allows scanning them in its place.
+static void AppendH5ReadBoundFile(ClientContext &context, H5ReadBindData &bind_data,
+                                  H5ReadSingleFileBindData file_bind) {
+	std::optional<vector<H5ReadSingleFileBindData>> entries;
+	if (!file_bind.virtual_sources.empty() && ResolveVirtualSourcesOption(context)) {
+		entries = BindH5ReadVirtualSources(context, file_bind, bind_data.inputs);
+	}
+	if (!entries) {
+		entries.emplace();
+		entries->push_back(std::move(file_bind));
+	}
+	for (auto &entry : *entries) {
+		bind_data.file_row_base.push_back(bind_data.total_num_rows);
+		bind_data.total_num_rows += entry.num_rows;
+		bind_data.file_bind_data.push_back(std::move(entry));
+	}
+}
+
+// Binds a file h5db_bind_sample_files left to the scan, with the same checks bind applies to the other files.
+static H5ReadSingleFileBindData BindLazyH5ReadFile(ClientContext &context, const H5ReadBindData &bind_data,
+                                                   idx_t file_idx) {
+	auto &placeholder = bind_data.file_bind_data[file_idx];
+	D_ASSERT(!placeholder.bound);
+	auto result = BindSingleH5ReadFileCached(context, placeholder.filename, placeholder.swmr, bind_data.inputs);
+	if (!H5ReadSchemasMatch(bind_data.file_bind_data[0], result)) {
+		throw InvalidInputException("h5_read matched file '%s' with an incompatible schema", placeholder.filename);
+	}
+	H5RecordScanStat(H5ScanCounter::FILES_BOUND_AT_SCAN);
+	return result;
+}
+
+// Parse one since := row count, either the whole argument or a MAP value.
+static idx_t ParseH5ReadSinceRowCount(const Value &value) {
+	Value row_count;
+	string error_message;
+	if (value.IsNull() || !value.DefaultTryCastAs(LogicalType::UBIGINT, row_count, &error_message)) {
+		throw InvalidInputException("h5_read since must be a row count or a MAP from filename to row count, got %s",
+		                            value.ToString());
+	}
+	return row_count.GetValue<uint64_t>();
+}
+
+// Resolve since := into a row count for all files or a per-filename MAP.
+static H5ReadSinceOption ResolveH5ReadSinceOption(const named_parameter_map_t &named_parameters) {
+	H5ReadSinceOption result;
+	auto it = named_parameters.find("since");
+	if (it == named_parameters.end()) {
+		return result;
+	}
+	auto &value = it->second;
+	if (value.IsNull()) {
+		throw InvalidInputException("Cannot use NULL as argument for \"since\"");
+	}
+	if (value.type().id() != LogicalTypeId::MAP) {
+		result.all_files = ParseH5ReadSinceRowCount(value);
+		return result;
+	}
+	for (auto &entry : MapValue::GetChildren(value)) {
+		auto &key_value = StructValue::GetChildren(entry);
+		if (key_value[0].IsNull()) {
+			throw InvalidInputException("h5_read since MAP keys must be filenames, got NULL");
+		}
+		result.by_file[key_value[0].ToString()] = ParseH5ReadSinceRowCount(key_value[1]);
+	}
+	return result;
 }
 
 // Bind function - expands glob patterns, validates schema, and records per-file row counts.
@@ -1233,10 +2902,11 @@ static unique_ptr<FunctionData> H5ReadBind(ClientContext &context, TableFunction
 	ThrowIfInterrupted(context);
 	auto swmr = ResolveSwmrOption(context, input.named_parameters);
 	auto filename_option = ResolveFilenameColumnOption(input.named_parameters);
+	auto since = ResolveH5ReadSinceOption(input.named_parameters);
 	auto expanded = H5ExpandFilePatterns(context, input.inputs[0], "h5_read");
 	D_ASSERT(!expanded.filenames.empty());
 
-	auto first_file_bind = BindSingleH5ReadFile(context, expanded.filenames[0], swmr, input.inputs);
+	auto first_file_bind = BindSingleH5ReadFileCached(context, expanded.filenames[0], swmr, input.inputs);
 	PopulateH5ReadOutputSchema(first_file_bind.columns, return_types, names);
 	if (filename_option.include) {
 		if (H5ReadOutputHasColumnName(names, filename_option.column_name)) {
@@ -1252,23 +2922,53 @@ static unique_ptr<FunctionData> H5ReadBind(ClientContext &context, TableFunction
 	if (filename_option.include) {
 		result->visible_filename_idx = names.size() - 1;
 	}
-	result->file_bind_data.reserve(expanded.filenames.size());
-	result->total_num_rows = first_file_bind.num_rows;
-	result->file_bind_data.push_back(std::move(first_file_bind));
+	const auto file_count = expanded.filenames.size();
+	result->inputs = input.inputs;
+	result->since = std::move(since);
+	result->file_bind_data.reserve(file_count);
+	result->file_row_base.reserve(file_count);
+	AppendH5ReadBoundFile(context, *result, std::move(first_file_bind));
+
+	// With h5db_bind_sample_files, only the first files are bound here and the others when the scan opens them.
+	// Index columns number rows by the row counts of every file, so they need all files bound up front.
+	auto bound_file_count = file_count;
+	auto sample_files = ResolveBindSampleFilesOption(context);
+	if (sample_files > 0 && !H5ReadHasIndexColumns(result->file_bind_data[0].columns)) {
+		bound_file_count = MinValue<idx_t>(sample_files, file_count);
+	}
 
-	for (idx_t file_idx = 1; file_idx < expanded.filenames.size(); file_idx++) {
-		auto file_bind = BindSingleH5ReadFile(context, expanded.filenames[file_idx], swmr, input.inputs);
-		if (!H5ReadSchemasMatch(result->file_bind_data[0], file_bind)) {
-			throw BinderException("h5_read matched file '%s' with an incompatible schema",
-			                      expanded.filenames[file_idx]);
-		}
-		result->total_num_rows += file_bind.num_rows;
-		result->file_bind_data.push_back(std::move(file_bind));
+	auto file_binds = BindH5ReadFiles(context, expanded.filenames, 1, bound_file_count, swmr, input.inputs,
+	                                  result->file_bind_data[0]);
+	for (auto &file_bind : file_binds) {
+		AppendH5ReadBoundFile(context, *result, std::move(file_bind));
+	}
+	for (idx_t file_idx = bound_file_count; file_idx < file_count; file_idx++) {
+		H5ReadSingleFileBindData placeholder;
+		placeholder.filename = expanded.filenames[file_idx];
+		placeholder.num_rows = 0;
+		placeholder.swmr = swmr;
+		placeholder.bound = false;
+		result->file_row_base.push_back(result->total_num_rows);
+		result->file_bind_data.push_back(std::move(placeholder));
+	}
+	if (bound_file_count < file_count) {
+		// Cardinality estimate: the unbound files are assumed to hold as many rows as the bound ones on average.
+		auto rows_per_file = static_cast<double>(result->total_num_rows) / static_cast<double>(bound_file_count);
+		result->total_num_rows = static_cast<hsize_t>(rows_per_file * static_cast<double>(file_count));
 	}
 
 	return result;
 }
 
+// Rows [first_row, num_rows) of a file, before any filter is applied. first_row skips the rows earlier scans
+// returned (since := ...); a file that shrank below it has no rows to scan.
+static vector<RowRange> InitialRowRanges(idx_t first_row, idx_t num_rows) {
+	if (first_row >= num_rows) {
+		return {};
+	}
+	return {{first_row, num_rows}};
+}
+
 // Helper: Intersect two sorted lists of row ranges
 static vector<RowRange> IntersectRowRanges(const vector<RowRange> &a, const vector<RowRange> &b) {
 	vector<RowRange> result;
@@ -1278,35 +2978,161 @@ static vector<RowRange> IntersectRowRanges(const vector<RowRange> &a, const vect
 		idx_t start = std::max(a[i].start_row, b[j].start_row);
 		idx_t end = std::min(a[i].end_row, b[j].end_row);
 
-		// If ranges overlap, add the intersection
-		if (start < end) {
-			result.push_back({start, end});
-		}
+		// If ranges overlap, add the intersection
+		if (start < end) {
+			result.push_back({start, end});
+		}
+
+		// Advance the range that ends earlier
+		if (a[i].end_row < b[j].end_row) {
+			i++;
+		} else {
+			j++;
+		}
+	}
+
+	return result;
+}
+
+static vector<RowRange> BuildRangesForColumn(GlobalColumnIdx global_idx, const vector<ClaimedFilter> &col_filters,
+                                             const H5ReadSingleFileBindView &bind_data,
+                                             const H5ReadGlobalState &gstate) {
+	if (std::holds_alternative<RunEncodedColumnSpec>(bind_data.columns[global_idx])) {
+		LocalColumnIdx local_idx = GlobalToLocal(gstate, global_idx);
+		auto &encoded_spec = std::get<RunEncodedColumnSpec>(bind_data.columns[global_idx]);
+		auto &encoded_state = std::get<RunEncodedColumnState>(gstate.column_states[local_idx]);
+		return BuildRangesForRunEncodedColumn(bind_data.filename, encoded_spec, encoded_state, col_filters);
+	}
+	if (auto index_spec = std::get_if<IndexColumnSpec>(&bind_data.columns[global_idx])) {
+		auto row_base = index_spec->global ? bind_data.row_base : bind_data.index_base;
+		return BuildIndexRanges(col_filters, row_base, bind_data.num_rows);
+	}
+	if (std::holds_alternative<RegularColumnSpec>(bind_data.columns[global_idx])) {
+		// Regular columns are claimed for zone-map pruning and late materialization, which filters the rows
+		// read rather than the ranges scanned; without a zone map every row stays valid.
+		auto it = gstate.global_to_local.find(global_idx.index);
+		if (it == gstate.global_to_local.end()) {
+			return {{0, bind_data.num_rows}};
+		}
+		auto &regular_state = std::get<RegularColumnState>(gstate.column_states[it->second]);
+		if (!regular_state.zone_map) {
+			return {{0, bind_data.num_rows}};
+		}
+		return BuildRangesForZoneMap(*regular_state.zone_map, col_filters, bind_data.num_rows);
+	}
+	return {};
+}
+
+// Logical partitions are a few scan batches long, but small enough that every thread can own a
+// partition inside one cache window; otherwise threads would keep evicting each other's windows.
+static idx_t ComputePartitionRows(ClientContext &context, const H5ReadGlobalState &gstate) {
+	const auto batch_rows = MaxValue<idx_t>(gstate.scan_batch_size, 1);
+	auto partition_rows = batch_rows * H5_READ_PARTITION_SCAN_BATCHES;
+	auto thread_count = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	thread_count = MaxValue<idx_t>(thread_count, 1);
+	for (const auto &col_state : gstate.column_states) {
+		auto regular = std::get_if<RegularColumnState>(&col_state);
+		if (regular && regular->cache) {
+			partition_rows = MinValue<idx_t>(partition_rows, regular->cache->window_rows / thread_count);
+		}
+	}
+	return MaxValue<idx_t>(partition_rows / batch_rows * batch_rows, batch_rows);
+}
+
+// Sets up contiguous-direct reads for a column when its dataset qualifies, opening the file through DuckDB's file
+// system the first time a column needs it. Caller must hold hdf5_global_mutex.
+static void TryEnableContiguousDirect(ClientContext &context, H5ReadGlobalState &gstate, RegularColumnState &state,
+                                      const RegularColumnSpec &spec, hid_t read_type, const string &filename,
+                                      bool &file_attempted) {
+	auto layout = H5ContiguousDirectTryGetLayout(gstate.file.get(), state.dataset.get(), read_type, spec.dims);
+	if (!layout) {
+		return;
+	}
+	if (!file_attempted) {
+		file_attempted = true;
+		try {
+			auto &fs = FileSystem::GetFileSystem(context);
+			gstate.direct_file =
+			    fs.OpenFile(filename, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		} catch (std::exception &) {
+			// Paths DuckDB's file system cannot open keep using H5Dread.
+			gstate.direct_file.reset();
+		}
+	}
+	if (!gstate.direct_file) {
+		return;
+	}
+	auto end = layout->address + layout->row_bytes * spec.dims[0];
+	if (end > static_cast<idx_t>(gstate.direct_file->GetFileSize())) {
+		return;
+	}
+	state.contiguous_direct = layout;
+}
+
+static bool IsLateMaterializedColumn(const H5ReadGlobalState &gstate, LocalColumnIdx local_idx) {
+	auto regular = std::get_if<RegularColumnState>(&gstate.column_states[local_idx]);
+	return regular && regular->late_materialized;
+}
 
-		// Advance the range that ends earlier
-		if (a[i].end_row < b[j].end_row) {
-			i++;
-		} else {
-			j++;
+// Collects the claimed filters on scanned regular columns once the file's columns are set up. Returns no filters when
+// no column ended up late-materialized, so scans keep their single pass.
+static vector<H5ReadLateFilter> BuildLateFilters(const H5ReadSingleFileBindView &bind_data,
+                                                 const H5ReadGlobalState &gstate) {
+	vector<H5ReadLateFilter> result;
+	bool any_late = false;
+	for (idx_t i = 0; i < GetNumScannedColumns(gstate); i++) {
+		any_late |= IsLateMaterializedColumn(gstate, LocalColumnIdx(i));
+	}
+	if (!any_late) {
+		return result;
+	}
+	for (const auto &filter : bind_data.claimed_filters) {
+		auto it = gstate.global_to_local.find(filter.column_index);
+		if (it == gstate.global_to_local.end()) {
+			continue;
 		}
+		auto spec = std::get_if<RegularColumnSpec>(&bind_data.columns[filter.column_index]);
+		if (!spec || spec->ndims != 1 || !spec->member_dims.empty()) {
+			continue;
+		}
+		H5ReadLateFilter late_filter;
+		late_filter.local_idx = LocalColumnIdx(it->second);
+		late_filter.filter = filter;
+		if (filter.comparison_type == spec->column_type) {
+			late_filter.typed = late_filter.filter.constant.DefaultTryCastAs(spec->column_type, true) &&
+			                    !late_filter.filter.constant.IsNull();
+		}
+		result.push_back(std::move(late_filter));
 	}
-
 	return result;
 }
 
-static vector<RowRange> BuildRangesForColumn(GlobalColumnIdx global_idx, const vector<ClaimedFilter> &col_filters,
-                                             const H5ReadSingleFileBindView &bind_data,
-                                             const H5ReadGlobalState &gstate) {
-	if (std::holds_alternative<RunEncodedColumnSpec>(bind_data.columns[global_idx])) {
-		LocalColumnIdx local_idx = GlobalToLocal(gstate, global_idx);
-		auto &encoded_spec = std::get<RunEncodedColumnSpec>(bind_data.columns[global_idx]);
-		auto &encoded_state = std::get<RunEncodedColumnState>(gstate.column_states[local_idx]);
-		return BuildRangesForRunEncodedColumn(encoded_spec, encoded_state, col_filters);
+// Copies a column spec, including its HDF5 memory types.
+static RegularColumnSpec CopyRegularColumnSpec(const RegularColumnSpec &spec) {
+	RegularColumnSpec result;
+	result.path = spec.path;
+	result.column_name = spec.column_name;
+	result.column_type = spec.column_type;
+	result.is_string = spec.is_string;
+	if (spec.string_h5_type) {
+		result.string_h5_type.emplace(spec.string_h5_type->get());
 	}
-	if (std::holds_alternative<IndexColumnSpec>(bind_data.columns[global_idx])) {
-		return BuildIndexRanges(col_filters, bind_data.num_rows);
+	result.compound_member = spec.compound_member;
+	if (spec.compound_read_type) {
+		result.compound_read_type.emplace(spec.compound_read_type->get());
 	}
-	return {};
+	if (spec.enum_read_type) {
+		result.enum_read_type.emplace(spec.enum_read_type->get());
+	}
+	result.ndims = spec.ndims;
+	result.dims = spec.dims;
+	result.slice_start = spec.slice_start;
+	result.slice_stride = spec.slice_stride;
+	result.stored_dims = spec.stored_dims;
+	result.member_dims = spec.member_dims;
+	result.output_bytes_per_row = spec.output_bytes_per_row;
+	result.elements_per_row = spec.elements_per_row;
+	return result;
 }
 
 // Initialize the inner single-file scan state for one file.
@@ -1318,9 +3144,13 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 	auto result = make_uniq<H5ReadGlobalState>();
 	auto target_batch_size_bytes = ResolveBatchSizeOption(context);
 
+	auto max_cache_windows = ResolveCacheWindowsOption(context);
+
 	result->columns_to_scan = data_column_ids;
 	result->output_column_positions = data_output_positions;
 	result->scan_batch_size = EstimateScanBatchSize(bind_data.columns, data_column_ids, target_batch_size_bytes);
+	result->filename = bind_data.filename;
+	result->num_rows = bind_data.num_rows;
 
 	// Build global-to-local index mapping for projection pushdown
 	// This allows O(1) lookup: global_column_idx -> local_column_states_idx
@@ -1329,18 +3159,49 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 		result->global_to_local[global_idx] = local_idx;
 	}
 
+	// Zone maps are only kept for local files that are not being appended to, and the file identity
+	// is looked up before taking the HDF5 lock.
+	std::optional<H5FileIdentity> zone_map_identity;
+	if (!bind_data.swmr && ResolveZoneMapsOption(context)) {
+		for (auto global_idx : data_column_ids) {
+			if (H5ReadColumnSupportsZoneMap(bind_data.columns[global_idx])) {
+				zone_map_identity = H5TryGetLocalFileIdentity(context, bind_data.filename);
+				break;
+			}
+		}
+	}
+
+	// Wide columns are late-materialized only when a claimed filter on a scanned regular column can reject rows.
+	bool late_materialization = false;
+	if (ResolveLateMaterializationOption(context)) {
+		for (const auto &filter : bind_data.claimed_filters) {
+			if (result->global_to_local.count(filter.column_index) &&
+			    std::holds_alternative<RegularColumnSpec>(bind_data.columns[filter.column_index])) {
+				late_materialization = true;
+				break;
+			}
+		}
+	}
+
+	auto string_dictionary = ResolveStringDictionaryOption(context);
+
 	// Lock for all HDF5 operations (not thread-safe)
-	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	auto lock = H5LockForScan();
 
 	// Open file (with error suppression) - RAII wrapper handles cleanup
 	{
 		H5ErrorSuppressor suppress;
-		result->file = H5FileHandle(&context, bind_data.filename.c_str(), H5F_ACC_RDONLY, bind_data.swmr);
+		result->file = H5OpenFile(context, bind_data.filename, bind_data.swmr);
 	}
 
 	if (!result->file.is_valid()) {
 		throw IOException(FormatRemoteHDF5Error("Failed to open HDF5 file", bind_data.filename));
 	}
+	result->plan_remote_reads = H5RemoteVFD::SupportsPrefetch(result->file.get());
+	result->buffer_manager = &BufferManager::GetBufferManager(context);
+	// Data in local files opened for SWMR can still be written under HDF5's page buffer, so those go through H5Dread.
+	auto contiguous_direct_allowed = !bind_data.swmr && !H5RemoteVFD::IsRemotePath(bind_data.filename);
+	bool direct_file_attempted = false;
 
 	// Allocate DENSE column_states array - only for scanned columns
 	// Indexed by LOCAL position [0, 1, 2, ...], not global column indices
@@ -1378,33 +3239,82 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 				    RegularColumnState state;
 				    state.dataset = std::move(dataset);
 				    state.file_space = std::move(file_space);
+				    // Compound fields are converted by H5Dread as part of selecting their member.
+				    if (!spec.is_string && spec.output_bytes_per_row > 0 && !spec.compound_member) {
+					    auto native_type = DispatchOnNumericType(GetBaseType(spec.column_type), [&](auto type_tag) {
+						    using T = typename decltype(type_tag)::type;
+						    return GetNativeH5Type<T>();
+					    });
+					    auto file_type = H5TypeHandle::TakeOwnershipOf(H5Dget_type(state.dataset.get()));
+					    if (file_type.get() >= 0) {
+						    state.stored_conversion = H5GetStoredConversion(file_type, native_type);
+					    }
+					    // Direct chunk decoding copies whole stored rows, so sliced columns are read through H5Dread.
+					    if (!spec.IsSliced()) {
+						    auto read_type = RegularColumnNumericReadType(spec, state, native_type);
+						    state.chunk_direct = H5ChunkDirectTryGetLayout(state.dataset.get(), read_type, spec.dims);
+						    if (contiguous_direct_allowed) {
+							    TryEnableContiguousDirect(context, *result, state, spec, read_type, bind_data.filename,
+							                              direct_file_attempted);
+						    }
+					    }
+				    }
+				    if (zone_map_identity && H5ReadColumnSupportsZoneMap(col)) {
+					    auto chunk_rows = GetDatasetChunkRows(spec, state.dataset.get());
+					    if (chunk_rows > 0) {
+						    state.zone_map =
+						        H5GetZoneMap(bind_data.filename, *zone_map_identity, RegularColumnZoneMapKey(spec),
+						                     spec.column_type, spec.dims[0], chunk_rows);
+					    }
+				    }
+
+				    if (spec.is_string) {
+					    D_ASSERT(spec.string_h5_type.has_value());
+					    state.string_info = InspectHDF5StringType(*spec.string_h5_type, bind_data.filename, spec.path);
+					    state.string_dictionary = string_dictionary && !state.string_info->is_variable;
+				    }
+				    // Chunk-direct columns decode whole chunks either way, so they keep their cache windows instead.
+				    state.late_materialized = late_materialization && !spec.is_string && spec.elements_per_row > 1 &&
+				                              spec.output_bytes_per_row >= H5_READ_LATE_MIN_ROW_BYTES &&
+				                              !state.chunk_direct;
 
 				    // Create read-ahead cache windows for non-empty cacheable columns when one
 				    // window can serve multiple output batches.
-				    if (!spec.is_string && spec.output_bytes_per_row > 0) {
-					    auto window_rows = ComputeCacheWindowRows(spec, state.dataset.get(), target_batch_size_bytes,
-					                                              bind_data.num_rows);
+				    auto cache_bytes_per_row = CacheBytesPerRow(spec, state);
+				    if (cache_bytes_per_row > 0) {
+					    auto window_rows = ComputeCacheWindowRows(spec, cache_bytes_per_row, state.dataset.get(),
+					                                              target_batch_size_bytes, bind_data.num_rows);
 					    if (window_rows > 0 &&
-					        H5ReadShouldCreateCache(spec, window_rows, bind_data.num_rows, result->scan_batch_size)) {
+					        H5ReadShouldCreateCache(cache_bytes_per_row, window_rows, bind_data.num_rows,
+					                                result->scan_batch_size, max_cache_windows)) {
 						    state.cache = std::make_unique<RegularColumnCache>();
 						    state.cache->window_rows = window_rows;
-
-						    auto window_count = ComputeCacheWindowCount(window_rows, bind_data.num_rows);
-
-						    auto base_type = GetBaseType(spec.column_type);
-						    DispatchOnNumericType(base_type, [&](auto type_tag) {
-							    using T = typename decltype(type_tag)::type;
+						    state.cache->spec = CopyRegularColumnSpec(spec);
+
+						    auto window_count =
+						        ComputeCacheWindowCount(window_rows, bind_data.num_rows, max_cache_windows);
+						    state.cache->windows.resize(window_count);
+
+						    // String windows are allocated by every fill, see CacheWindow.
+						    if (!spec.is_string) {
+							    auto &buffer_manager = BufferManager::GetBufferManager(context);
+							    auto buffer_elements = CheckedDatasetSizeProduct(window_rows, spec.elements_per_row,
+							                                                     bind_data.filename, spec.path);
+							    auto element_size = GetTypeIdSize(GetBaseType(spec.column_type).InternalType());
+							    auto buffer_bytes = CheckedDatasetSizeProduct(buffer_elements, element_size,
+							                                                  bind_data.filename, spec.path);
 							    for (idx_t window_idx = 0; window_idx < window_count; window_idx++) {
-								    auto &window = state.cache->windows[window_idx];
-								    auto buffer_elements = CheckedDatasetSizeProduct(window_rows, spec.elements_per_row,
-								                                                     bind_data.filename, spec.path);
-								    window.cache = std::vector<T>(buffer_elements);
+								    state.cache->windows[window_idx].storage =
+								        buffer_manager.Allocate(MemoryTag::EXTENSION, buffer_bytes);
 							    }
-						    });
+						    }
 
 						    cache_refresh_entries.push_back({local_idx,
 						                                     TryGetDatasetReadOrderAddress(spec, state.dataset.get()),
 						                                     cache_refresh_entries.size()});
+						    if (result->plan_remote_reads) {
+							    state.read_plan = TryGetDatasetPlanLayout(spec, state.dataset.get());
+						    }
 					    }
 				    }
 
@@ -1429,6 +3339,7 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 				    }
 
 				    ScalarColumnState scalar_state;
+				    H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
 				    if (spec.string_h5_type) {
 					    std::string value;
 					    ReadHDF5Strings(dataset, *spec.string_h5_type, H5S_ALL, H5S_ALL, 1, bind_data.filename,
@@ -1440,12 +3351,14 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 						    using T = typename decltype(type_tag)::type;
 						    T value {};
 						    H5ErrorSuppressor suppress;
-						    herr_t status =
-						        H5Dread(dataset, GetNativeH5Type<T>(), H5S_ALL, H5S_ALL, H5P_DEFAULT, &value);
+						    auto read_type = spec.enum_read_type ? spec.enum_read_type->get() : GetNativeH5Type<T>();
+						    herr_t status = H5Dread(dataset, read_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, &value);
 						    if (status < 0) {
 							    throw IOException(FormatRemoteDatasetReadError(bind_data.filename, spec.path));
 						    }
-						    scalar_state.value = value;
+						    if (base_type.id() != LogicalTypeId::ENUM || H5ReadIsEnumCode(base_type, value)) {
+							    scalar_state.value = value;
+						    }
 					    });
 				    }
 
@@ -1457,8 +3370,8 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 				    RunEncodedColumnState encoded_col;
 
 				    // Open datasets (types were inspected in Bind phase) - RAII handles cleanup
-				    H5DatasetHandle boundaries_ds;
-				    H5DatasetHandle values_ds;
+				    auto &boundaries_ds = encoded_col.boundaries_ds;
+				    auto &values_ds = encoded_col.values_ds;
 				    {
 					    H5ErrorSuppressor suppress;
 					    boundaries_ds = H5DatasetHandle(result->file, spec.boundaries_path.c_str());
@@ -1532,12 +3445,21 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 					        bind_data.filename, spec));
 				    }
 
-				    encoded_col.run_starts = LoadRunBoundaries(bind_data.filename, spec, boundaries_ds, num_runs,
-				                                               bind_data.num_rows, encoded_col.non_null_end);
-				    encoded_col.values = LoadRunEncodedValues(bind_data.filename, spec, values_ds, num_values);
-
-				    // Note: encoded column state is stateless (thread-safe)
-				    // No runtime state initialization needed
+				    if (spec.values_string_h5_type) {
+					    encoded_col.values_string_info = InspectHDF5StringType(*spec.values_string_h5_type,
+					                                                           bind_data.filename, spec.values_path);
+				    }
+				    encoded_col.num_rows = bind_data.num_rows;
+				    encoded_col.num_runs = num_runs;
+				    InitRunEncodedRowSpan(bind_data.filename, spec, encoded_col);
+
+				    // Boundaries and values are loaded a window at a time as the scan reaches them. The first
+				    // window is loaded right away, which also validates small columns before the scan starts.
+				    encoded_col.window_cache = make_uniq<RunEncodedWindowCache>();
+				    if (num_runs > 0) {
+					    encoded_col.window_cache->windows.push_front(
+					        LoadRunEncodedWindow(bind_data.filename, spec, encoded_col, 0));
+				    }
 
 				    // Store in dense array with LOCAL indexing
 				    result->column_states.push_back(std::move(encoded_col));
@@ -1563,6 +3485,9 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 	for (const auto &entry : cache_refresh_entries) {
 		result->cache_refresh_order.push_back(entry.local_idx);
 	}
+	if (late_materialization) {
+		result->late_filters = BuildLateFilters(bind_data, *result);
+	}
 
 	// Compute row ranges based on claimed filters (from pushdown_complex_filter)
 	// Group claimed filters by column
@@ -1571,9 +3496,9 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 		filters_by_column[filter.column_index].push_back(filter);
 	}
 
-	// If we have filters on run-encoded or index columns, compute row ranges
+	// If we have filters on run-encoded, index, or zone-mapped columns, compute row ranges
 	if (!filters_by_column.empty()) {
-		vector<RowRange> ranges = {{0, bind_data.num_rows}};
+		auto ranges = InitialRowRanges(bind_data.first_row, bind_data.num_rows);
 
 		for (const auto &[global_idx_raw, col_filters] : filters_by_column) {
 			// Map global column index to local column_states index
@@ -1586,11 +3511,12 @@ static unique_ptr<H5ReadGlobalState> InitSingleH5ReadState(ClientContext &contex
 
 		result->valid_row_ranges = std::move(ranges);
 	} else {
-		// No pushdown filters - all rows are valid
-		result->valid_row_ranges.push_back({0, bind_data.num_rows});
+		// No pushdown filters - all rows not returned by earlier scans are valid
+		result->valid_row_ranges = InitialRowRanges(bind_data.first_row, bind_data.num_rows);
 	}
 
 	result->position_done = AdjustPositionDoneForRanges(result->valid_row_ranges, 0);
+	result->partition_rows = ComputePartitionRows(context, *result);
 
 	return result;
 }
@@ -1740,8 +3666,35 @@ static bool H5ReadValueCanCastTo(const Value &value, const LogicalType &target_t
 	return cast_value.DefaultTryCastAs(target_type, true);
 }
 
+// Zone maps compare chunk bounds instead of individual values, so the comparison must happen in a numeric
+// type where casting the column preserves order.
+static bool H5ReadZoneMapComparisonTypeIsMonotone(const PushdownColumnRef &ref) {
+	switch (ref.comparison_type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
 static bool H5ReadCanClaimPushdownFilter(const ColumnSpec &column, const PushdownColumnRef &ref, const Value &constant,
                                          idx_t max_index) {
+	if (std::holds_alternative<RegularColumnSpec>(column)) {
+		return !constant.IsNull() && H5ReadZoneMapComparisonTypeIsMonotone(ref) &&
+		       H5ReadValueCanCastTo(constant, ref.comparison_type);
+	}
 	if (!std::holds_alternative<IndexColumnSpec>(column)) {
 		return true;
 	}
@@ -1751,6 +3704,10 @@ static bool H5ReadCanClaimPushdownFilter(const ColumnSpec &column, const Pushdow
 
 static bool H5ReadCanClaimPushdownBetween(const ColumnSpec &column, const PushdownColumnRef &ref, const Value &lower,
                                           const Value &upper, idx_t max_index) {
+	if (std::holds_alternative<RegularColumnSpec>(column)) {
+		return H5ReadCanClaimPushdownFilter(column, ref, lower, max_index) &&
+		       H5ReadCanClaimPushdownFilter(column, ref, upper, max_index);
+	}
 	if (!std::holds_alternative<IndexColumnSpec>(column)) {
 		return true;
 	}
@@ -1768,7 +3725,7 @@ static void H5ReadAddClaimedFilter(vector<ClaimedFilter> &claimed, idx_t column_
 	claimed.push_back(std::move(filter));
 }
 
-// Helper: Try to claim a filter on a run-encoded or index column
+// Helper: Try to claim a filter on a run-encoded, index, or zone-mapped regular column
 template <typename TableIndexT>
 static bool TryClaimPushdownFilter(const unique_ptr<Expression> &expr, const TableIndexT &table_index,
                                    const unordered_map<idx_t, idx_t> &get_to_bind_map,
@@ -1865,11 +3822,14 @@ static void H5ReadPushdownComplexFilter(ClientContext &context, LogicalGet &get,
 	auto &bind_data = bind_data_p->Cast<H5ReadBindData>();
 	const auto &columns = GetCanonicalColumns(bind_data);
 
-	// Build set of pushdown-eligible column indices (run-encoded or index)
+	// Build set of pushdown-eligible column indices (run-encoded, index, or 1-D regular for zone maps and late
+	// materialization)
+	auto claim_regular = ResolveZoneMapsOption(context) || ResolveLateMaterializationOption(context);
 	unordered_set<idx_t> pushdown_column_indices;
 	for (idx_t i = 0; i < columns.size(); i++) {
 		if (std::holds_alternative<RunEncodedColumnSpec>(columns[i]) ||
-		    std::holds_alternative<IndexColumnSpec>(columns[i])) {
+		    std::holds_alternative<IndexColumnSpec>(columns[i]) ||
+		    (claim_regular && H5ReadColumnSupportsZoneMap(columns[i]))) {
 			pushdown_column_indices.insert(i);
 		}
 	}
@@ -1895,7 +3855,13 @@ static void H5ReadPushdownComplexFilter(ClientContext &context, LogicalGet &get,
 	const auto &table_index = get.table_index;
 	idx_t max_num_rows = 0;
 	for (const auto &file_bind_data : bind_data.file_bind_data) {
-		max_num_rows = MaxValue<idx_t>(max_num_rows, file_bind_data.num_rows);
+		max_num_rows = MaxValue<idx_t>(max_num_rows, H5ReadFileIndexRows(file_bind_data));
+	}
+	for (const auto &column : columns) {
+		auto index_spec = std::get_if<IndexColumnSpec>(&column);
+		if (index_spec && index_spec->global) {
+			max_num_rows = bind_data.total_num_rows;
+		}
 	}
 	const auto max_index = max_num_rows == 0 ? 0 : max_num_rows - 1;
 
@@ -1934,14 +3900,27 @@ static RangeSelection NextRangeFrom(const std::vector<RowRange> &valid_row_range
 	return NextRangeFrom(valid_row_ranges, position, NumericLimits<idx_t>::Maximum(), NumericLimits<idx_t>::Maximum());
 }
 
-static RangeSelection ClaimNextRange(H5ReadGlobalState &gstate, idx_t num_rows) {
+// Claim the next logical partition holding at least one valid row. Partitions are aligned to
+// gstate.partition_rows, so the ordinal of a partition only depends on where it starts and
+// batch indexes derived from it are stable no matter which thread claims it.
+static bool ClaimNextPartition(H5ReadGlobalState &gstate, idx_t num_rows, H5ReadPartition &partition) {
 	std::lock_guard<std::mutex> lock(gstate.range_selection_mutex);
-	auto range = NextRangeFrom(gstate.valid_row_ranges, gstate.position, num_rows, gstate.scan_batch_size);
+	auto range = NextRangeFrom(gstate.valid_row_ranges, gstate.position, num_rows, 1);
 	if (!range.has_data) {
-		return {false, 0, 0};
+		gstate.position = num_rows;
+		return false;
 	}
-	gstate.position = range.position + range.to_read;
-	return range;
+	auto ordinal = range.position / gstate.partition_rows;
+	partition.position = range.position;
+	partition.position_end = MinValue<idx_t>((ordinal + 1) * gstate.partition_rows, num_rows);
+	partition.ordinal = ordinal;
+	gstate.position = partition.position_end;
+	return true;
+}
+
+static void SignalCacheProgress(H5ReadGlobalState &gstate) {
+	gstate.fetch_signal.fetch_add(1, std::memory_order_acq_rel);
+	gstate.fetch_signal.notify_all();
 }
 
 static void MarkRangeComplete(H5ReadGlobalState &gstate, idx_t position, idx_t count) {
@@ -1964,162 +3943,386 @@ static void MarkRangeComplete(H5ReadGlobalState &gstate, idx_t position, idx_t c
 		gstate.completed_ranges.erase(it);
 	}
 	gstate.position_done.store(completed_through, std::memory_order_release);
+	if (gstate.prefetch_running.load(std::memory_order_acquire)) {
+		// Windows whose rows are now all returned can be refilled by the prefetch task.
+		SignalCacheProgress(gstate);
+	}
 }
 
-// Helper function to scan a run-encoded column
-static void ScanRunEncodedColumn(const RunEncodedColumnSpec &spec, RunEncodedColumnState &state, Vector &result_vector,
-                                 idx_t position, idx_t to_read) {
-	// Dispatch once per chunk, not per row
-	DispatchOnDuckDBType(spec.column_type, [&](auto type_tag) {
-		using T = typename decltype(type_tag)::type;
+// Helper function to scan a run-encoded column. A chunk inside one run becomes a CONSTANT_VECTOR and a chunk
+// inside one window a DICTIONARY_VECTOR over the window's values; only chunks spanning windows are copied.
+static void ScanRunEncodedColumn(const string &filename, const RunEncodedColumnSpec &spec,
+                                 const RunEncodedColumnState &state, Vector &result_vector, idx_t position,
+                                 idx_t to_read) {
+	auto end = position + to_read;
+	if (state.num_runs == 0 || position >= state.non_null_end || end <= state.first_start) {
+		// Empty run encoding or only NULL rows requested
+		result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+		ConstantVector::SetNull(result_vector, true);
+		return;
+	}
 
-		// Access typed vector directly (no Value overhead)
-		const auto &typed_values = std::get<std::vector<T>>(state.values);
-		D_ASSERT(state.run_starts.size() == typed_values.size());
-		if (state.run_starts.empty()) {
-			// Empty run encoding: emit NULLs for the requested rows
-			result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result_vector, true);
-			return;
-		}
-		if (position >= state.non_null_end) {
-			result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(result_vector, true);
-			return;
-		}
+	// Rows [non_null_begin, non_null_end) have values; the rest of the chunk is NULL
+	auto non_null_begin = MaxValue<idx_t>(position, state.first_start);
+	auto non_null_end = MinValue<idx_t>(end, state.non_null_end);
+	auto window = GetRunEncodedWindow(filename, spec, state, non_null_begin);
+	auto run = window->FindRun(non_null_begin);
 
-		idx_t result_offset = 0;
+	// OPTIMIZATION: Check if entire chunk belongs to single run
+	// With avg run length ~10k and chunk size 2048, this is true ~83% of the time!
+	if (non_null_begin == position && non_null_end == end && window->RunEnd(run) >= end) {
+		result_vector.SetVectorType(VectorType::FLAT_VECTOR);
+		VectorOperations::Copy(window->dictionary, result_vector, run + 1, run, 0);
+		result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+		return;
+	}
 
-		// Leading NULL segment if first run starts after 0
-		if (position < state.run_starts[0]) {
-			result_offset = std::min<idx_t>(to_read, state.run_starts[0] - position);
-			if (result_offset == to_read) {
-				result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
-				ConstantVector::SetNull(result_vector, true);
-				return;
-			}
-			position += result_offset;
-			to_read -= result_offset;
+	if (window->end_row >= non_null_end) {
+		// All runs of the chunk are in this window: select them from its values, NULL rows from its NULL entry
+		SelectionVector sel(to_read);
+		idx_t i = 0;
+		for (; position + i < non_null_begin; i++) {
+			sel.set_index(i, window->NullIndex());
 		}
-		if (position >= state.non_null_end) {
-			result_vector.SetVectorType(VectorType::FLAT_VECTOR);
-			for (idx_t i = 0; i < result_offset + to_read; i++) {
-				FlatVector::SetNull(result_vector, i, true);
+		while (position + i < non_null_end) {
+			auto run_end = MinValue<idx_t>(window->RunEnd(run), non_null_end);
+			for (; position + i < run_end; i++) {
+				sel.set_index(i, run);
 			}
-			return;
+			run++;
 		}
-
-		idx_t null_suffix = 0;
-		idx_t non_null_remaining = state.non_null_end - position;
-		if (to_read > non_null_remaining) {
-			null_suffix = to_read - non_null_remaining;
-			to_read = non_null_remaining;
+		for (; i < to_read; i++) {
+			sel.set_index(i, window->NullIndex());
 		}
+		result_vector.Slice(window->dictionary, sel, to_read);
+		return;
+	}
 
-		auto it = std::upper_bound(state.run_starts.begin(), state.run_starts.end(), position);
-		idx_t current_run = (it - state.run_starts.begin()) - 1;
-		idx_t next_run_start =
-		    (current_run + 1 < state.run_starts.size()) ? state.run_starts[current_run + 1] : state.non_null_end;
-
-		// OPTIMIZATION: Check if entire chunk belongs to single run
-		// With avg run length ~10k and chunk size 2048, this is true ~83% of the time!
-		idx_t rows_in_current_run = next_run_start - position;
-		if (result_offset == 0 && null_suffix == 0 && rows_in_current_run >= to_read) {
-			// Entire chunk is one value - emit CONSTANT_VECTOR (no fill loop needed!)
-			result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
-			const T &run_value = typed_values[current_run];
-
-			if constexpr (std::is_same_v<T, string>) {
-				auto result_data = ConstantVector::GetData<string_t>(result_vector);
-				result_data[0] = StringVector::AddString(result_vector, run_value);
-			} else {
-				auto result_data = ConstantVector::GetData<T>(result_vector);
-				result_data[0] = run_value;
+	// The chunk spans windows: copy each run into a flat vector
+	result_vector.SetVectorType(VectorType::FLAT_VECTOR);
+	for (idx_t i = 0; position + i < non_null_begin; i++) {
+		FlatVector::SetNull(result_vector, i, true);
+	}
+	auto row = non_null_begin;
+	while (row < non_null_end) {
+		if (!window->Contains(row)) {
+			window = GetRunEncodedWindow(filename, spec, state, row);
+			run = window->FindRun(row);
+		}
+		auto run_end = MinValue<idx_t>(window->RunEnd(run), non_null_end);
+		auto rows_to_fill = run_end - row;
+		if (rows_to_fill > 0) {
+			SelectionVector sel(rows_to_fill);
+			for (idx_t j = 0; j < rows_to_fill; j++) {
+				sel.set_index(j, run);
 			}
-			return;
+			VectorOperations::Copy(window->dictionary, result_vector, sel, rows_to_fill, 0, row - position);
 		}
+		row = run_end;
+		run++;
+	}
+	for (idx_t i = non_null_end - position; i < to_read; i++) {
+		FlatVector::SetNull(result_vector, i, true);
+	}
+}
 
-		// Fall back to batched fill when chunk spans multiple runs
-		result_vector.SetVectorType(VectorType::FLAT_VECTOR);
-		if (result_offset > 0) {
-			for (idx_t i = 0; i < result_offset; i++) {
-				FlatVector::SetNull(result_vector, i, true);
-			}
+// ==================== Cache Window Helpers ====================
+
+// Helper: Record min/max for every chunk that lies entirely inside the rows just read. Chunks containing NaN
+// are left without statistics because NaN does not order like the other values.
+template <typename T>
+static void RecordZoneMapStats(H5ZoneMap &zone_map, const T *data, idx_t row_start, idx_t row_count) {
+	const idx_t chunk_rows = zone_map.ChunkRows();
+	const idx_t row_end = MinValue<idx_t>(row_start + row_count, zone_map.NumRows());
+	for (idx_t chunk_idx = (row_start + chunk_rows - 1) / chunk_rows; chunk_idx < zone_map.ChunkCount();
+	     chunk_idx++) {
+		idx_t chunk_start = chunk_idx * chunk_rows;
+		idx_t chunk_end = MinValue<idx_t>(chunk_start + chunk_rows, zone_map.NumRows());
+		if (chunk_end > row_end) {
+			break;
 		}
-		idx_t i = 0;
-		while (i < to_read) {
-			// Calculate current row position
-			idx_t current_row = position + i;
-
-			// Calculate how many rows belong to current run
-			rows_in_current_run = next_run_start - current_row;
-			idx_t rows_to_fill = std::min(rows_in_current_run, to_read - i);
-
-			// Get the value for this run
-			const T &run_value = typed_values[current_run];
-
-			// Tight loop: fill all rows with same value (no conditionals!)
-			if constexpr (std::is_same_v<T, string>) {
-				// VARCHAR: need to call StringVector::AddString for each
-				auto result_data = FlatVector::GetData<string_t>(result_vector);
-				for (idx_t j = 0; j < rows_to_fill; j++) {
-					result_data[result_offset + i + j] = StringVector::AddString(result_vector, run_value);
-				}
-			} else {
-				// Numeric types: direct assignment - compiler can vectorize this!
-				auto result_data = FlatVector::GetData<T>(result_vector);
-				for (idx_t j = 0; j < rows_to_fill; j++) {
-					result_data[result_offset + i + j] = run_value;
+		if (zone_map.IsKnown(chunk_idx)) {
+			continue;
+		}
+		const T *values = data + (chunk_start - row_start);
+		T min_value = values[0];
+		T max_value = values[0];
+		bool has_nan = false;
+		for (idx_t i = 0; i < chunk_end - chunk_start; i++) {
+			if constexpr (std::is_floating_point_v<T>) {
+				if (std::isnan(values[i])) {
+					has_nan = true;
+					break;
 				}
 			}
+			min_value = values[i] < min_value ? values[i] : min_value;
+			max_value = values[i] > max_value ? values[i] : max_value;
+		}
+		if (!has_nan) {
+			zone_map.Record(chunk_idx, H5CreateDuckDBValue(min_value), H5CreateDuckDBValue(max_value));
+		}
+	}
+}
 
-			i += rows_to_fill;
+static void PublishChunkDecode(H5ReadGlobalState &gstate, shared_ptr<H5ChunkDirectDecodeBatch> batch) {
+	{
+		std::lock_guard<std::mutex> guard(gstate.pending_decode_lock);
+		gstate.pending_decode = std::move(batch);
+	}
+	gstate.fetch_signal.fetch_add(1, std::memory_order_acq_rel);
+	gstate.fetch_signal.notify_all();
+}
 
-			// If we've exhausted current run and there's more to read, advance to next run
-			if (i < to_read) {
-				current_run++;
-				next_run_start = (current_run + 1 < state.run_starts.size()) ? state.run_starts[current_run + 1]
-				                                                             : state.non_null_end;
-			}
+// Several windows can be filled at once, so only clear the published batch if it is still ours.
+static void RetractChunkDecode(H5ReadGlobalState &gstate, const shared_ptr<H5ChunkDirectDecodeBatch> &batch) {
+	std::lock_guard<std::mutex> guard(gstate.pending_decode_lock);
+	if (gstate.pending_decode == batch) {
+		gstate.pending_decode.reset();
+	}
+}
+
+static void HelpPendingChunkDecode(H5ReadGlobalState &gstate) {
+	shared_ptr<H5ChunkDirectDecodeBatch> batch;
+	{
+		std::lock_guard<std::mutex> guard(gstate.pending_decode_lock);
+		batch = gstate.pending_decode;
+	}
+	if (batch) {
+		batch->Help();
+	}
+}
+
+// Helper: Read rows through the chunk-direct path. Only fetching the raw chunks holds hdf5_global_mutex.
+// With a global state the decode work is published so scan threads waiting for the cache can share it.
+// Returns false when the caller has to fall back to H5Dread.
+static bool TryReadChunkDirect(const RegularColumnState &state, idx_t dataset_row_start, idx_t rows_to_read,
+                               data_ptr_t target, optional_ptr<H5ReadGlobalState> gstate) {
+	if (!state.chunk_direct) {
+		return false;
+	}
+	vector<H5ChunkDirectRawChunk> chunks;
+	{
+		auto lock = H5LockForScan();
+		if (!H5ChunkDirectReadRaw(state.dataset.get(), *state.chunk_direct, dataset_row_start, rows_to_read, target,
+		                          chunks)) {
+			return false;
 		}
-		for (idx_t j = 0; j < null_suffix; j++) {
-			FlatVector::SetNull(result_vector, result_offset + to_read + j, true);
+	}
+	idx_t stored_bytes = 0;
+	for (const auto &chunk : chunks) {
+		stored_bytes += chunk.data.size();
+	}
+	H5RecordScanStat(H5ScanCounter::CHUNK_DIRECT_READS, chunks.size());
+	H5RecordScanStat(H5ScanCounter::CHUNK_DIRECT_BYTES, stored_bytes);
+	if (chunks.size() <= 1 || !gstate) {
+		for (const auto &chunk : chunks) {
+			if (!H5ChunkDirectDecode(*state.chunk_direct, chunk)) {
+				return false;
+			}
 		}
-	});
+		return true;
+	}
+	auto batch = make_shared_ptr<H5ChunkDirectDecodeBatch>(*state.chunk_direct, std::move(chunks));
+	PublishChunkDecode(*gstate, batch);
+	auto decoded = batch->Finish();
+	RetractChunkDecode(*gstate, batch);
+	return decoded;
 }
 
-// ==================== Cache Window Helpers ====================
+// Helper: Read rows of a contiguous dataset with one positional read of the local file. Does not call into HDF5, so
+// scan threads read in parallel without hdf5_global_mutex. Returns false when the caller has to use H5Dread.
+static bool TryReadContiguousDirect(const RegularColumnState &state, const H5ReadGlobalState &gstate,
+                                    idx_t dataset_row_start, idx_t rows_to_read, data_ptr_t target) {
+	if (!state.contiguous_direct || !gstate.direct_file) {
+		return false;
+	}
+	const auto &layout = *state.contiguous_direct;
+	auto bytes = rows_to_read * layout.row_bytes;
+	gstate.direct_file->Read(target, bytes, layout.address + dataset_row_start * layout.row_bytes);
+	H5RecordScanStat(H5ScanCounter::CONTIGUOUS_DIRECT_READS);
+	H5RecordScanStat(H5ScanCounter::CONTIGUOUS_DIRECT_BYTES, bytes);
+	return true;
+}
 
 // Helper: Read data from HDF5 into typed cache buffer
-static void ReadIntoTypedCache(CacheWindow::CacheStorage &cache, hid_t dataset_id, hid_t file_space_id,
-                               idx_t dataset_row_start, idx_t rows_to_read, const RegularColumnSpec &spec,
-                               const string &filename) {
+static void ReadIntoTypedCache(const CacheWindow &window, const RegularColumnState &state,
+                               H5ReadGlobalState &gstate, idx_t dataset_row_start, idx_t rows_to_read,
+                               const RegularColumnSpec &spec, const string &filename) {
 	auto base_type = GetBaseType(spec.column_type);
 	DispatchOnNumericType(base_type, [&](auto type_tag) {
 		using T = typename decltype(type_tag)::type;
-		auto &typed_cache = std::get<std::vector<T>>(cache);
+		auto typed_cache = window.Data<T>();
 
-		// Lock for all HDF5 operations (not thread-safe)
-		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+		if (!TryReadChunkDirect(state, dataset_row_start, rows_to_read, reinterpret_cast<data_ptr_t>(typed_cache),
+		                        &gstate)) {
+			// Lock for all HDF5 operations (not thread-safe)
+			auto lock = H5LockForScan();
+			H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
 
-		H5DataspaceHandle mem_space = CreateMemspaceAndSelect(file_space_id, spec, dataset_row_start, rows_to_read);
+			hid_t dataset_id = state.dataset.get();
+			hid_t file_space_id = state.file_space.get();
+			H5DataspaceHandle mem_space =
+			    CreateMemspaceAndSelect(file_space_id, spec, dataset_row_start, rows_to_read);
 
-		H5ErrorSuppressor suppress;
-		herr_t status =
-		    H5Dread(dataset_id, GetNativeH5Type<T>(), mem_space, file_space_id, H5P_DEFAULT, typed_cache.data());
-		if (status < 0) {
-			throw IOException(FormatRemoteDatasetReadError(filename, spec.path));
+			H5ErrorSuppressor suppress;
+			herr_t status = H5Dread(dataset_id, RegularColumnNumericReadType(spec, state, GetNativeH5Type<T>()),
+			                        mem_space, file_space_id, H5P_DEFAULT, typed_cache);
+			if (status < 0) {
+				throw IOException(FormatRemoteDatasetReadError(filename, spec.path));
+			}
+		}
+		ApplyRegularColumnConversion(spec, state, reinterpret_cast<data_ptr_t>(typed_cache), rows_to_read);
+		if (state.zone_map) {
+			RecordZoneMapStats(*state.zone_map, typed_cache, dataset_row_start, rows_to_read);
 		}
 	});
 }
 
+// Helper: Fill window in dictionary mode from the rows of a fixed-length string dataset just read to raw (see
+// CacheWindow::dictionary). Each distinct value is validated once. Returns false, leaving the window to hold one
+// string_t per row, when the rows have more than one distinct value per H5_READ_DICTIONARY_MIN_ROWS_PER_VALUE.
+static bool TryFillStringDictionary(CacheWindow &window, BufferManager &buffer_manager, data_ptr_t raw,
+                                    idx_t rows_to_read, const H5StringReadInfo &info, const RegularColumnSpec &spec,
+                                    const string &filename) {
+	auto max_values = MaxValue<idx_t>(rows_to_read / H5_READ_DICTIONARY_MIN_ROWS_PER_VALUE, 1);
+	string_map_t<sel_t> codes_by_value;
+	vector<string_t> values;
+	auto codes = window.Data<sel_t>();
+	for (idx_t i = 0; i < rows_to_read; i++) {
+		auto value = char_ptr_cast(raw + i * info.fixed_length);
+		auto size = H5FixedLengthStringSize(value, info.fixed_length, info.strpad);
+		string_t str(value, UnsafeNumericCast<uint32_t>(size));
+		auto entry = codes_by_value.find(str);
+		if (entry == codes_by_value.end()) {
+			if (values.size() == max_values) {
+				return false;
+			}
+			ValidateHDF5String(value, size, info.cset, filename, spec.path);
+			entry = codes_by_value.emplace(str, UnsafeNumericCast<sel_t>(values.size())).first;
+			values.push_back(str);
+		}
+		codes[i] = entry->second;
+	}
+
+	auto dictionary = make_shared_ptr<Vector>(LogicalType::VARCHAR, values.size());
+	std::copy(values.begin(), values.end(), FlatVector::GetData<string_t>(*dictionary));
+	// Values point into the window's storage, which vectors sliced from the dictionary keep pinned through it.
+	StringVector::AddHandle(*dictionary, buffer_manager.Pin(window.storage.GetBlockHandle()));
+	window.dictionary = std::move(dictionary);
+	return true;
+}
+
+// Helper: Read rows of a string dataset into a new buffer for window: string_t values first, then the
+// bytes of the non-inlined ones. Fixed-length values are read as stored and referenced in place, so
+// only variable-length values (owned by HDF5 until reclaimed) are copied.
+static void ReadIntoStringCache(CacheWindow &window, const RegularColumnState &state, H5ReadGlobalState &gstate,
+                                idx_t dataset_row_start, idx_t rows_to_read, const RegularColumnSpec &spec,
+                                const string &filename) {
+	D_ASSERT(state.string_info && gstate.buffer_manager);
+	const auto &info = *state.string_info;
+	auto values_bytes = CheckedDatasetSizeProduct(rows_to_read, sizeof(string_t), filename, spec.path);
+	window.dictionary.reset();
+
+	auto h5_type = RegularColumnReadType(spec, *spec.string_h5_type);
+	if (!info.is_variable) {
+		auto raw_bytes = CheckedDatasetSizeProduct(rows_to_read, info.fixed_length, filename, spec.path);
+		window.storage = gstate.buffer_manager->Allocate(MemoryTag::EXTENSION, values_bytes + raw_bytes);
+		auto raw = window.storage.Ptr() + values_bytes;
+		{
+			auto lock = H5LockForScan();
+			H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
+			H5DataspaceHandle mem_space =
+			    CreateMemspaceAndSelect(state.file_space.get(), spec, dataset_row_start, rows_to_read);
+			ReadHDF5FixedStrings(state.dataset.get(), h5_type, mem_space, state.file_space.get(), filename,
+			                     spec.path, raw);
+		}
+		if (state.string_dictionary &&
+		    TryFillStringDictionary(window, *gstate.buffer_manager, raw, rows_to_read, info, spec, filename)) {
+			H5RecordScanStat(H5ScanCounter::DICTIONARY_WINDOWS);
+			return;
+		}
+
+		auto values = window.Data<string_t>();
+		for (idx_t i = 0; i < rows_to_read; i++) {
+			auto value = char_ptr_cast(raw + i * info.fixed_length);
+			auto size = H5FixedLengthStringSize(value, info.fixed_length, info.strpad);
+			ValidateHDF5String(value, size, info.cset, filename, spec.path);
+			values[i] = string_t(value, UnsafeNumericCast<uint32_t>(size));
+		}
+		return;
+	}
+
+	// The file space selection is shared by all scan threads, so the read itself holds hdf5_global_mutex.
+	auto lock = H5LockForScan();
+	H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
+	H5DataspaceHandle mem_space =
+	    CreateMemspaceAndSelect(state.file_space.get(), spec, dataset_row_start, rows_to_read);
+	ReadHDF5VariableStrings(
+	    state.dataset.get(), h5_type, mem_space, state.file_space.get(), rows_to_read, filename, spec.path,
+	    [&](char *const *strings) {
+		    vector<uint32_t> sizes(rows_to_read);
+		    idx_t heap_bytes = 0;
+		    for (idx_t i = 0; i < rows_to_read; i++) {
+			    auto size = strings[i] ? strlen(strings[i]) : 0;
+			    ValidateHDF5String(strings[i] ? strings[i] : "", size, info.cset, filename, spec.path);
+			    if (size > NumericLimits<uint32_t>::Maximum()) {
+				    throw IOException(FormatDatasetError("String value too large in dataset", filename, spec.path));
+			    }
+			    sizes[i] = static_cast<uint32_t>(size);
+			    if (size > string_t::INLINE_LENGTH) {
+				    heap_bytes += size;
+			    }
+		    }
+		    window.storage = gstate.buffer_manager->Allocate(MemoryTag::EXTENSION, values_bytes + heap_bytes);
+		    auto values = window.Data<string_t>();
+		    auto heap = char_ptr_cast(window.storage.Ptr() + values_bytes);
+		    for (idx_t i = 0; i < rows_to_read; i++) {
+			    if (sizes[i] <= string_t::INLINE_LENGTH) {
+				    values[i] = string_t(strings[i] ? strings[i] : "", sizes[i]);
+				    continue;
+			    }
+			    std::memcpy(heap, strings[i], sizes[i]);
+			    values[i] = string_t(heap, sizes[i]);
+			    heap += sizes[i];
+		    }
+	    });
+}
+
+// Helper: Copy string_t values from a string window; target keeps the window's buffer pinned while
+// it references it.
+static void CopyFromStringCache(const CacheWindow &window, BufferManager &buffer_manager, idx_t buffer_offset_rows,
+                                idx_t rows_to_copy, Vector &target_vector, idx_t result_offset_rows) {
+	auto result_data = FlatVector::GetData<string_t>(target_vector);
+	if (window.dictionary) {
+		auto values = FlatVector::GetData<string_t>(*window.dictionary);
+		auto codes = window.Data<sel_t>() + buffer_offset_rows;
+		for (idx_t i = 0; i < rows_to_copy; i++) {
+			result_data[result_offset_rows + i] = values[codes[i]];
+		}
+	} else {
+		std::memcpy(result_data + result_offset_rows, window.Data<string_t>() + buffer_offset_rows,
+		            rows_to_copy * sizeof(string_t));
+	}
+	auto block = window.storage.GetBlockHandle();
+	StringVector::AddHandle(target_vector, buffer_manager.Pin(block));
+}
+
+// Helper: Emit rows of a dictionary-mode string window as a DICTIONARY_VECTOR over the window's distinct values.
+static void SliceFromStringDictionary(const CacheWindow &window, idx_t buffer_offset_rows, idx_t rows_to_copy,
+                                      Vector &target_vector) {
+	D_ASSERT(window.dictionary);
+	SelectionVector sel(rows_to_copy);
+	std::memcpy(sel.data(), window.Data<sel_t>() + buffer_offset_rows, rows_to_copy * sizeof(sel_t));
+	target_vector.Slice(*window.dictionary, sel, rows_to_copy);
+}
+
 // Helper: Copy data from typed cache to result vector
-static void CopyFromTypedCache(const CacheWindow::CacheStorage &cache, idx_t buffer_offset_rows, idx_t rows_to_copy,
+static void CopyFromTypedCache(const CacheWindow &window, idx_t buffer_offset_rows, idx_t rows_to_copy,
                                Vector &result_vector, idx_t result_offset_rows, LogicalType column_type,
                                idx_t elements_per_row) {
 	DispatchOnNumericType(column_type, [&](auto type_tag) {
 		using T = typename decltype(type_tag)::type;
-		const auto &typed_cache = std::get<std::vector<T>>(cache);
+		const auto typed_cache = window.Data<T>();
 
 		// Get result data pointer
 		auto result_data = FlatVector::GetData<T>(result_vector);
@@ -2128,70 +4331,325 @@ static void CopyFromTypedCache(const CacheWindow::CacheStorage &cache, idx_t buf
 		idx_t buffer_offset = buffer_offset_rows * elements_per_row;
 		idx_t result_offset = result_offset_rows * elements_per_row;
 		idx_t elements_to_copy = rows_to_copy * elements_per_row;
-		std::memcpy(result_data + result_offset, typed_cache.data() + buffer_offset, elements_to_copy * sizeof(T));
+		std::memcpy(result_data + result_offset, typed_cache + buffer_offset, elements_to_copy * sizeof(T));
 	});
 }
 
-static void TryLoadCacheWindows(RegularColumnCache &cache, hid_t dataset_id, hid_t file_space_id,
-                                const std::vector<RowRange> &valid_row_ranges, std::atomic<idx_t> &position_done,
-                                idx_t total_rows, const RegularColumnSpec &spec, const string &filename) {
-	auto window_count = ComputeCacheWindowCount(cache.window_rows, total_rows);
+// Helper: Find the window holding (or loading) row. Caller must hold gstate.cache_lock.
+static CacheWindow *FindCacheWindow(RegularColumnCache &cache, idx_t row) {
+	for (auto &window : cache.windows) {
+		if (window.end_row > 0 && window.start_row <= row && row < window.end_row) {
+			return &window;
+		}
+	}
+	return nullptr;
+}
+
+// Helper: Pick a window that can be refilled, preferring empty windows and then the least
+// recently used one. Returns nullptr if every window is pinned or loading. Caller must hold
+// gstate.cache_lock.
+static CacheWindow *PickCacheWindowToFill(RegularColumnCache &cache) {
+	CacheWindow *result = nullptr;
+	for (auto &window : cache.windows) {
+		if (window.loading || window.pins > 0) {
+			continue;
+		}
+		if (window.end_row == 0) {
+			return &window;
+		}
+		if (!result || window.last_used < result->last_used) {
+			result = &window;
+		}
+	}
+	return result;
+}
+
+// Helper: Fill a window that was marked loading (with its row range set) under cache_lock.
+// The read runs without cache_lock so other columns and windows stay usable meanwhile.
+static void FillCacheWindow(CacheWindow &window, const RegularColumnState &state, H5ReadGlobalState &gstate,
+                            const RegularColumnSpec &spec, const string &filename) {
+	H5RecordScanStat(H5ScanCounter::CACHE_WINDOW_FILLS);
+	try {
+		auto rows_to_read = window.end_row - window.start_row;
+		if (spec.is_string) {
+			ReadIntoStringCache(window, state, gstate, window.start_row, rows_to_read, spec, filename);
+		} else {
+			ReadIntoTypedCache(window, state, gstate, window.start_row, rows_to_read, spec, filename);
+		}
+	} catch (...) {
+		{
+			std::lock_guard<std::mutex> guard(gstate.cache_lock);
+			window.loading = false;
+			window.end_row = 0;
+		}
+		SignalCacheProgress(gstate);
+		throw;
+	}
+	{
+		std::lock_guard<std::mutex> guard(gstate.cache_lock);
+		window.loading = false;
+	}
+	SignalCacheProgress(gstate);
+}
+
+// A claimed (loading) cache window together with the column it belongs to.
+struct PlannedWindowFill {
+	const RegularColumnSpec *spec;
+	const RegularColumnState *state;
+	CacheWindow *window;
+};
+
+// Helper: Append the file byte ranges holding rows [row_start, row_end) of a cached column: the covering slice of a
+// contiguous dataset, or every allocated chunk intersecting the rows and the h5_slice() selection. Stops once
+// chunk_budget lookups were made. Caller must hold hdf5_global_mutex.
+static void AppendPlannedReadRanges(const RegularColumnSpec &spec, const RegularColumnState &state, idx_t row_start,
+                                    idx_t row_end, idx_t &chunk_budget, vector<H5RemoteByteRange> &ranges) {
+	const auto &plan = *state.read_plan;
+	if (!plan.chunked) {
+		ranges.push_back({static_cast<idx_t>(plan.address) + row_start * plan.stored_row_bytes,
+		                  (row_end - row_start) * plan.stored_row_bytes});
+		return;
+	}
+	// Chunk grid origin and exclusive end of the selected elements in every inner dimension.
+	std::vector<hsize_t> grid_start(spec.ndims, 0);
+	std::vector<hsize_t> grid_end(spec.stored_dims);
+	if (spec.IsSliced()) {
+		for (int dim = 1; dim < spec.ndims; dim++) {
+			grid_start[dim] = spec.slice_start[dim] / plan.chunk_dims[dim] * plan.chunk_dims[dim];
+			grid_end[dim] = spec.slice_start[dim] + (spec.dims[dim] - 1) * spec.slice_stride[dim] + 1;
+		}
+	}
+	H5ErrorSuppressor suppress;
+	std::vector<hsize_t> offset(grid_start);
+	for (hsize_t chunk_row = row_start / plan.chunk_dims[0] * plan.chunk_dims[0]; chunk_row < row_end;
+	     chunk_row += plan.chunk_dims[0]) {
+		offset[0] = chunk_row;
+		// Walk the chunk grid of the remaining dimensions like an odometer.
+		while (true) {
+			if (chunk_budget == 0) {
+				return;
+			}
+			chunk_budget--;
+			unsigned filter_mask = 0;
+			haddr_t address = HADDR_UNDEF;
+			hsize_t stored_bytes = 0;
+			if (H5Dget_chunk_info_by_coord(state.dataset.get(), offset.data(), &filter_mask, &address,
+			                               &stored_bytes) >= 0 &&
+			    address != HADDR_UNDEF && stored_bytes > 0) {
+				ranges.push_back({static_cast<idx_t>(address), static_cast<idx_t>(stored_bytes)});
+			}
+			int dim = spec.ndims - 1;
+			for (; dim >= 1; dim--) {
+				offset[dim] += plan.chunk_dims[dim];
+				if (offset[dim] < grid_end[dim]) {
+					break;
+				}
+				offset[dim] = grid_start[dim];
+			}
+			if (dim < 1) {
+				break;
+			}
+		}
+	}
+}
+
+// Helper: Hand the byte ranges of the windows about to be filled to the remote VFD, which fetches them with a few
+// large parallel requests so the many chunk reads inside H5Dread are served from memory. Planning is only an
+// optimization: I/O failures leave the reads to the VFD's regular path.
+static void PlanRemoteWindowReads(H5ReadGlobalState &gstate, const vector<PlannedWindowFill> &fills) {
+	if (!gstate.plan_remote_reads || fills.empty()) {
+		return;
+	}
+	try {
+		auto lock = H5LockForScan();
+		vector<H5RemoteByteRange> ranges;
+		idx_t chunk_budget = H5_READ_PLAN_MAX_CHUNKS;
+		for (const auto &fill : fills) {
+			if (fill.state->read_plan) {
+				// The window is claimed by this thread, so its row range is stable without cache_lock.
+				AppendPlannedReadRanges(*fill.spec, *fill.state, fill.window->start_row, fill.window->end_row,
+				                        chunk_budget, ranges);
+			}
+		}
+		H5RemoteVFD::Prefetch(gstate.file.get(), std::move(ranges));
+	} catch (const IOException &) {
+		// Covers HTTPException too. Interrupts and internal errors still propagate.
+	}
+}
+
+// Helper: Claim window for the rows past the furthest cached row if all of its rows have been returned or
+// skipped. Sets exhausted when every remaining valid row is already cached. Caller must hold gstate.cache_lock.
+static bool TryClaimReadAheadWindow(RegularColumnCache &cache, CacheWindow &window, idx_t position_done_value,
+                                    const std::vector<RowRange> &valid_row_ranges, idx_t total_rows,
+                                    bool &exhausted) {
+	if (window.loading || window.pins > 0 || window.end_row > position_done_value) {
+		return false;
+	}
 	idx_t max_end_row = 0;
-	for (idx_t i = 0; i < window_count; i++) {
-		auto &window = cache.windows[i];
-		auto end_row = window.end_row.load(std::memory_order_acquire);
-		max_end_row = end_row > max_end_row ? end_row : max_end_row;
+	for (const auto &other : cache.windows) {
+		max_end_row = MaxValue<idx_t>(max_end_row, other.end_row);
+	}
+	auto next_range = NextRangeFrom(valid_row_ranges, max_end_row);
+	if (!next_range.has_data) {
+		exhausted = true;
+		return false;
 	}
-	auto position_done_value = position_done.load(std::memory_order_acquire);
-	for (idx_t i = 0; i < window_count; i++) {
-		auto &window = cache.windows[i];
-		if (window.end_row.load(std::memory_order_acquire) <= position_done_value) {
-			// Every row in this window has been returned or skipped, so it can be reused.
-			auto next_range = NextRangeFrom(valid_row_ranges, max_end_row);
-			if (next_range.has_data) {
-				idx_t rows_to_load = std::min(cache.window_rows, total_rows - next_range.position);
-				ReadIntoTypedCache(window.cache, dataset_id, file_space_id, next_range.position, rows_to_load, spec,
-				                   filename);
+	window.start_row = next_range.position;
+	window.end_row = next_range.position + MinValue<idx_t>(cache.window_rows, total_rows - next_range.position);
+	window.loading = true;
+	return true;
+}
 
-				idx_t new_end = next_range.position + cache.window_rows;
-				window.end_row.store(new_end, std::memory_order_release);
+// Helper: Prefetch windows past the furthest cached row into windows whose rows have all been
+// returned or skipped. This is only read-ahead; a scan call never waits for it. With planned
+// remote reads the windows are only claimed here and filled by FillPlannedWindows. Counts the
+// claimed windows in windows_claimed. Returns false once every remaining valid row of the column
+// has had a window claimed for it.
+static bool TryLoadCacheWindows(RegularColumnCache &cache, const RegularColumnState &state, H5ReadGlobalState &gstate,
+                                vector<PlannedWindowFill> &planned_fills, idx_t &windows_claimed) {
+	const auto &spec = cache.spec;
+	auto position_done_value = gstate.position_done.load(std::memory_order_acquire);
+	for (auto &window : cache.windows) {
+		{
+			std::lock_guard<std::mutex> guard(gstate.cache_lock);
+			bool exhausted = false;
+			if (!TryClaimReadAheadWindow(cache, window, position_done_value, gstate.valid_row_ranges, gstate.num_rows,
+			                             exhausted)) {
+				if (exhausted) {
+					return false;
+				}
+				continue;
+			}
+		}
+		windows_claimed++;
+		if (gstate.plan_remote_reads) {
+			planned_fills.push_back({&spec, &state, &window});
+			continue;
+		}
+		FillCacheWindow(window, state, gstate, spec, gstate.filename);
+	}
+	return true;
+}
 
-				max_end_row = new_end;
+// Helper: Plan the remote reads of every claimed window at once, then fill them in order. Windows
+// that were never started are released if a fill fails.
+static void FillPlannedWindows(H5ReadGlobalState &gstate, const vector<PlannedWindowFill> &fills,
+                               const string &filename) {
+	idx_t next_unstarted = 0;
+	try {
+		PlanRemoteWindowReads(gstate, fills);
+		while (next_unstarted < fills.size()) {
+			auto &fill = fills[next_unstarted++];
+			FillCacheWindow(*fill.window, *fill.state, gstate, *fill.spec, filename);
+		}
+	} catch (...) {
+		{
+			std::lock_guard<std::mutex> guard(gstate.cache_lock);
+			for (idx_t i = next_unstarted; i < fills.size(); i++) {
+				fills[i].window->loading = false;
+				fills[i].window->end_row = 0;
 			}
 		}
+		SignalCacheProgress(gstate);
+		throw;
 	}
 }
 
-static void FinishCacheFetch(H5ReadGlobalState &gstate) {
+// A refresh that claimed no window changed nothing other threads wait for, so it does not wake them. The prefetch
+// task relies on this to sleep until scan threads make progress.
+static void FinishCacheFetch(H5ReadGlobalState &gstate, bool signal) {
 	gstate.someone_is_fetching.store(false);
-	gstate.someone_is_fetching.notify_all();
+	if (signal) {
+		SignalCacheProgress(gstate);
+	}
 }
 
-static void TryRefreshCache(H5ReadGlobalState &gstate, const H5ReadSingleFileBindView &bind_data) {
+// Helper: Refresh the cache windows of every cached column. Returns false once no column has rows left to read
+// ahead.
+static bool TryRefreshCache(H5ReadGlobalState &gstate) {
 	bool expected = false;
-	if (gstate.someone_is_fetching.compare_exchange_strong(expected, true)) {
+	if (!gstate.someone_is_fetching.compare_exchange_strong(expected, true)) {
 		// Exactly one thread refreshes cache windows at a time. Other threads return
 		// immediately here and only block later if the windows covering their read
 		// range are still not available.
-		try {
-			for (auto local_idx : gstate.cache_refresh_order) {
-				GlobalColumnIdx global_idx = GetGlobalIdx(gstate, local_idx);
-				const auto &spec = std::get<RegularColumnSpec>(bind_data.columns[global_idx]);
-				auto &state = std::get<RegularColumnState>(gstate.column_states[local_idx]);
-				D_ASSERT(state.cache);
+		return true;
+	}
+	vector<PlannedWindowFill> planned_fills;
+	bool has_more = false;
+	idx_t windows_claimed = 0;
+	try {
+		for (auto local_idx : gstate.cache_refresh_order) {
+			auto &state = std::get<RegularColumnState>(gstate.column_states[local_idx]);
+			D_ASSERT(state.cache);
+			has_more |= TryLoadCacheWindows(*state.cache, state, gstate, planned_fills, windows_claimed);
+		}
+		FillPlannedWindows(gstate, planned_fills, gstate.filename);
+	} catch (...) {
+		FinishCacheFetch(gstate, true);
+		throw;
+	}
+	// Done loading - release the flag so another thread can load next time
+	FinishCacheFetch(gstate, windows_claimed > 0);
+	return has_more;
+}
 
-				TryLoadCacheWindows(*state.cache, state.dataset.get(), state.file_space.get(), gstate.valid_row_ranges,
-				                    gstate.position_done, bind_data.num_rows, spec, bind_data.filename);
+// Body of the prefetch task: refresh the windows whenever scan threads have consumed rows or released windows,
+// until every cached column has been read ahead to its end or the file state is destroyed. Refreshes that fill
+// windows bump fetch_signal themselves, so the task only sleeps after a refresh that found nothing to do.
+static void RunCachePrefetch(H5ReadGlobalState &gstate) {
+	H5ScanStatsScope stats_scope(gstate.prefetch_stats);
+	try {
+		while (!gstate.prefetch_stop.load(std::memory_order_acquire)) {
+			auto fetch_signal = gstate.fetch_signal.load(std::memory_order_acquire);
+			if (!TryRefreshCache(gstate)) {
+				break;
 			}
-		} catch (...) {
-			FinishCacheFetch(gstate);
-			throw;
+			gstate.fetch_signal.wait(fetch_signal, std::memory_order_acquire);
 		}
-		// Done loading - release the flag so another thread can load next time
-		FinishCacheFetch(gstate);
+	} catch (...) {
+		// Read-ahead is only an optimization. Scan threads load the windows they miss themselves and report the
+		// error with its context there.
+	}
+	gstate.prefetch_running.store(false, std::memory_order_release);
+	SignalCacheProgress(gstate);
+}
+
+// Starts the prefetch task of a file with cached columns. Must run without hdf5_global_mutex held, since the task
+// takes it for every window fill. The task runs on its own thread, outside DuckDB's scheduler, so it is opt-in and
+// never started when the connection runs single-threaded.
+static void StartCachePrefetch(ClientContext &context, H5ReadGlobalState &gstate, shared_ptr<H5ScanStats> stats) {
+	if (gstate.cache_refresh_order.empty() || !ResolveCachePrefetchOption(context) ||
+	    TaskScheduler::GetScheduler(context).NumberOfThreads() <= 1) {
+		return;
+	}
+	gstate.prefetch_stats = std::move(stats);
+	gstate.prefetch_running.store(true, std::memory_order_release);
+	try {
+		gstate.prefetch_task = std::async(std::launch::async, [&gstate]() { RunCachePrefetch(gstate); });
+	} catch (...) {
+		// Without a thread for the task, scan threads read ahead themselves as before.
+		gstate.prefetch_running.store(false, std::memory_order_release);
 	}
 }
 
+// Helper: Read ahead from a scan thread, unless the prefetch task does it for every thread.
+static void RefreshCacheFromScan(H5ReadGlobalState &gstate) {
+	if (!gstate.prefetch_running.load(std::memory_order_acquire)) {
+		TryRefreshCache(gstate);
+	}
+}
+
+static void RecordUncachedZoneMapStats(const RegularColumnState &state, const LogicalType &base_type,
+                                       const_data_ptr_t data, idx_t position, idx_t to_read) {
+	if (!state.zone_map) {
+		return;
+	}
+	DispatchOnNumericType(base_type, [&](auto type_tag) {
+		using T = typename decltype(type_tag)::type;
+		RecordZoneMapStats(*state.zone_map, reinterpret_cast<const T *>(data), position, to_read);
+	});
+}
+
 // Helper function to scan a regular dataset column
 static void ScanRegularColumn(ClientContext &context, const RegularColumnSpec &spec, RegularColumnState &state,
                               Vector &result_vector, idx_t position, idx_t to_read,
@@ -2202,58 +4660,99 @@ static void ScanRegularColumn(ClientContext &context, const RegularColumnSpec &s
 
 	if (state.cache) {
 		auto &cache = *state.cache;
-		auto window_count = ComputeCacheWindowCount(cache.window_rows, bind_data.num_rows);
 
-		auto *window1 = &cache.windows[0];
-		CacheWindow *window2 = window_count > 1 ? &cache.windows[1] : nullptr;
-		for (;;) {
+		// Copy [position, position + to_read) window by window. At most one window is pinned at a
+		// time and only while copying, so waiting here never blocks another thread's progress.
+		idx_t row = position;
+		const idx_t row_end = position + to_read;
+		while (row < row_end) {
 			ThrowIfInterrupted(context);
 
-			TryRefreshCache(gstate, bind_data);
-
-			idx_t end1 = window1->end_row.load(std::memory_order_acquire);
-			idx_t end2 = window2 ? window2->end_row.load(std::memory_order_acquire) : end1;
-
-			if (window2 && end1 > end2) {
-				std::swap(window1, window2);
-				std::swap(end1, end2);
-			}
-
-			if (position + to_read <= end2) {
-				break;
+			auto fetch_signal = gstate.fetch_signal.load(std::memory_order_acquire);
+			RefreshCacheFromScan(gstate);
+
+			CacheWindow *window = nullptr;
+			bool fill = false;
+			{
+				std::lock_guard<std::mutex> guard(gstate.cache_lock);
+				auto *found = FindCacheWindow(cache, row);
+				if (found && !found->loading) {
+					window = found;
+					window->pins++;
+					window->last_used = ++gstate.cache_use_tick;
+				} else if (!found) {
+					// Cache miss (e.g. a partition resumed after read-ahead moved on): load the
+					// window-aligned rows around row ourselves.
+					window = PickCacheWindowToFill(cache);
+					if (window) {
+						auto window_start = row - row % cache.window_rows;
+						window->start_row = window_start;
+						window->end_row = MinValue<idx_t>(window_start + cache.window_rows, bind_data.num_rows);
+						window->loading = true;
+						fill = true;
+					}
+				}
 			}
 
-			if (gstate.someone_is_fetching.load(std::memory_order_acquire)) {
-				gstate.someone_is_fetching.wait(true, std::memory_order_relaxed);
+			if (fill) {
+				PlanRemoteWindowReads(gstate, {{&spec, &state, window}});
+				FillCacheWindow(*window, state, gstate, spec, bind_data.filename);
+				continue;
 			}
-		}
-
-		// Copy data from windows that overlap our read range [position, position + to_read)
-		for (auto *window : {window1, window2}) {
 			if (!window) {
+				// The row is being loaded, or every window is pinned or loading. Decode chunks for
+				// the loading thread instead of idling behind it.
+				HelpPendingChunkDecode(gstate);
+				auto wait_start = std::chrono::steady_clock::now();
+				gstate.fetch_signal.wait(fetch_signal, std::memory_order_acquire);
+				H5RecordScanStat(H5ScanCounter::FETCH_WAITS);
+				H5RecordScanStat(H5ScanCounter::FETCH_WAIT_NANOS, H5ScanStatsElapsedNanos(wait_start));
 				continue;
 			}
-			idx_t window_end = window->end_row.load(std::memory_order_acquire);
-			idx_t window_start = (window_end > cache.window_rows) ? (window_end - cache.window_rows) : 0;
-
-			if (window_start < position + to_read && window_end > position) {
-				idx_t overlap_start = MaxValue<idx_t>(window_start, position);
-				idx_t overlap_end = MinValue<idx_t>(window_end, position + to_read);
-				idx_t overlap_size = overlap_end - overlap_start;
 
-				idx_t window_offset = overlap_start - window_start;
-				idx_t result_offset = overlap_start - position;
-				D_ASSERT(window_offset + overlap_size <= cache.window_rows);
-
-				CopyFromTypedCache(window->cache, window_offset, overlap_size, target_vector, result_offset, base_type,
-				                   spec.elements_per_row);
+			idx_t copy_end = MinValue<idx_t>(row_end, window->end_row);
+			if (spec.is_string && window->dictionary && row == position && copy_end == row_end) {
+				// The whole batch comes from one dictionary-mode window
+				SliceFromStringDictionary(*window, row - window->start_row, to_read, target_vector);
+			} else if (spec.is_string) {
+				CopyFromStringCache(*window, *gstate.buffer_manager, row - window->start_row, copy_end - row,
+				                    target_vector, row - position);
+			} else {
+				CopyFromTypedCache(*window, row - window->start_row, copy_end - row, target_vector, row - position,
+				                   base_type, spec.elements_per_row);
+			}
+			bool unpinned;
+			{
+				std::lock_guard<std::mutex> guard(gstate.cache_lock);
+				unpinned = --window->pins == 0;
+			}
+			if (unpinned) {
+				// Threads waiting for a window to refill may be able to use this one now.
+				SignalCacheProgress(gstate);
 			}
+			row = copy_end;
 		}
+		MarkInvalidEnumCodesNull(spec, target_vector, to_read);
 
 		return; // Done with cached read
 	}
 
-	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	if (!spec.is_string) {
+		auto target = DispatchOnNumericType(base_type, [&](auto type_tag) {
+			using T = typename decltype(type_tag)::type;
+			return reinterpret_cast<data_ptr_t>(FlatVector::GetData<T>(target_vector));
+		});
+		if (TryReadContiguousDirect(state, gstate, position, to_read, target) ||
+		    TryReadChunkDirect(state, position, to_read, target, nullptr)) {
+			ApplyRegularColumnConversion(spec, state, target, to_read);
+			RecordUncachedZoneMapStats(state, base_type, target, position, to_read);
+			MarkInvalidEnumCodesNull(spec, target_vector, to_read);
+			return;
+		}
+	}
+
+	auto lock = H5LockForScan();
+	H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
 
 	// Non-cached path: direct HDF5 read for uncached data types/layouts.
 	// Access RAII-wrapped handles from state
@@ -2265,13 +4764,14 @@ static void ScanRegularColumn(ClientContext &context, const RegularColumnSpec &s
 
 	// Read data based on type
 	if (spec.is_string) {
-		D_ASSERT(spec.string_h5_type.has_value());
+		D_ASSERT(spec.string_h5_type.has_value() && state.string_info);
 		// Handle string data using helper
-		ReadHDF5Strings(dataset_id, *spec.string_h5_type, mem_space, file_space, to_read, bind_data.filename, spec.path,
-		                [&](idx_t i, const std::string &str) {
-			                FlatVector::GetData<string_t>(target_vector)[i] =
-			                    StringVector::AddString(target_vector, str);
-		                });
+		auto result_data = FlatVector::GetData<string_t>(target_vector);
+		ReadHDF5StringViews(dataset_id, RegularColumnReadType(spec, *spec.string_h5_type), *state.string_info,
+		                    mem_space, file_space, to_read, bind_data.filename, spec.path,
+		                    [&](idx_t i, const char *data, idx_t size) {
+			                    result_data[i] = StringVector::AddString(target_vector, data, size);
+		                    });
 
 	} else {
 		// Handle numeric data
@@ -2279,7 +4779,8 @@ static void ScanRegularColumn(ClientContext &context, const RegularColumnSpec &s
 		herr_t status = DispatchOnNumericType(base_type, [&](auto type_tag) {
 			using T = typename decltype(type_tag)::type;
 			void *child_data = FlatVector::GetData<T>(target_vector);
-			return H5Dread(dataset_id, GetNativeH5Type<T>(), mem_space, file_space, H5P_DEFAULT, child_data);
+			return H5Dread(dataset_id, RegularColumnNumericReadType(spec, state, GetNativeH5Type<T>()), mem_space,
+			               file_space, H5P_DEFAULT, child_data);
 		});
 
 		if (status < 0) {
@@ -2287,9 +4788,77 @@ static void ScanRegularColumn(ClientContext &context, const RegularColumnSpec &s
 		}
 	}
 
+	if (!spec.is_string) {
+		// Conversion and min/max scanning do not touch HDF5, so they run after releasing the lock.
+		lock.unlock();
+		ApplyRegularColumnConversion(spec, state, FlatVector::GetData(target_vector), to_read);
+		RecordUncachedZoneMapStats(state, base_type, FlatVector::GetData(target_vector), position, to_read);
+		MarkInvalidEnumCodesNull(spec, target_vector, to_read);
+	}
+
 	// Note: file_space is cached and will be closed in destructor
 }
 
+// Scans a late-materialized column for the batch rows in runs (offsets from position) and marks the other rows NULL.
+// DuckDB re-applies the claimed filters above the scan, so those rows never reach the query. Batches where most rows
+// pass, or the runs are too fragmented, are read in full. Returns the rows whose values were read.
+static idx_t ScanLateRegularColumn(ClientContext &context, const RegularColumnSpec &spec, RegularColumnState &state,
+                                   Vector &result_vector, idx_t position, idx_t to_read, const vector<RowRange> &runs,
+                                   idx_t matched_rows, const H5ReadSingleFileBindView &bind_data,
+                                   H5ReadGlobalState &gstate) {
+	if (matched_rows == to_read || matched_rows * 2 > to_read || runs.size() > H5_READ_LATE_MAX_RUNS) {
+		ScanRegularColumn(context, spec, state, result_vector, position, to_read, bind_data, gstate);
+		return to_read;
+	}
+	ThrowIfInterrupted(context);
+	H5RecordScanStat(H5ScanCounter::LATE_ROWS_SKIPPED, to_read - matched_rows);
+
+	auto &validity = FlatVector::Validity(result_vector);
+	validity.SetAllInvalid(to_read);
+	for (const auto &run : runs) {
+		for (idx_t row = run.start_row; row < run.end_row; row++) {
+			validity.SetValid(row);
+		}
+	}
+	auto &target_vector = PrepareRegularResultVector(result_vector, spec, to_read, bind_data.filename);
+	if (runs.empty()) {
+		return 0;
+	}
+
+	auto base_type = GetBaseType(spec.column_type);
+	auto target = DispatchOnNumericType(base_type, [&](auto type_tag) {
+		using T = typename decltype(type_tag)::type;
+		return reinterpret_cast<data_ptr_t>(FlatVector::GetData<T>(target_vector));
+	});
+	if (state.contiguous_direct && gstate.direct_file) {
+		// Runs are read in their stored layout, so conversion below finds them where a full read would leave them.
+		const auto row_bytes = state.contiguous_direct->row_bytes;
+		for (const auto &run : runs) {
+			TryReadContiguousDirect(state, gstate, position + run.start_row, run.end_row - run.start_row,
+			                        target + run.start_row * row_bytes);
+		}
+	} else {
+		auto lock = H5LockForScan();
+		H5RecordScanStat(H5ScanCounter::H5DREAD_CALLS);
+		hid_t file_space = state.file_space.get();
+		H5DataspaceHandle mem_space = CreateMemspaceAndSelectRuns(file_space, spec, position, to_read, runs);
+
+		H5ErrorSuppressor suppress;
+		herr_t status = DispatchOnNumericType(base_type, [&](auto type_tag) {
+			using T = typename decltype(type_tag)::type;
+			return H5Dread(state.dataset.get(), RegularColumnNumericReadType(spec, state, GetNativeH5Type<T>()),
+			               mem_space, file_space, H5P_DEFAULT, target);
+		});
+		if (status < 0) {
+			throw IOException(FormatRemoteDatasetReadError(bind_data.filename, spec.path));
+		}
+	}
+	// Rows between the runs hold whatever the vector held before; converting them is harmless as they are NULL.
+	ApplyRegularColumnConversion(spec, state, target, to_read);
+	MarkInvalidEnumCodesNull(spec, target_vector, to_read);
+	return matched_rows;
+}
+
 // Helper function to scan a scalar dataset column (broadcast cached value)
 static void ScanScalarColumn(const ScalarColumnState &state, Vector &result_vector, idx_t to_read) {
 	if (to_read == 0) {
@@ -2311,24 +4880,110 @@ static void ScanScalarColumn(const ScalarColumnState &state, Vector &result_vect
 	    state.value);
 }
 
+template <class T, class OP>
+static void ApplyTypedLateFilter(const Vector &column, const T &constant, idx_t count, uint8_t *passes) {
+	auto data = FlatVector::GetData<T>(column);
+	auto &validity = FlatVector::Validity(column);
+	for (idx_t row = 0; row < count; row++) {
+		passes[row] = passes[row] && validity.RowIsValid(row) && OP::Operation(data[row], constant);
+	}
+}
+
+template <class T>
+static void ApplyTypedLateFilter(const Vector &column, ExpressionType comparison, const T &constant, idx_t count,
+                                 uint8_t *passes) {
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		return ApplyTypedLateFilter<T, Equals>(column, constant, count, passes);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return ApplyTypedLateFilter<T, GreaterThan>(column, constant, count, passes);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return ApplyTypedLateFilter<T, GreaterThanEquals>(column, constant, count, passes);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return ApplyTypedLateFilter<T, LessThan>(column, constant, count, passes);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return ApplyTypedLateFilter<T, LessThanEquals>(column, constant, count, passes);
+	default:
+		// Claimed comparisons are limited to the above; keep every row for anything else.
+		return;
+	}
+}
+
+// Evaluates the late filters on the batch's already scanned 1-D columns and returns the runs of passing rows as
+// offsets from the start of the batch. Rows a filter cannot decide on stay in, DuckDB's own filter settles them.
+static vector<RowRange> FindLateFilterMatches(const H5ReadGlobalState &gstate, const DataChunk &output, idx_t to_read,
+                                              idx_t &matched_rows) {
+	std::vector<uint8_t> passes(to_read, 1);
+	for (const auto &late_filter : gstate.late_filters) {
+		const auto &filter = late_filter.filter;
+		auto &column = output.data[gstate.output_column_positions[late_filter.local_idx]];
+		if (late_filter.typed) {
+			DispatchOnNumericType(column.GetType(), [&](auto type_tag) {
+				using T = typename decltype(type_tag)::type;
+				ApplyTypedLateFilter<T>(column, filter.comparison, filter.constant.GetValue<T>(), to_read,
+				                        passes.data());
+			});
+			continue;
+		}
+		for (idx_t row = 0; row < to_read; row++) {
+			if (passes[row]) {
+				passes[row] = EvaluateValueComparison(column.GetValue(row), filter.comparison, filter.constant,
+				                                      filter.comparison_type) != H5ReadFilterEvalResult::FALSE;
+			}
+		}
+	}
+
+	vector<RowRange> runs;
+	matched_rows = 0;
+	idx_t row = 0;
+	while (row < to_read) {
+		if (!passes[row]) {
+			row++;
+			continue;
+		}
+		auto run_start = row;
+		while (row < to_read && passes[row]) {
+			row++;
+		}
+		runs.push_back({run_start, row});
+		matched_rows += row - run_start;
+	}
+	return runs;
+}
+
+// Scan the next batch of the local state's partition, claiming a new partition once it is
+// exhausted. Produces an empty chunk when the file has no rows left to claim.
 static void H5ReadSingleFileScan(ClientContext &context, const H5ReadSingleFileBindView &bind_data,
-                                 H5ReadGlobalState &gstate, DataChunk &output) {
+                                 H5ReadGlobalState &gstate, H5ReadPartition &partition, DataChunk &output) {
 	ThrowIfInterrupted(context);
 
-	auto range_selection = ClaimNextRange(gstate, bind_data.num_rows);
-	if (!range_selection.has_data) {
-		output.SetCardinality(0);
-		return;
+	RangeSelection range_selection {false, 0, 0};
+	while (true) {
+		range_selection = NextRangeFrom(gstate.valid_row_ranges, partition.position, partition.position_end,
+		                                gstate.scan_batch_size);
+		if (range_selection.has_data) {
+			break;
+		}
+		if (!ClaimNextPartition(gstate, bind_data.num_rows, partition)) {
+			output.SetCardinality(0);
+			return;
+		}
 	}
 
 	idx_t position = range_selection.position;
 	idx_t to_read = range_selection.to_read;
+	partition.position = position + to_read;
 
 	// Process only scanned columns (projection pushdown)
 	// Uses LOCAL indexing - both output.data and column_states are indexed [0, 1, 2...]
+	// Late-materialized columns wait until the late filters have run on the other columns.
+	const bool has_late_columns = !gstate.late_filters.empty();
 	for (idx_t i = 0; i < GetNumScannedColumns(gstate); i++) {
 		LocalColumnIdx local_idx(i);
 		GlobalColumnIdx global_idx = GetGlobalIdx(gstate, local_idx);
+		if (has_late_columns && IsLateMaterializedColumn(gstate, local_idx)) {
+			continue;
+		}
 
 		auto &result_vector = output.data[gstate.output_column_positions[i]];
 		const auto &col_spec = bind_data.columns[global_idx]; // Global schema
@@ -2343,7 +4998,7 @@ static void H5ReadSingleFileScan(ClientContext &context, const H5ReadSingleFileB
 			    if constexpr (std::is_same_v<SpecT, RunEncodedColumnSpec> &&
 			                  std::is_same_v<StateT, RunEncodedColumnState>) {
 				    // Run-encoded column - call helper function
-				    ScanRunEncodedColumn(spec, state, result_vector, position, to_read);
+				    ScanRunEncodedColumn(bind_data.filename, spec, state, result_vector, position, to_read);
 
 			    } else if constexpr (std::is_same_v<SpecT, ScalarColumnSpec> &&
 			                         std::is_same_v<StateT, ScalarColumnState>) {
@@ -2354,48 +5009,246 @@ static void H5ReadSingleFileScan(ClientContext &context, const H5ReadSingleFileB
 			                         std::is_same_v<StateT, RegularColumnState>) {
 				    // Regular dataset - call helper function
 				    ScanRegularColumn(context, spec, state, result_vector, position, to_read, bind_data, gstate);
+				    H5RecordScanStat(H5ScanCounter::BYTES_RETURNED, RegularColumnReturnedBytes(spec, to_read));
 			    } else if constexpr (std::is_same_v<SpecT, IndexColumnSpec> &&
 			                         std::is_same_v<StateT, IndexColumnState>) {
 				    // Virtual index column - sequence vector
-				    result_vector.Sequence(static_cast<int64_t>(position), 1, to_read);
+				    auto first_index = (spec.global ? bind_data.row_base : bind_data.index_base) + position;
+				    result_vector.Sequence(static_cast<int64_t>(first_index), 1, to_read);
 			    }
 		    },
 		    col_spec, col_state);
 	}
 
+	if (has_late_columns) {
+		idx_t matched_rows = 0;
+		auto runs = FindLateFilterMatches(gstate, output, to_read, matched_rows);
+		for (idx_t i = 0; i < GetNumScannedColumns(gstate); i++) {
+			LocalColumnIdx local_idx(i);
+			if (!IsLateMaterializedColumn(gstate, local_idx)) {
+				continue;
+			}
+			const auto &spec = std::get<RegularColumnSpec>(bind_data.columns[GetGlobalIdx(gstate, local_idx)]);
+			auto &state = std::get<RegularColumnState>(gstate.column_states[local_idx]);
+			auto &result_vector = output.data[gstate.output_column_positions[i]];
+			auto rows_read = ScanLateRegularColumn(context, spec, state, result_vector, position, to_read, runs,
+			                                       matched_rows, bind_data, gstate);
+			H5RecordScanStat(H5ScanCounter::BYTES_RETURNED, RegularColumnReturnedBytes(spec, rows_read));
+		}
+	}
+
 	output.SetCardinality(to_read);
 	if (!gstate.cache_refresh_order.empty()) {
 		MarkRangeComplete(gstate, position, to_read);
 	}
 }
 
-static void SetCurrentH5ReadFile(ClientContext &context, const H5ReadBindData &bind_data,
-                                 H5ReadMultiFileGlobalState &gstate, idx_t file_idx) {
-	gstate.current_file = InitSingleH5ReadState(context, GetSingleFileBindView(bind_data, file_idx),
-	                                            gstate.data_column_ids, gstate.data_output_column_positions);
-	gstate.current_file_idx = file_idx;
+static shared_ptr<H5ReadGlobalState> OpenH5ReadFile(ClientContext &context, const H5ReadBindData &bind_data,
+                                                     const H5ReadMultiFileGlobalState &gstate, idx_t file_idx) {
+	unique_ptr<H5ReadSingleFileBindData> lazy_bind_data;
+	if (!bind_data.file_bind_data[file_idx].bound) {
+		lazy_bind_data = make_uniq<H5ReadSingleFileBindData>(BindLazyH5ReadFile(context, bind_data, file_idx));
+	}
+	shared_ptr<H5ReadGlobalState> result;
+	result = InitSingleH5ReadState(context, GetSingleFileBindView(bind_data, file_idx, lazy_bind_data.get()),
+	                               gstate.data_column_ids, gstate.data_output_column_positions);
+	if (bind_data.file_bind_data[file_idx].virtual_block) {
+		H5RecordScanStat(H5ScanCounter::VIRTUAL_SOURCES_SCANNED);
+	}
+	if (lazy_bind_data) {
+		// Keep the file's partitions within the batch indexes reserved for it: partitions are made longer when the
+		// file turns out to have more of them.
+		auto batch_rows = MaxValue<idx_t>(result->scan_batch_size, 1);
+		auto min_partition_rows = (lazy_bind_data->num_rows + gstate.lazy_file_batches - 1) / gstate.lazy_file_batches;
+		if (result->partition_rows < min_partition_rows) {
+			result->partition_rows = (min_partition_rows + batch_rows - 1) / batch_rows * batch_rows;
+		}
+		result->lazy_bind_data = std::move(lazy_bind_data);
+	}
+	StartCachePrefetch(context, *result, gstate.stats);
+	return result;
+}
+
+static void AddOpenH5ReadFile(H5ReadMultiFileGlobalState &gstate, H5ReadOpenFile open_file) {
+	auto it = std::lower_bound(gstate.open_files.begin(), gstate.open_files.end(), open_file.file_idx,
+	                           [](const H5ReadOpenFile &entry, idx_t file_idx) { return entry.file_idx < file_idx; });
+	gstate.open_files.insert(it, std::move(open_file));
 }
 
-static void AttachLocalStateToCurrentFile(const H5ReadMultiFileGlobalState &gstate, H5ReadMultiFileLocalState &lstate) {
-	D_ASSERT(gstate.current_file);
-	lstate.file = gstate.current_file;
-	lstate.file_idx = gstate.current_file_idx;
+// Find an open file at or after min_file_idx that no local state has attached to yet. Local
+// states never move back to earlier files, so such a file must be joined before opening more.
+// Caller must hold gstate.file_queue_lock.
+static optional_ptr<H5ReadOpenFile> FindUnscannedOpenFile(H5ReadMultiFileGlobalState &gstate, idx_t min_file_idx) {
+	for (auto &open_file : gstate.open_files) {
+		if (open_file.file_idx >= min_file_idx && !open_file.has_scanner) {
+			return &open_file;
+		}
+	}
+	return nullptr;
 }
 
-static void AdvanceCurrentH5ReadFile(ClientContext &context, const H5ReadBindData &bind_data,
-                                     H5ReadMultiFileGlobalState &gstate, idx_t exhausted_file_idx) {
-	if (gstate.current_file_idx != exhausted_file_idx) {
-		return;
+// Pick an open file at or after min_file_idx for a local state to join, round-robin over the
+// eligible files. Caller must hold gstate.file_queue_lock.
+static optional_ptr<H5ReadOpenFile> PickOpenFileToJoin(H5ReadMultiFileGlobalState &gstate, idx_t min_file_idx) {
+	optional_ptr<H5ReadOpenFile> result;
+	idx_t eligible = 0;
+	for (auto &open_file : gstate.open_files) {
+		if (open_file.file_idx >= min_file_idx) {
+			eligible++;
+		}
+	}
+	if (eligible == 0) {
+		return nullptr;
+	}
+	auto pick = gstate.next_attach_idx++ % eligible;
+	for (auto &open_file : gstate.open_files) {
+		if (open_file.file_idx < min_file_idx) {
+			continue;
+		}
+		if (pick-- == 0) {
+			result = &open_file;
+			break;
+		}
+	}
+	return result;
+}
+
+// Attach a local scan state to a file with rows left to claim. Returns false once
+// every file it may still scan has been opened and exhausted.
+static bool AttachLocalStateToNextFile(ClientContext &context, const H5ReadBindData &bind_data,
+                                       H5ReadMultiFileGlobalState &gstate, H5ReadMultiFileLocalState &lstate) {
+	const auto file_count = gstate.scan_files.size();
+	std::unique_lock<std::mutex> lock(gstate.file_queue_lock);
+	while (true) {
+		if (auto open_file = FindUnscannedOpenFile(gstate, lstate.file_idx)) {
+			open_file->has_scanner = true;
+			lstate.file = open_file->state;
+			lstate.file_idx = open_file->file_idx;
+			return true;
+		}
+		auto files_in_flight = gstate.open_files.size() + gstate.files_opening;
+		auto join_file = PickOpenFileToJoin(gstate, lstate.file_idx);
+		// Exceed max_files_in_flight rather than wait when every open file precedes this local
+		// state's last file: that wait could only end once other local states finish their files,
+		// which DuckDB does not guarantee once the plan stops early.
+		if (gstate.next_file_idx < file_count && (files_in_flight < gstate.max_files_in_flight || !join_file)) {
+			// Open the next file outside the queue lock so other threads keep claiming
+			// rows from the files that are already open.
+			auto file_idx = gstate.scan_files[gstate.next_file_idx++];
+			gstate.files_opening++;
+			lock.unlock();
+			shared_ptr<H5ReadGlobalState> file;
+			try {
+				file = OpenH5ReadFile(context, bind_data, gstate, file_idx);
+			} catch (...) {
+				lock.lock();
+				gstate.files_opening--;
+				gstate.file_queue_cv.notify_all();
+				throw;
+			}
+			lock.lock();
+			gstate.files_opening--;
+			AddOpenH5ReadFile(gstate, {file_idx, file, true});
+			gstate.file_queue_cv.notify_all();
+			lstate.file = std::move(file);
+			lstate.file_idx = file_idx;
+			return true;
+		}
+		if (join_file) {
+			join_file->has_scanner = true;
+			lstate.file = join_file->state;
+			lstate.file_idx = join_file->file_idx;
+			return true;
+		}
+		if (gstate.files_opening == 0) {
+			D_ASSERT(gstate.next_file_idx >= file_count);
+			return false;
+		}
+		// Every in-flight file this local state may join is still being opened by another thread.
+		gstate.file_queue_cv.wait(lock);
 	}
+}
 
-	auto next_file_idx = exhausted_file_idx + 1;
-	if (next_file_idx >= bind_data.file_bind_data.size()) {
-		gstate.current_file.reset();
-		gstate.current_file_idx = next_file_idx;
+static void RetireH5ReadFile(H5ReadMultiFileGlobalState &gstate, idx_t exhausted_file_idx) {
+	// Dropping the last reference to a file state joins its prefetch task and closes its HDF5 handles, so it happens
+	// after file_queue_lock is released: threads attaching to other files must not wait behind it.
+	shared_ptr<H5ReadGlobalState> retired;
+	std::lock_guard<std::mutex> lock(gstate.file_queue_lock);
+	auto it = std::find_if(gstate.open_files.begin(), gstate.open_files.end(),
+	                       [&](const H5ReadOpenFile &entry) { return entry.file_idx == exhausted_file_idx; });
+	if (it == gstate.open_files.end()) {
+		// Another thread already retired this file.
 		return;
 	}
+	retired = std::move(it->state);
+	gstate.open_files.erase(it);
+	gstate.file_queue_cv.notify_all();
+}
+
+// Rows of one file that can pass the claimed filters on index columns. Index values only depend on
+// the row counts collected at bind, so this does not need to open the file.
+static vector<RowRange> BuildFileIndexRanges(const H5ReadBindData &bind_data, idx_t file_idx) {
+	auto &file_bind_data = bind_data.file_bind_data[file_idx];
+	unordered_map<idx_t, vector<ClaimedFilter>> filters_by_column;
+	for (const auto &filter : bind_data.claimed_filters) {
+		if (std::holds_alternative<IndexColumnSpec>(file_bind_data.columns[filter.column_index])) {
+			filters_by_column[filter.column_index].push_back(filter);
+		}
+	}
+
+	auto ranges = InitialRowRanges(H5ReadSinceFirstRow(bind_data, file_bind_data), file_bind_data.num_rows);
+	for (const auto &[column_index, col_filters] : filters_by_column) {
+		auto &index_spec = std::get<IndexColumnSpec>(file_bind_data.columns[column_index]);
+		auto row_base = index_spec.global ? bind_data.file_row_base[file_idx] : H5ReadFileIndexBase(file_bind_data);
+		ranges = IntersectRowRanges(ranges, BuildIndexRanges(col_filters, row_base, file_bind_data.num_rows));
+	}
+	return ranges;
+}
+
+// Pick the files a scan opens. A file is skipped when none of its rows pass the claimed index
+// filters, or when earlier scans returned all of its rows (since := ...). With a LIMIT directly above the scan, files
+// after the ones that together hold enough rows are skipped as well; rows are returned in file order, so the plan
+// never needs them.
+static vector<idx_t> SelectH5ReadScanFiles(const H5ReadBindData &bind_data) {
+	bool has_index_filters = false;
+	bool only_index_filters = true;
+	const auto &columns = GetCanonicalColumns(bind_data);
+	for (const auto &filter : bind_data.claimed_filters) {
+		auto is_index = std::holds_alternative<IndexColumnSpec>(columns[filter.column_index]);
+		has_index_filters |= is_index;
+		only_index_filters &= is_index;
+	}
+	// Other claimed filters drop rows that are only known once a file is read.
+	auto row_limit = only_index_filters ? bind_data.row_limit : std::nullopt;
 
-	SetCurrentH5ReadFile(context, bind_data, gstate, next_file_idx);
+	vector<idx_t> result;
+	idx_t selected_rows = 0;
+	for (idx_t file_idx = 0; file_idx < bind_data.file_bind_data.size(); file_idx++) {
+		if (row_limit && selected_rows >= *row_limit) {
+			break;
+		}
+		if (!bind_data.file_bind_data[file_idx].bound) {
+			// The row count is only known once the scan opens the file, so this and every later file is scanned.
+			D_ASSERT(!has_index_filters);
+			result.push_back(file_idx);
+			row_limit.reset();
+			continue;
+		}
+		auto &file_bind_data = bind_data.file_bind_data[file_idx];
+		idx_t file_rows = file_bind_data.num_rows;
+		if (has_index_filters || H5ReadSinceFirstRow(bind_data, file_bind_data) > 0) {
+			file_rows = 0;
+			for (const auto &range : BuildFileIndexRanges(bind_data, file_idx)) {
+				file_rows += range.end_row - range.start_row;
+			}
+			if (file_rows == 0) {
+				continue;
+			}
+		}
+		result.push_back(file_idx);
+		selected_rows += file_rows;
+	}
+	return result;
 }
 
 // Init function - initialize the first file in the multi-file scan wrapper.
@@ -2403,11 +5256,40 @@ static unique_ptr<GlobalTableFunctionState> H5ReadInit(ClientContext &context, T
 	ThrowIfInterrupted(context);
 	auto &bind_data = input.bind_data->Cast<H5ReadBindData>();
 	auto result = make_uniq<H5ReadMultiFileGlobalState>();
+	H5ScanStatsScope stats_scope(result->stats);
+	H5RecordScanStat(H5ScanCounter::SCANS);
 	BuildH5ReadProjectionLayout(bind_data, input.column_ids, result->data_column_ids,
 	                            result->data_output_column_positions, result->filename_output_positions,
 	                            result->empty_output_positions);
 	D_ASSERT(!bind_data.file_bind_data.empty());
-	SetCurrentH5ReadFile(context, bind_data, *result, 0);
+	result->max_files_in_flight = ResolveMaxFilesInFlightOption(context);
+	idx_t bound_batches = 0;
+	idx_t lazy_file_count = 0;
+	for (auto &file_bind_data : bind_data.file_bind_data) {
+		if (file_bind_data.bound) {
+			bound_batches += MaxValue<idx_t>(file_bind_data.num_rows, 1);
+		} else {
+			lazy_file_count++;
+		}
+	}
+	if (lazy_file_count > 0) {
+		// Lazily bound files share the batch indexes left below H5_READ_MAX_BATCH_INDEX evenly, see OpenH5ReadFile.
+		auto free_batches = H5_READ_MAX_BATCH_INDEX > bound_batches ? H5_READ_MAX_BATCH_INDEX - bound_batches : 0;
+		result->lazy_file_batches = MaxValue<idx_t>(free_batches / lazy_file_count, 1);
+	}
+	idx_t batch_base = 0;
+	for (auto &file_bind_data : bind_data.file_bind_data) {
+		result->file_batch_base.push_back(batch_base);
+		batch_base += file_bind_data.bound ? MaxValue<idx_t>(file_bind_data.num_rows, 1) : result->lazy_file_batches;
+	}
+	result->scan_files = SelectH5ReadScanFiles(bind_data);
+	if (result->scan_files.empty()) {
+		return result;
+	}
+	// Open the first file eagerly so that errors in it surface during initialization.
+	auto first_file_idx = result->scan_files[0];
+	AddOpenH5ReadFile(*result, {first_file_idx, OpenH5ReadFile(context, bind_data, *result, first_file_idx)});
+	result->next_file_idx = 1;
 	return result;
 }
 
@@ -2424,7 +5306,7 @@ static void H5ReadPopulateFilenameColumns(const H5ReadBindData &bind_data, idx_t
 	if (gstate.filename_output_positions.empty()) {
 		return;
 	}
-	auto &filename = bind_data.file_bind_data[file_idx].filename;
+	auto &filename = H5ReadOutputFilename(bind_data.file_bind_data[file_idx]);
 	for (auto output_idx : gstate.filename_output_positions) {
 		auto &vector = output.data[output_idx];
 		vector.SetVectorType(VectorType::CONSTANT_VECTOR);
@@ -2448,38 +5330,46 @@ static void H5ReadScan(ClientContext &context, TableFunctionInput &data, DataChu
 	auto &bind_data = data.bind_data->Cast<H5ReadBindData>();
 	auto &gstate = data.global_state->Cast<H5ReadMultiFileGlobalState>();
 	auto &lstate = data.local_state->Cast<H5ReadMultiFileLocalState>();
+	H5ScanStatsScope stats_scope(gstate.stats);
 
 	// A local scan state stays attached to one file across repeated scan calls.
-	// When that file reaches EOF, it advances the current file if nobody else
-	// has already done so. Other threads that still hold older file states can
-	// finish their claimed ranges while new threads move on.
+	// When that file reaches EOF, it is retired from the work queue and the local
+	// state moves on to another open file or opens the next one. Other threads that
+	// still hold the retired file state can finish their claimed ranges.
 	while (true) {
-		if (!lstate.file) {
-			std::lock_guard<std::mutex> lock(gstate.current_file_lock);
-			if (gstate.current_file_idx >= bind_data.file_bind_data.size()) {
-				output.SetCardinality(0);
-				return;
-			}
-			AttachLocalStateToCurrentFile(gstate, lstate);
+		if (!lstate.file && !AttachLocalStateToNextFile(context, bind_data, gstate, lstate)) {
+			output.SetCardinality(0);
+			return;
 		}
 
 		auto file_idx = lstate.file_idx;
 		auto file = lstate.file;
-		H5ReadSingleFileScan(context, GetSingleFileBindView(bind_data, file_idx), *file, output);
+		H5ReadSingleFileScan(context, GetSingleFileBindView(bind_data, file_idx, file->lazy_bind_data.get()), *file,
+		                     lstate.partition, output);
 
 		if (output.size() > 0) {
+			H5RecordScanStat(H5ScanCounter::ROWS_RETURNED, output.size());
+			lstate.batch_index = gstate.file_batch_base[file_idx] + lstate.partition.ordinal;
 			H5ReadPopulateFilenameColumns(bind_data, file_idx, gstate, output);
 			H5ReadPopulateEmptyColumns(gstate, output);
 			return;
 		}
 
 		lstate.file.reset();
+		lstate.partition = H5ReadPartition();
+		RetireH5ReadFile(gstate, file_idx);
+	}
+}
 
-		{
-			std::lock_guard<std::mutex> lock(gstate.current_file_lock);
-			AdvanceCurrentH5ReadFile(context, bind_data, gstate, file_idx);
-		}
+// Batch index of the chunk the local state returned last. Each logical partition is scanned by
+// exactly one local state, in row order, so DuckDB's order-preserving sinks can reassemble the
+// output from these indexes.
+static OperatorPartitionData H5ReadGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	if (input.partition_info.RequiresPartitionColumns()) {
+		throw InternalException("h5_read does not support partition columns");
 	}
+	auto &lstate = input.local_state->Cast<H5ReadMultiFileLocalState>();
+	return OperatorPartitionData(lstate.batch_index);
 }
 
 // ==================== h5_rse/h5_ree Scalar Functions ====================
@@ -2611,6 +5501,51 @@ void RegisterH5AliasFunction(ExtensionLoader &loader) {
 	loader.RegisterFunction(std::move(info));
 }
 
+// ==================== h5_slice Scalar Function ====================
+
+static void H5SliceFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &path_vec = args.data[0];
+	auto &slices_vec = args.data[1];
+
+	auto &children = StructVector::GetEntries(result);
+	D_ASSERT(children.size() == 3);
+	auto &tag_child = GetStructChild(children[0]);
+	auto &path_child = GetStructChild(children[1]);
+	auto &slices_child = GetStructChild(children[2]);
+	slices_child.Reference(slices_vec);
+
+	UnifiedVectorFormat path_data;
+	path_vec.ToUnifiedFormat(args.size(), path_data);
+	auto path_ptr = UnifiedVectorFormat::GetData<string_t>(path_data);
+
+	for (idx_t i = 0; i < args.size(); i++) {
+		auto path_idx = path_data.sel->get_index(i);
+		FlatVector::GetData<string_t>(tag_child)[i] = StringVector::AddString(tag_child, "__slice__");
+		FlatVector::GetData<string_t>(path_child)[i] = StringVector::AddString(path_child, path_ptr[path_idx]);
+	}
+
+	bool all_const = path_vec.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+	                 slices_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	result.SetVectorType(all_const ? VectorType::CONSTANT_VECTOR : VectorType::FLAT_VECTOR);
+	result.Verify(args.size());
+}
+
+void RegisterH5SliceFunction(ExtensionLoader &loader) {
+	auto slices_type = LogicalType::LIST(LogicalType::LIST(LogicalType::BIGINT));
+	child_list_t<LogicalType> struct_children = {
+	    {"tag", LogicalType::VARCHAR}, {"path", LogicalType::VARCHAR}, {"slices", slices_type}};
+
+	auto h5_slice = ScalarFunction("h5_slice", {LogicalType::VARCHAR, slices_type},
+	                               LogicalType::STRUCT(struct_children), H5SliceFunction);
+	CreateScalarFunctionInfo info(std::move(h5_slice));
+	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
+	info.descriptions.push_back(H5FunctionDescription(
+	    {LogicalType::VARCHAR, slices_type}, {"path", "slices"},
+	    "Creates a column definition for h5_read() that reads a region of the inner dimensions of a dataset.",
+	    {"FROM h5_read('data.h5', h5_slice('/frames', [NULL, [100, 164], [200, 264]]))"}));
+	loader.RegisterFunction(std::move(info));
+}
+
 // ==================== h5_index Scalar Function ====================
 
 static void H5IndexFunction(DataChunk &args, ExpressionState &state, Vector &result) {
@@ -2618,29 +5553,164 @@ static void H5IndexFunction(DataChunk &args, ExpressionState &state, Vector &res
 	D_ASSERT(children.size() == 1);
 	auto &tag_child = GetStructChild(children[0]);
 
-	for (idx_t i = 0; i < args.size(); i++) {
-		FlatVector::GetData<string_t>(tag_child)[i] = StringVector::AddString(tag_child, "__index__");
+	// h5_index(global) numbers rows across all matched files when global is true; NULL means false.
+	UnifiedVectorFormat global_data;
+	if (args.ColumnCount() == 1) {
+		args.data[0].ToUnifiedFormat(args.size(), global_data);
 	}
 
-	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	for (idx_t i = 0; i < args.size(); i++) {
+		bool global = false;
+		if (args.ColumnCount() == 1) {
+			auto global_idx = global_data.sel->get_index(i);
+			global = global_data.validity.RowIsValid(global_idx) &&
+			         UnifiedVectorFormat::GetData<bool>(global_data)[global_idx];
+		}
+		FlatVector::GetData<string_t>(tag_child)[i] =
+		    StringVector::AddString(tag_child, global ? "__global_index__" : "__index__");
+	}
+	bool all_const = args.ColumnCount() == 0 || args.data[0].GetVectorType() == VectorType::CONSTANT_VECTOR;
+	result.SetVectorType(all_const ? VectorType::CONSTANT_VECTOR : VectorType::FLAT_VECTOR);
 	result.Verify(args.size());
 }
 
 void RegisterH5IndexFunction(ExtensionLoader &loader) {
 	child_list_t<LogicalType> struct_children = {{"tag", LogicalType::VARCHAR}};
-	auto h5_index = ScalarFunction("h5_index", {}, LogicalType::STRUCT(struct_children), H5IndexFunction);
+	ScalarFunctionSet h5_index("h5_index");
+	h5_index.AddFunction(ScalarFunction("h5_index", {}, LogicalType::STRUCT(struct_children), H5IndexFunction));
+
+	ScalarFunction h5_index_global("h5_index", {LogicalType::BOOLEAN}, LogicalType::STRUCT(struct_children),
+	                               H5IndexFunction);
+	h5_index_global.null_handling = FunctionNullHandling::SPECIAL_HANDLING;
+	h5_index.AddFunction(h5_index_global);
+
 	CreateScalarFunctionInfo info(std::move(h5_index));
 	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
 	info.descriptions.push_back(H5FunctionDescription({}, {},
 	                                                  "Creates a virtual row-index column definition for h5_read().",
 	                                                  {"FROM h5_read('data.h5', h5_index(), '/measurements')"}));
+	info.descriptions.push_back(H5FunctionDescription(
+	    {LogicalType::BOOLEAN}, {"global"},
+	    "Creates a virtual row-index column definition for h5_read(). With global set to true, rows are numbered "
+	    "across all matched files in file order instead of from 0 in every file.",
+	    {"FROM h5_read('runs/*.h5', h5_alias('row', h5_index(true)), '/measurements') WHERE row >= 1000000"}));
 	loader.RegisterFunction(std::move(info));
 }
 
 // Cardinality function - informs DuckDB's optimizer of exact row count
 static unique_ptr<NodeStatistics> H5ReadCardinality(ClientContext &context, const FunctionData *bind_data_p) {
 	auto &bind_data = bind_data_p->Cast<H5ReadBindData>();
-	return make_uniq<NodeStatistics>(bind_data.total_num_rows);
+	hsize_t skipped_rows = 0;
+	for (const auto &file_bind_data : bind_data.file_bind_data) {
+		if (file_bind_data.bound) {
+			auto first_row = H5ReadSinceFirstRow(bind_data, file_bind_data);
+			skipped_rows += MinValue<hsize_t>(first_row, file_bind_data.num_rows);
+		}
+	}
+	return make_uniq<NodeStatistics>(bind_data.total_num_rows - MinValue(skipped_rows, bind_data.total_num_rows));
+}
+
+// Value range of a column within one file: the range known at bind, or, with zone maps enabled, the range of a zone
+// map that earlier scans completed for every chunk of a local file.
+static std::optional<H5ReadColumnRange> GetH5ReadFileColumnRange(ClientContext &context,
+                                                                 const H5ReadSingleFileBindData &file_bind_data,
+                                                                 column_t column_index, bool zone_maps) {
+	if (file_bind_data.column_ranges[column_index]) {
+		return file_bind_data.column_ranges[column_index];
+	}
+	auto &column = file_bind_data.columns[column_index];
+	if (!zone_maps || !H5ReadColumnSupportsZoneMap(column)) {
+		return std::nullopt;
+	}
+	auto identity = H5TryGetLocalFileIdentity(context, file_bind_data.filename);
+	if (!identity) {
+		return std::nullopt;
+	}
+	auto &spec = std::get<RegularColumnSpec>(column);
+	auto zone_map = H5FindZoneMap(file_bind_data.filename, *identity, RegularColumnZoneMapKey(spec), spec.column_type,
+	                              spec.dims[0]);
+	H5ReadColumnRange range;
+	if (!zone_map || !zone_map->TryGetRange(range.min, range.max)) {
+		return std::nullopt;
+	}
+	return range;
+}
+
+// Column statistics for the optimizer, which uses them to prune filters and to estimate joins. Index columns are
+// bounded by the row counts; other numeric columns report the range of every file, merged. Nothing is reported
+// while some files are unbound or opened in SWMR mode, since values not seen at bind may reach the scan.
+static unique_ptr<BaseStatistics> H5ReadStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                   column_t column_index) {
+	auto &bind_data = bind_data_p->Cast<H5ReadBindData>();
+	if (!H5ReadIsDataColumn(bind_data, column_index)) {
+		return nullptr;
+	}
+	for (auto &file_bind_data : bind_data.file_bind_data) {
+		if (!file_bind_data.bound || file_bind_data.swmr) {
+			return nullptr;
+		}
+	}
+
+	auto &column = GetCanonicalColumns(bind_data)[column_index];
+	if (auto index_spec = std::get_if<IndexColumnSpec>(&column)) {
+		idx_t rows = 0;
+		for (auto &file_bind_data : bind_data.file_bind_data) {
+			rows = index_spec->global ? rows + file_bind_data.num_rows
+			                          : MaxValue<idx_t>(rows, H5ReadFileIndexRows(file_bind_data));
+		}
+		if (rows == 0) {
+			return nullptr;
+		}
+		auto stats = NumericStats::CreateEmpty(index_spec->column_type);
+		NumericStats::SetMin(stats, Value::BIGINT(0));
+		NumericStats::SetMax(stats, Value::BIGINT(NumericCast<int64_t>(rows - 1)));
+		stats.SetHasNoNull();
+		stats.SetDistinctCount(rows);
+		return stats.ToUnique();
+	}
+
+	auto column_type = std::visit([](auto &&spec) { return spec.column_type; }, column);
+	if (!column_type.IsNumeric()) {
+		return nullptr;
+	}
+	auto zone_maps = ResolveZoneMapsOption(context);
+	std::optional<H5ReadColumnRange> merged;
+	for (auto &file_bind_data : bind_data.file_bind_data) {
+		if (file_bind_data.num_rows == 0) {
+			continue;
+		}
+		auto range = GetH5ReadFileColumnRange(context, file_bind_data, column_index, zone_maps);
+		if (!range) {
+			return nullptr;
+		}
+		if (!merged) {
+			merged = std::move(range);
+			continue;
+		}
+		if (range->min < merged->min) {
+			merged->min = range->min;
+		}
+		if (range->max > merged->max) {
+			merged->max = range->max;
+		}
+		// Values may repeat across files, so the largest per-file count is the best lower bound
+		merged->distinct_count = range->distinct_count == 0 || merged->distinct_count == 0
+		                             ? 0
+		                             : MaxValue<idx_t>(merged->distinct_count, range->distinct_count);
+	}
+	if (!merged) {
+		return nullptr;
+	}
+	auto stats = NumericStats::CreateEmpty(column_type);
+	NumericStats::SetMin(stats, merged->min);
+	NumericStats::SetMax(stats, merged->max);
+	// Nulls are not ruled out: run-encoded columns are NULL outside their runs
+	stats.SetHasNull();
+	stats.SetHasNoNull();
+	if (merged->distinct_count > 0) {
+		stats.SetDistinctCount(merged->distinct_count);
+	}
+	return stats.ToUnique();
 }
 
 static virtual_column_map_t H5ReadGetVirtualColumns(ClientContext &, optional_ptr<FunctionData> bind_data_p) {
@@ -2653,6 +5723,71 @@ static virtual_column_map_t H5ReadGetVirtualColumns(ClientContext &, optional_pt
 	return result;
 }
 
+// LIMIT pushdown: record on each h5_read scan how many rows a LIMIT directly above it consumes, so that
+// the scan stops opening files once the files it has opened hold that many rows. Only projections may
+// sit between the LIMIT and the scan; any other operator can drop or reorder rows.
+static void H5ReadPushdownLimits(LogicalOperator &op) {
+	if (op.type == LogicalOperatorType::LOGICAL_LIMIT && op.children.size() == 1) {
+		auto &limit = op.Cast<LogicalLimit>();
+		auto offset_type = limit.offset_val.Type();
+		if (limit.limit_val.Type() == LimitNodeType::CONSTANT_VALUE &&
+		    (offset_type == LimitNodeType::UNSET || offset_type == LimitNodeType::CONSTANT_VALUE)) {
+			idx_t row_limit = limit.limit_val.GetConstantValue();
+			if (offset_type == LimitNodeType::CONSTANT_VALUE) {
+				auto offset = limit.offset_val.GetConstantValue();
+				row_limit = offset > NumericLimits<idx_t>::Maximum() - row_limit ? NumericLimits<idx_t>::Maximum()
+				                                                                 : row_limit + offset;
+			}
+			reference<LogicalOperator> child = *op.children[0];
+			while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION && child.get().children.size() == 1) {
+				child = *child.get().children[0];
+			}
+			if (child.get().type == LogicalOperatorType::LOGICAL_GET) {
+				auto &get = child.get().Cast<LogicalGet>();
+				if (get.function.function == H5ReadScan && get.bind_data) {
+					auto &bind_data = get.bind_data->Cast<H5ReadBindData>();
+					bind_data.row_limit = MinValue<idx_t>(bind_data.row_limit.value_or(row_limit), row_limit);
+				}
+			}
+		}
+	}
+	for (auto &child : op.children) {
+		H5ReadPushdownLimits(*child);
+	}
+}
+
+// Scan counters for the h5_read operator's profiling output. DuckDB asks for them as each thread finishes the
+// scan, so the last report covers every thread's work. Remote counters are left out for scans of local files.
+static InsertionOrderPreservingMap<string> H5ReadDynamicToString(TableFunctionDynamicToStringInput &input) {
+	InsertionOrderPreservingMap<string> result;
+	if (!input.global_state) {
+		return result;
+	}
+	const auto &stats = *input.global_state->Cast<H5ReadMultiFileGlobalState>().stats;
+	auto remote = stats.Get(H5ScanCounter::REMOTE_READS) > 0;
+	for (idx_t i = 0; i < H5_SCAN_COUNTER_COUNT; i++) {
+		auto counter = static_cast<H5ScanCounter>(i);
+		// Scalar cache lookups happen outside scans
+		auto scalar_counter =
+		    counter == H5ScanCounter::SCALAR_CACHE_HITS || counter == H5ScanCounter::SCALAR_CACHE_MISSES;
+		auto remote_counter = counter >= H5ScanCounter::REMOTE_READS && counter <= H5ScanCounter::REMOTE_BYTES_FETCHED;
+		if (counter == H5ScanCounter::SCANS || scalar_counter || (!remote && remote_counter)) {
+			continue;
+		}
+		result[H5ScanCounterName(counter)] = to_string(stats.Get(counter));
+	}
+	auto block_lookups = stats.Get(H5ScanCounter::REMOTE_BLOCK_HITS) + stats.Get(H5ScanCounter::REMOTE_BLOCK_MISSES);
+	if (block_lookups > 0) {
+		auto hit_rate = 100.0 * static_cast<double>(stats.Get(H5ScanCounter::REMOTE_BLOCK_HITS)) / block_lookups;
+		result["remote_block_cache_hit_rate"] = StringUtil::Format("%.1f%%", hit_rate);
+	}
+	return result;
+}
+
+static void H5ReadOptimize(OptimizerExtensionInput &input, unique_ptr<LogicalOperator> &plan) {
+	H5ReadPushdownLimits(*plan);
+}
+
 void RegisterH5ReadTableFunction(ExtensionLoader &loader) {
 	// First argument is filename (VARCHAR), then 1+ dataset paths (VARCHAR or STRUCT for encoded columns)
 	TableFunction h5_read_function("h5_read", {LogicalType::VARCHAR, LogicalType::ANY}, H5ReadScan, H5ReadBind,
@@ -2661,6 +5796,7 @@ void RegisterH5ReadTableFunction(ExtensionLoader &loader) {
 	h5_read_function.varargs = LogicalType::ANY;
 	h5_read_function.named_parameters["filename"] = LogicalType::ANY;
 	h5_read_function.named_parameters["swmr"] = LogicalType::BOOLEAN;
+	h5_read_function.named_parameters["since"] = LogicalType::ANY;
 
 	// Predicate pushdown: claim filters in bind, build row ranges in init,
 	// and scan only matching run-encoded/index ranges while keeping DuckDB's post-scan verification.
@@ -2675,14 +5811,15 @@ void RegisterH5ReadTableFunction(ExtensionLoader &loader) {
 
 	// Set cardinality function for query optimizer
 	h5_read_function.cardinality = H5ReadCardinality;
+	// Column min/max for filter pruning and join estimates
+	h5_read_function.statistics = H5ReadStatistics;
 	h5_read_function.init_local = H5ReadInitLocal;
-	// Do not register get_partition_data for now. The previous implementation
-	// derived batch indexes from logical partitions owned by a local scan state
-	// across Scan() calls. That made early-stopping plans able to abandon a
-	// partition while still blocking shared cache progress for later ranges.
-	// Reintroduce this only with a design that does not make cache progress
-	// depend on a thread returning to Scan() after it has produced a chunk.
+	// Batch indexes come from logical partitions owned by a local scan state across Scan() calls.
+	// Cache progress does not depend on that state returning to Scan(): a scan that misses the
+	// cache loads the window it needs, so an abandoned partition only stalls read-ahead.
+	h5_read_function.get_partition_data = H5ReadGetPartitionData;
 	h5_read_function.get_virtual_columns = H5ReadGetVirtualColumns;
+	h5_read_function.dynamic_to_string = H5ReadDynamicToString;
 	auto h5_read_set = MultiFileReader::CreateFunctionSet(std::move(h5_read_function));
 	CreateTableFunctionInfo info(std::move(h5_read_set));
 	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
@@ -2690,6 +5827,10 @@ void RegisterH5ReadTableFunction(ExtensionLoader &loader) {
 	    {LogicalType::ANY, LogicalType::ANY}, {"filename_or_filenames", "dataset_or_definition", "swmr", "filename"},
 	    "Reads one or more HDF5 datasets as DuckDB columns.", {"FROM h5_read('data.h5', '/measurements')"}));
 	loader.RegisterFunction(std::move(info));
+
+	OptimizerExtension limit_pushdown;
+	limit_pushdown.optimize_function = H5ReadOptimize;
+	DBConfig::GetConfig(loader.GetDatabaseInstance()).optimizer_extensions.push_back(std::move(limit_pushdown));
 }
 
 } // namespace duckdb
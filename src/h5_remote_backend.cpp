@@ -38,7 +38,12 @@
 #include <chrono>
 #include <cstring>
 #include <cstdlib>
+#include <algorithm>
 #include <array>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <iterator>
 #include <map>
 #include <mutex>
 #include <optional>
@@ -513,6 +518,8 @@ private:
 
 	static constexpr int IO_WAIT_SLICE_MS = 100;
 	static constexpr int CLEANUP_GRACE_MS = 1000;
+	static constexpr int HEALTH_CHECK_TIMEOUT_MS = 5000;
+	static constexpr int KEEPALIVE_INTERVAL_SECONDS = 30;
 
 public:
 	H5SftpConnection(ClientContext &context_p, const H5SftpConfig &config_p) : config(config_p), context(&context_p) {
@@ -544,6 +551,71 @@ public:
 		return context;
 	}
 
+	// Pooled connections are handed from query to query; interrupts are taken from the query using it.
+	void SetContext(ClientContext *context_p) {
+		context = context_p;
+	}
+
+	bool IsOpen() const {
+		return session && sftp_session && !remote_connection_unreliable;
+	}
+
+	// Sends an SSH keepalive if KEEPALIVE_INTERVAL_SECONDS have passed since the last one, so that idle pooled
+	// connections are not dropped by servers or firewalls with idle limits. Returns false if the send failed.
+	bool SendKeepalive() noexcept {
+		if (!IsOpen()) {
+			return false;
+		}
+		libssh2_session_set_blocking(session, 0);
+		int seconds_to_next = 0;
+		auto rc = libssh2_keepalive_send(session, &seconds_to_next);
+		if (rc != 0 && rc != LIBSSH2_ERROR_EAGAIN) {
+			MarkRemoteConnectionUnreliable();
+			return false;
+		}
+		return true;
+	}
+
+	// Checks that the server still answers before a pooled connection is reused. One SFTP round trip replaces the
+	// connect, handshake and authentication of a new connection. Returns false, and marks the connection unreliable,
+	// if the request fails or gets no answer within HEALTH_CHECK_TIMEOUT_MS.
+	bool CheckHealth() noexcept {
+		if (!IsOpen()) {
+			return false;
+		}
+		auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(HEALTH_CHECK_TIMEOUT_MS);
+		char resolved_path[1024];
+		libssh2_session_set_blocking(session, 0);
+		while (true) {
+			auto rc = libssh2_sftp_realpath(sftp_session, ".", resolved_path, sizeof(resolved_path));
+			if (rc >= 0) {
+				return true;
+			}
+			if (rc != LIBSSH2_ERROR_EAGAIN || ContextInterrupted()) {
+				break;
+			}
+			auto remaining =
+			    std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+			if (remaining.count() <= 0) {
+				break;
+			}
+			auto directions = libssh2_session_block_directions(session);
+			auto wait_read = (directions & LIBSSH2_SESSION_BLOCK_INBOUND) != 0;
+			auto wait_write = (directions & LIBSSH2_SESSION_BLOCK_OUTBOUND) != 0;
+			if (!wait_read && !wait_write) {
+				wait_read = true;
+				wait_write = true;
+			}
+			auto wait_ms = MinValue<int64_t>(remaining.count(), IO_WAIT_SLICE_MS);
+			auto wait_result = WaitForSocketEventsOnce(wait_read, wait_write, UnsafeNumericCast<int>(wait_ms));
+			if (wait_result.result == SocketWaitResult::FAILED) {
+				break;
+			}
+		}
+		MarkRemoteConnectionUnreliable();
+		return false;
+	}
+
 	void ThrowIfRemoteConnectionUnreliable() const {
 		if (IsRemoteConnectionUnreliable()) {
 			throw IOException("SFTP connection is no longer usable");
@@ -629,6 +701,12 @@ public:
 		ResetConnectionState();
 	}
 
+	// Closes the connection, giving a server that stopped answering CLEANUP_GRACE_MS before the transport is shut
+	// down. Used for pooled connections, which are closed outside of any query that could be interrupted.
+	void CloseWithinGracePeriod() noexcept {
+		ResetConnectionState(std::chrono::steady_clock::now() + std::chrono::milliseconds(CLEANUP_GRACE_MS));
+	}
+
 private:
 	using KnownHostsPtr = unique_ptr<LIBSSH2_KNOWNHOSTS, decltype(&libssh2_knownhost_free)>;
 
@@ -776,8 +854,7 @@ private:
 		}
 	}
 
-	void ResetConnectionState() noexcept {
-		H5SftpCleanupDeadline deadline;
+	void ResetConnectionState(H5SftpCleanupDeadline deadline = std::nullopt) noexcept {
 		if (sftp_session) {
 			CleanupStep([&]() { return libssh2_sftp_shutdown(sftp_session); }, deadline);
 			sftp_session = nullptr;
@@ -853,6 +930,11 @@ private:
 #endif
 	}
 
+	static void TryEnableTcpKeepAlive(libssh2_socket_t fd) {
+		int enabled = 1;
+		(void)setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, reinterpret_cast<const char *>(&enabled), sizeof(enabled));
+	}
+
 	static void TryDisableSigPipe(libssh2_socket_t fd) {
 #ifdef SO_NOSIGPIPE
 		int enabled = 1;
@@ -965,6 +1047,7 @@ private:
 				continue;
 			}
 			TryDisableSigPipe(fd);
+			TryEnableTcpKeepAlive(fd);
 			if (!TrySetSocketNonBlocking(fd)) {
 				LIBSSH2_SOCKET_CLOSE(fd);
 				fd = LIBSSH2_INVALID_SOCKET;
@@ -1059,6 +1142,7 @@ private:
 			}
 		}
 		libssh2_session_set_blocking(session, 0);
+		libssh2_keepalive_config(session, 0, KEEPALIVE_INTERVAL_SECONDS);
 		auto rc = RunSessionCall([&]() { return libssh2_session_handshake(session, socket_fd->Get()); });
 		if (rc != 0) {
 			throw IOException("Failed SSH handshake: %s", LastSessionError());
@@ -1290,6 +1374,185 @@ private:
 	bool remote_connection_unreliable = false;
 };
 
+// Connections taken out of the pool or closed by it. They are closed after the pool lock is released, since closing
+// waits for the server.
+using H5SftpConnectionPoolGarbage = vector<shared_ptr<H5SftpConnection>>;
+
+static void CloseSftpConnectionPoolGarbage(H5SftpConnectionPoolGarbage &garbage) {
+	for (auto &connection : garbage) {
+		connection->CloseWithinGracePeriod();
+	}
+	garbage.clear();
+}
+
+// Idle SFTP connections shared by every DuckDB connection in the process, so that queries after the first one skip
+// the TCP connect, SSH handshake, host key check and authentication. A query checks out one connection per set of
+// credentials the first time it needs it and returns it when the query ends. Checked-out connections belong to that
+// query alone, so the pool never hands one session to two queries at once.
+//
+// There is no background thread: idle connections are expired and sent keepalives whenever a query checks out or
+// returns a connection, and are health-checked before reuse. Callers hold hdf5_global_mutex, which also serializes
+// the pool's I/O on idle connections with file handles of finished queries that close late. The exception is
+// TryAcquireUnshared, whose connections no file handle can reach. Glob expansion uses it to list directories on
+// several connections at once, and returns them as soon as expansion ends.
+class H5SftpConnectionPool {
+public:
+	static H5SftpConnectionPool &Get() {
+		static H5SftpConnectionPool pool;
+		return pool;
+	}
+
+	~H5SftpConnectionPool() {
+		for (auto &entry : idle) {
+			for (auto &idle_connection : entry.second) {
+				idle_connection.connection->CloseWithinGracePeriod();
+			}
+		}
+	}
+
+	shared_ptr<H5SftpConnection> Acquire(ClientContext &context, const H5SftpConfig &config,
+	                                     const H5SftpConnectionCacheKey &key) {
+		H5SftpConnectionPoolGarbage garbage;
+		while (true) {
+			shared_ptr<H5SftpConnection> candidate;
+			{
+				std::lock_guard<std::mutex> guard(lock);
+				MaintainLocked(garbage);
+				auto lookup = idle.find(key);
+				if (lookup != idle.end()) {
+					// The most recently returned connection is the one most likely to still be alive.
+					candidate = std::move(lookup->second.back().connection);
+					lookup->second.pop_back();
+					if (lookup->second.empty()) {
+						idle.erase(lookup);
+					}
+				}
+			}
+			CloseSftpConnectionPoolGarbage(garbage);
+			if (!candidate) {
+				break;
+			}
+			candidate->SetContext(&context);
+			if (candidate->CheckHealth()) {
+				return candidate;
+			}
+			garbage.push_back(std::move(candidate));
+		}
+		return make_shared_ptr<H5SftpConnection>(context, config);
+	}
+
+	// Returns a connection whose query has ended. Connections that failed are closed, and so are the ones expiring
+	// first once more than max_idle are idle; the rest stay open for idle_timeout.
+	void Release(const H5SftpConnectionCacheKey &key, shared_ptr<H5SftpConnection> connection, idx_t max_idle,
+	             std::chrono::seconds idle_timeout) {
+		H5SftpConnectionPoolGarbage garbage;
+		connection->SetContext(nullptr);
+		if (max_idle == 0 || !connection->IsOpen()) {
+			garbage.push_back(std::move(connection));
+		} else {
+			std::lock_guard<std::mutex> guard(lock);
+			idle[key].push_back({std::move(connection), std::chrono::steady_clock::now() + idle_timeout});
+			MaintainLocked(garbage);
+			while (IdleCountLocked() > max_idle) {
+				EvictFirstExpiringLocked(garbage);
+			}
+		}
+		CloseSftpConnectionPoolGarbage(garbage);
+	}
+
+	// Takes an unexpired idle connection that nothing outside the pool refers to, which the caller may then use
+	// without holding hdf5_global_mutex. Connections still referenced by file handles of earlier queries are skipped,
+	// since those handles may close on them at any time. Returns nullptr if there is none or it fails its health check.
+	shared_ptr<H5SftpConnection> TryAcquireUnshared(ClientContext &context, const H5SftpConnectionCacheKey &key) {
+		shared_ptr<H5SftpConnection> candidate;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			auto lookup = idle.find(key);
+			if (lookup == idle.end()) {
+				return nullptr;
+			}
+			auto &connections = lookup->second;
+			auto now = std::chrono::steady_clock::now();
+			for (auto it = connections.end(); it != connections.begin();) {
+				--it;
+				if (it->expires_at > now && it->connection.use_count() == 1) {
+					candidate = std::move(it->connection);
+					connections.erase(it);
+					break;
+				}
+			}
+			if (connections.empty()) {
+				idle.erase(lookup);
+			}
+		}
+		if (!candidate) {
+			return nullptr;
+		}
+		candidate->SetContext(&context);
+		if (candidate->CheckHealth()) {
+			return candidate;
+		}
+		candidate->CloseWithinGracePeriod();
+		return nullptr;
+	}
+
+private:
+	struct IdleConnection {
+		shared_ptr<H5SftpConnection> connection;
+		std::chrono::steady_clock::time_point expires_at;
+	};
+
+	// Moves expired and broken connections to garbage and keeps the others alive.
+	void MaintainLocked(H5SftpConnectionPoolGarbage &garbage) {
+		auto now = std::chrono::steady_clock::now();
+		for (auto entry = idle.begin(); entry != idle.end();) {
+			auto &connections = entry->second;
+			for (auto it = connections.begin(); it != connections.end();) {
+				if (it->expires_at <= now || !it->connection->SendKeepalive()) {
+					garbage.push_back(std::move(it->connection));
+					it = connections.erase(it);
+				} else {
+					++it;
+				}
+			}
+			entry = connections.empty() ? idle.erase(entry) : std::next(entry);
+		}
+	}
+
+	idx_t IdleCountLocked() const {
+		idx_t count = 0;
+		for (auto &entry : idle) {
+			count += entry.second.size();
+		}
+		return count;
+	}
+
+	// Closes the idle connection that would expire first.
+	void EvictFirstExpiringLocked(H5SftpConnectionPoolGarbage &garbage) {
+		vector<IdleConnection> *first_list = nullptr;
+		idx_t first_idx = 0;
+		for (auto &entry : idle) {
+			for (idx_t i = 0; i < entry.second.size(); i++) {
+				if (!first_list || entry.second[i].expires_at < (*first_list)[first_idx].expires_at) {
+					first_list = &entry.second;
+					first_idx = i;
+				}
+			}
+		}
+		if (!first_list) {
+			return;
+		}
+		garbage.push_back(std::move((*first_list)[first_idx].connection));
+		first_list->erase(first_list->begin() + NumericCast<int64_t>(first_idx));
+		for (auto entry = idle.begin(); entry != idle.end();) {
+			entry = entry->second.empty() ? idle.erase(entry) : std::next(entry);
+		}
+	}
+
+	std::mutex lock;
+	std::map<H5SftpConnectionCacheKey, vector<IdleConnection>> idle; // Protected by lock
+};
+
 class H5SftpConnectionCacheState : public ClientContextState {
 public:
 	shared_ptr<H5SftpConnection> GetOrCreate(ClientContext &context, const H5SftpConfig &config) {
@@ -1302,15 +1565,19 @@ public:
 			connections.erase(lookup);
 		}
 
-		auto created = make_shared_ptr<H5SftpConnection>(context, config);
-		connections[key] = created;
-		return created;
+		pool_size = ResolveSftpPoolSizeOption(context);
+		pool_idle_timeout = std::chrono::seconds(ResolveSftpPoolIdleTimeoutOption(context));
+		auto acquired = H5SftpConnectionPool::Get().Acquire(context, config, key);
+		connections[key] = acquired;
+		return acquired;
 	}
 
 	void QueryEnd() override {
+		std::lock_guard<std::recursive_mutex> hdf5_lock(hdf5_global_mutex);
 		for (auto &entry : connections) {
 			if (entry.second) {
-				entry.second->Close();
+				H5SftpConnectionPool::Get().Release(entry.first, std::move(entry.second), pool_size,
+				                                    pool_idle_timeout);
 			}
 		}
 		connections.clear();
@@ -1318,8 +1585,10 @@ public:
 
 private:
 	// Access to this query-local cache happens through the HDF5 VFD path while hdf5_global_mutex is held.
-	// QueryEnd runs after DuckDB has finished the active query, so no extra synchronization is needed here.
+	// QueryEnd runs after DuckDB has finished the active query and takes hdf5_global_mutex for the pool.
 	std::map<H5SftpConnectionCacheKey, shared_ptr<H5SftpConnection>> connections;
+	idx_t pool_size = H5DB_DEFAULT_SFTP_POOL_SIZE;
+	std::chrono::seconds pool_idle_timeout {H5DB_DEFAULT_SFTP_POOL_IDLE_TIMEOUT_SECONDS};
 };
 
 static shared_ptr<H5SftpConnection> GetOrCreateCachedSftpConnection(ClientContext &context,
@@ -1457,21 +1726,139 @@ struct H5SftpListEntry {
 
 enum class H5SftpPathKind : uint8_t { UNKNOWN, OTHER, DIRECTORY, SYMBOLIC_LINK };
 
+// One step of glob expansion: expand the pattern from remote_components[split_index] on in the directory path, or,
+// for a trailing '**', collect every file below it.
+struct H5SftpGlobTask {
+	std::string path;
+	idx_t split_index = 0;
+	bool crawl_files = false;
+};
+
+// Connections glob expansion lists directories on without holding hdf5_global_mutex, one per listing in flight. Each
+// is used by one thread at a time and referenced by nothing else, so its I/O needs no lock. They are returned to the
+// pool when expansion ends.
+class H5SftpGlobConnections {
+public:
+	H5SftpGlobConnections(ClientContext &context_p, const H5SftpConfig &config_p)
+	    : context(context_p), config(config_p), key(BuildSftpConnectionCacheKey(config_p)),
+	      pool_size(ResolveSftpPoolSizeOption(context_p)),
+	      pool_idle_timeout(ResolveSftpPoolIdleTimeoutOption(context_p)) {
+	}
+
+	~H5SftpGlobConnections() {
+		std::lock_guard<std::recursive_mutex> hdf5_lock(hdf5_global_mutex);
+		for (auto &connection : connections) {
+			H5SftpConnectionPool::Get().Release(key, std::move(connection), pool_size, pool_idle_timeout);
+		}
+	}
+
+	shared_ptr<H5SftpConnection> Acquire() {
+		auto connection = H5SftpConnectionPool::Get().TryAcquireUnshared(context, key);
+		if (!connection) {
+			connection = make_shared_ptr<H5SftpConnection>(context, config);
+		}
+		std::lock_guard<std::mutex> guard(lock);
+		connections.push_back(connection);
+		return connection;
+	}
+
+private:
+	ClientContext &context;
+	const H5SftpConfig config;
+	const H5SftpConnectionCacheKey key;
+	const idx_t pool_size;
+	const std::chrono::seconds pool_idle_timeout;
+	std::mutex lock;
+	vector<shared_ptr<H5SftpConnection>> connections; // Protected by lock
+};
+
+// Expands an sftp:// glob breadth-first. Each directory listing is one task; the tasks a listing produces (the
+// subdirectories to descend into) are queued, so that ExpandConcurrently can keep several listings in flight.
+// Literal components are joined without listing, and literal components after '**' are looked up in the listing
+// that '**' already made.
 class H5SftpGlobExpander {
 public:
-	H5SftpGlobExpander(shared_ptr<H5SftpConnection> connection_p, std::string authority_p,
-	                   H5SftpRemotePattern pattern_p)
-	    : connection(std::move(connection_p)), authority(std::move(authority_p)),
-	      remote_components(std::move(pattern_p.components)) {
+	H5SftpGlobExpander(std::string authority_p, H5SftpRemotePattern pattern_p)
+	    : authority(std::move(authority_p)), remote_components(std::move(pattern_p.components)) {
 		if (HasMultipleCrawlPatterns(remote_components)) {
 			throw IOException("Cannot use multiple '**' in one path");
 		}
+		pending.push_back({"/", 0, false});
+	}
+
+	// Runs tasks on connection, which the caller only uses while holding hdf5_global_mutex, until none are left or
+	// (with max_pending set) more than max_pending are queued.
+	void ExpandSerially(const shared_ptr<H5SftpConnection> &connection,
+	                    std::optional<idx_t> max_pending = std::nullopt) {
+		while (!pending.empty() && (!max_pending || pending.size() <= *max_pending)) {
+			auto task = std::move(pending.front());
+			pending.pop_front();
+			RunTask(connection, task, pending, matched_paths);
+		}
 	}
 
-	vector<std::string> Expand() {
-		vector<std::string> matched_paths;
-		ExpandFrom("/", 0, matched_paths);
+	bool HasPendingTasks() const {
+		return !pending.empty();
+	}
+
+	// Runs the queued tasks on up to worker_count threads, each listing on its own connection from connections.
+	// Threads stop taking tasks once one has failed, and the first error is rethrown.
+	void ExpandConcurrently(idx_t worker_count, H5SftpGlobConnections &connections) {
+		std::mutex lock;
+		std::condition_variable task_ready;
+		idx_t running = 0;
+		std::exception_ptr error;
+
+		auto work = [&]() {
+			shared_ptr<H5SftpConnection> connection;
+			std::unique_lock<std::mutex> guard(lock);
+			while (true) {
+				task_ready.wait(guard, [&]() { return error || !pending.empty() || running == 0; });
+				if (error || pending.empty()) {
+					return;
+				}
+				auto task = std::move(pending.front());
+				pending.pop_front();
+				running++;
+				guard.unlock();
+
+				std::deque<H5SftpGlobTask> tasks;
+				vector<std::string> paths;
+				std::exception_ptr task_error;
+				try {
+					if (!connection) {
+						connection = connections.Acquire();
+					}
+					RunTask(connection, task, tasks, paths);
+				} catch (...) {
+					task_error = std::current_exception();
+				}
+
+				guard.lock();
+				running--;
+				if (task_error && !error) {
+					error = task_error;
+				}
+				std::move(tasks.begin(), tasks.end(), std::back_inserter(pending));
+				std::move(paths.begin(), paths.end(), std::back_inserter(matched_paths));
+				task_ready.notify_all();
+			}
+		};
 
+		vector<std::future<void>> workers;
+		for (idx_t i = 1; i < worker_count; i++) {
+			workers.push_back(std::async(std::launch::async, work));
+		}
+		work();
+		for (auto &worker : workers) {
+			worker.get();
+		}
+		if (error) {
+			std::rethrow_exception(error);
+		}
+	}
+
+	vector<std::string> Finish() {
 		vector<std::string> result;
 		result.reserve(matched_paths.size());
 		for (auto &matched_path : matched_paths) {
@@ -1495,22 +1882,19 @@ private:
 		return H5SftpPathKind::OTHER;
 	}
 
-	H5SftpPathKind TryGetPathKind(const std::string &path, int stat_type) const {
+	static H5SftpPathKind TryGetPathKind(const shared_ptr<H5SftpConnection> &connection, const std::string &path,
+	                                     int stat_type) {
 		LIBSSH2_SFTP_ATTRIBUTES attrs {};
-		if (!TryStatPath(path, stat_type, attrs, H5SftpStatMode::GLOB_EXISTENCE_PROBE)) {
+		if (!H5SftpTryStatPath(connection, path, stat_type, attrs, H5SftpStatMode::GLOB_EXISTENCE_PROBE)) {
 			return H5SftpPathKind::UNKNOWN;
 		}
 		return PathKindFromAttrs(attrs);
 	}
 
-	bool TryStatPath(const std::string &path, int stat_type, LIBSSH2_SFTP_ATTRIBUTES &attrs,
-	                 H5SftpStatMode mode = H5SftpStatMode::DEFAULT) const {
-		return H5SftpTryStatPath(connection, path, stat_type, attrs, mode);
-	}
-
-	H5SftpPathKind TryGetResolvedPathKind(const std::string &path) const {
+	static H5SftpPathKind TryGetResolvedPathKind(const shared_ptr<H5SftpConnection> &connection,
+	                                             const std::string &path) {
 		LIBSSH2_SFTP_ATTRIBUTES attrs {};
-		if (!TryStatPath(path, LIBSSH2_SFTP_STAT, attrs, H5SftpStatMode::GLOB_EXISTENCE_PROBE)) {
+		if (!H5SftpTryStatPath(connection, path, LIBSSH2_SFTP_STAT, attrs, H5SftpStatMode::GLOB_EXISTENCE_PROBE)) {
 			return H5SftpPathKind::UNKNOWN;
 		}
 		auto path_kind = PathKindFromAttrs(attrs);
@@ -1520,8 +1904,9 @@ private:
 		return H5SftpCanOpenDirectory(connection, path) ? H5SftpPathKind::DIRECTORY : H5SftpPathKind::OTHER;
 	}
 
-	std::optional<H5SftpListEntry> ClassifyListedPath(const std::string &directory_path, std::string name,
-	                                                  const LIBSSH2_SFTP_ATTRIBUTES &attrs) const {
+	static std::optional<H5SftpListEntry> ClassifyListedPath(const shared_ptr<H5SftpConnection> &connection,
+	                                                         const std::string &directory_path, std::string name,
+	                                                         const LIBSSH2_SFTP_ATTRIBUTES &attrs) {
 		auto entry_path = JoinSftpPath(directory_path, name);
 		auto raw_kind = PathKindFromAttrs(attrs);
 
@@ -1531,7 +1916,7 @@ private:
 		// ordinary glob components can match/traverse symlinks, but recursive '**'
 		// expansion still skips symlink entries explicitly.
 		if (raw_kind == H5SftpPathKind::UNKNOWN) {
-			raw_kind = TryGetPathKind(entry_path, LIBSSH2_SFTP_LSTAT);
+			raw_kind = TryGetPathKind(connection, entry_path, LIBSSH2_SFTP_LSTAT);
 		}
 		if (raw_kind == H5SftpPathKind::UNKNOWN) {
 			return std::nullopt;
@@ -1544,7 +1929,7 @@ private:
 		if (!entry.is_symbolic_link) {
 			return entry;
 		}
-		auto resolved_kind = TryGetResolvedPathKind(entry_path);
+		auto resolved_kind = TryGetResolvedPathKind(connection, entry_path);
 		if (resolved_kind == H5SftpPathKind::UNKNOWN) {
 			return std::nullopt;
 		}
@@ -1552,11 +1937,8 @@ private:
 		return entry;
 	}
 
-	void CloseDirectoryHandle(LIBSSH2_SFTP_HANDLE *dir_handle) const {
-		connection->CloseSftpHandleForCleanup(dir_handle);
-	}
-
-	vector<H5SftpListEntry> ListDirectory(const std::string &path) const {
+	static vector<H5SftpListEntry> ListDirectory(const shared_ptr<H5SftpConnection> &connection,
+	                                             const std::string &path) {
 		LIBSSH2_SFTP_HANDLE *dir_handle = H5SftpTryOpenDirectory(connection, path);
 		if (!dir_handle) {
 			return {};
@@ -1585,21 +1967,31 @@ private:
 					continue;
 				}
 
-				auto entry = ClassifyListedPath(path, std::move(name), attrs);
+				auto entry = ClassifyListedPath(connection, path, std::move(name), attrs);
 				if (!entry) {
 					continue;
 				}
 				result.push_back(std::move(*entry));
 			}
 		} catch (...) {
-			CloseDirectoryHandle(dir_handle);
+			connection->CloseSftpHandleForCleanup(dir_handle);
 			throw;
 		}
-		CloseDirectoryHandle(dir_handle);
+		connection->CloseSftpHandleForCleanup(dir_handle);
 		return result;
 	}
 
-	void ExpandFrom(const std::string &current_path, idx_t split_index, vector<std::string> &result,
+	void RunTask(const shared_ptr<H5SftpConnection> &connection, const H5SftpGlobTask &task,
+	             std::deque<H5SftpGlobTask> &tasks, vector<std::string> &result) const {
+		if (task.crawl_files) {
+			CrawlFiles(connection, task.path, task.split_index, tasks, result);
+		} else {
+			ExpandFrom(connection, task.path, task.split_index, tasks, result);
+		}
+	}
+
+	void ExpandFrom(const shared_ptr<H5SftpConnection> &connection, const std::string &current_path,
+	                idx_t split_index, std::deque<H5SftpGlobTask> &tasks, vector<std::string> &result,
 	                const vector<H5SftpListEntry> *prelisted_entries = nullptr) const {
 		if (split_index >= remote_components.size()) {
 			return;
@@ -1610,35 +2002,49 @@ private:
 
 		if (!FileSystem::HasGlob(component)) {
 			auto next_path = JoinSftpPath(current_path, component);
+			if (prelisted_entries) {
+				// current_path was just listed for '**', so a name missing from it needs no round trip
+				auto entry = std::find_if(prelisted_entries->begin(), prelisted_entries->end(),
+				                          [&](const H5SftpListEntry &listed) { return listed.name == component; });
+				if (entry == prelisted_entries->end()) {
+					return;
+				}
+				if (is_last_component) {
+					result.push_back(std::move(next_path));
+				} else if (entry->is_directory) {
+					ExpandFrom(connection, next_path, split_index + 1, tasks, result);
+				}
+				return;
+			}
 			if (is_last_component) {
 				if (H5SftpGlobLiteralPathExists(connection, next_path)) {
 					result.push_back(std::move(next_path));
 				}
 			} else {
-				ExpandFrom(next_path, split_index + 1, result);
+				ExpandFrom(connection, next_path, split_index + 1, tasks, result);
 			}
 			return;
 		}
 
 		if (IsCrawlPattern(component)) {
 			if (is_last_component) {
-				CrawlFiles(current_path, result);
+				CrawlFiles(connection, current_path, split_index, tasks, result);
 				return;
 			}
-			auto entries = ListDirectory(current_path);
-			ExpandFrom(current_path, split_index + 1, result, &entries);
+			auto entries = ListDirectory(connection, current_path);
+			ExpandFrom(connection, current_path, split_index + 1, tasks, result, &entries);
 			for (const auto &entry : entries) {
 				if (!entry.is_directory || entry.is_symbolic_link) {
 					continue;
 				}
-				ExpandFrom(JoinSftpPath(current_path, entry.name), split_index, result);
+				tasks.push_back({JoinSftpPath(current_path, entry.name), split_index, false});
 			}
 			return;
 		}
 
 		vector<H5SftpListEntry> owned_entries;
 		if (!prelisted_entries) {
-			owned_entries = ListDirectory(current_path);
+			owned_entries = ListDirectory(connection, current_path);
 			prelisted_entries = &owned_entries;
 		}
 		for (const auto &entry : *prelisted_entries) {
@@ -1651,35 +2057,39 @@ private:
 					result.push_back(std::move(next_path));
 				}
 			} else if (entry.is_directory) {
-				ExpandFrom(next_path, split_index + 1, result);
+				tasks.push_back({std::move(next_path), split_index + 1, false});
 			}
 		}
 	}
 
-	void CrawlFiles(const std::string &directory_path, vector<std::string> &result) const {
-		for (const auto &entry : ListDirectory(directory_path)) {
+	static void CrawlFiles(const shared_ptr<H5SftpConnection> &connection, const std::string &directory_path,
+	                       idx_t split_index, std::deque<H5SftpGlobTask> &tasks, vector<std::string> &result) {
+		for (const auto &entry : ListDirectory(connection, directory_path)) {
 			if (entry.is_symbolic_link) {
 				continue;
 			}
 			auto entry_path = JoinSftpPath(directory_path, entry.name);
 			if (entry.is_directory) {
-				CrawlFiles(entry_path, result);
+				tasks.push_back({std::move(entry_path), split_index, true});
 			} else {
 				result.push_back(std::move(entry_path));
 			}
 		}
 	}
 
-	shared_ptr<H5SftpConnection> connection;
 	const std::string authority;
 	const vector<string> remote_components;
+	std::deque<H5SftpGlobTask> pending;  // Protected by the ExpandConcurrently lock while it runs
+	vector<std::string> matched_paths;   // Protected by the ExpandConcurrently lock while it runs
 };
 
 class H5SftpFileEngine {
 public:
 	explicit H5SftpFileEngine(shared_ptr<H5SftpConnection> connection_p, const H5SftpConfig &config_p)
 	    : connection(std::move(connection_p)), context(connection->GetContext()), remote_path(config_p.remote_path),
-	      profiling_enabled(std::getenv("H5DB_SFTP_PROFILE") != nullptr) {
+	      profiling_enabled(std::getenv("H5DB_SFTP_PROFILE") != nullptr),
+	      pipeline_read_bytes(PipelineReadBytes(context ? ResolveSftpPipelineDepthOption(*context)
+	                                                    : H5DB_DEFAULT_SFTP_PIPELINE_DEPTH)) {
 		for (idx_t i = 0; i < sftp_handles.size(); i++) {
 			sftp_handles[i].index = i;
 		}
@@ -1714,17 +2124,36 @@ public:
 private:
 	static constexpr idx_t SFTP_HANDLE_POOL_SIZE = 4;
 	static constexpr idx_t SFTP_HANDLE_LOCALITY_THRESHOLD = 2 * 1024 * 1024;
+	// libssh2 splits reads into requests of at most this many bytes (MAX_SFTP_READ_SIZE) and keeps up to four
+	// times the buffer passed to libssh2_sftp_read in flight.
+	static constexpr idx_t SFTP_READ_REQUEST_BYTES = 30000;
+	static constexpr idx_t SFTP_READ_AHEAD_FACTOR = 4;
 
 	struct SftpReadHandle {
 		LIBSSH2_SFTP_HANDLE *handle = nullptr;
-		std::optional<idx_t> current_offset;
+		std::optional<idx_t> current_offset; // Next byte a read from this handle returns
 		idx_t index = 0;
+		// staged[staged_pos, staged_end) holds bytes libssh2 returned past the end of the last read, starting at
+		// current_offset. libssh2 itself is positioned at staged_end.
+		vector<char> staged;
+		idx_t staged_pos = 0;
+		idx_t staged_end = 0;
 
 		bool IsOpen() const {
 			return handle != nullptr;
 		}
+
+		void ClearStaged() {
+			staged_pos = 0;
+			staged_end = 0;
+		}
 	};
 
+	// Buffer size for reads that continue a sequential stream, so that libssh2 keeps depth requests in flight
+	static idx_t PipelineReadBytes(idx_t depth) {
+		return MaxValue<idx_t>(depth * SFTP_READ_REQUEST_BYTES / SFTP_READ_AHEAD_FACTOR, 1);
+	}
+
 	struct SftpReadStats {
 		idx_t backend_read_calls = 0;
 		idx_t backend_bytes_requested = 0;
@@ -1737,6 +2166,7 @@ private:
 		idx_t largest_forward_gap = 0;
 		idx_t largest_backward_gap = 0;
 		std::optional<idx_t> next_expected_offset;
+		idx_t staged_bytes_read = 0;
 		std::array<idx_t, SFTP_HANDLE_POOL_SIZE> handle_use_counts {};
 		std::array<idx_t, SFTP_HANDLE_POOL_SIZE> handle_sftp_read_counts {};
 		std::map<idx_t, idx_t> requested_size_histogram;
@@ -1765,6 +2195,10 @@ private:
 			next_expected_offset = offset + size;
 		}
 
+		void RecordStagedRead(idx_t size) {
+			staged_bytes_read += size;
+		}
+
 		void RecordSftpRead(idx_t handle_index, idx_t size) {
 			sftp_read_calls++;
 			sftp_bytes_read += size;
@@ -1801,6 +2235,7 @@ private:
 			std::cerr << "  open_handle_count=" << open_handle_count << '\n';
 			std::cerr << "  sftp_read_calls=" << sftp_read_calls << '\n';
 			std::cerr << "  sftp_bytes_read=" << sftp_bytes_read << '\n';
+			std::cerr << "  staged_bytes_read=" << staged_bytes_read << '\n';
 			if (sftp_read_calls > 0) {
 				std::cerr << "  average_sftp_read_size="
 				          << static_cast<double>(sftp_bytes_read) / static_cast<double>(sftp_read_calls) << '\n';
@@ -1834,24 +2269,58 @@ private:
 		auto *handle = handle_slot.handle;
 		handle_slot.handle = nullptr;
 		handle_slot.current_offset.reset();
+		handle_slot.ClearStaged();
 		connection->CloseSftpHandleForCleanup(handle, deadline);
 	}
 
+	// Copies staged bytes of handle_slot into out and returns how many were copied.
+	idx_t TakeStaged(SftpReadHandle &handle_slot, char *out, idx_t size) {
+		auto available = handle_slot.staged_end - handle_slot.staged_pos;
+		auto count = MinValue<idx_t>(available, size);
+		if (count == 0) {
+			return 0;
+		}
+		std::memcpy(out, handle_slot.staged.data() + handle_slot.staged_pos, count);
+		handle_slot.staged_pos += count;
+		handle_slot.current_offset = *handle_slot.current_offset + count;
+		if (handle_slot.staged_pos == handle_slot.staged_end) {
+			handle_slot.ClearStaged();
+		}
+		if (profiling_enabled) {
+			stats.RecordStagedRead(count);
+		}
+		return count;
+	}
+
 	void ReadInternal(idx_t offset, idx_t size, void *buf) {
 		connection->ThrowIfRemoteConnectionUnreliable();
 		auto &handle_slot = SelectReadHandle(offset);
 		if (profiling_enabled) {
 			stats.RecordRead(offset, size, handle_slot.index);
 		}
-		if (!handle_slot.current_offset || *handle_slot.current_offset != offset) {
+		auto sequential = handle_slot.current_offset && *handle_slot.current_offset == offset;
+		if (!sequential) {
+			// Seeking drops the requests libssh2 still has in flight for this handle
 			libssh2_sftp_seek64(handle_slot.handle, offset);
 			handle_slot.current_offset = offset;
+			handle_slot.ClearStaged();
 		}
 		auto *out = static_cast<char *>(buf);
-		idx_t remaining = size;
+		auto taken = TakeStaged(handle_slot, out, size);
+		out += taken;
+		idx_t remaining = size - taken;
+		// A read that continues where the previous one on this handle ended is likely followed by more. It asks libssh2
+		// for at least pipeline_read_bytes, which keeps h5db_sftp_pipeline_depth requests in flight ahead of the
+		// reader instead of a few requests per round trip; bytes past this read are staged for the next one.
+		auto min_request = sequential ? pipeline_read_bytes : 0;
 		while (remaining > 0) {
 			ThrowIfInterrupted();
-			auto nread = libssh2_sftp_read(handle_slot.handle, out, remaining);
+			auto stage = remaining < min_request;
+			if (stage && handle_slot.staged.size() < min_request) {
+				handle_slot.staged.resize(min_request);
+			}
+			auto *target = stage ? handle_slot.staged.data() : out;
+			auto nread = libssh2_sftp_read(handle_slot.handle, target, stage ? min_request : remaining);
 			if (nread == LIBSSH2_ERROR_EAGAIN) {
 				connection->WaitForSessionIO();
 				continue;
@@ -1867,10 +2336,16 @@ private:
 			if (profiling_enabled) {
 				stats.RecordSftpRead(handle_slot.index, UnsafeNumericCast<idx_t>(nread));
 			}
-			out += nread;
 			auto read_size = UnsafeNumericCast<idx_t>(nread);
+			if (stage) {
+				handle_slot.staged_pos = 0;
+				handle_slot.staged_end = read_size;
+				read_size = TakeStaged(handle_slot, out, remaining);
+			} else {
+				handle_slot.current_offset = *handle_slot.current_offset + read_size;
+			}
+			out += read_size;
 			remaining -= read_size;
-			handle_slot.current_offset = *handle_slot.current_offset + read_size;
 		}
 	}
 
@@ -1973,6 +2448,7 @@ private:
 	ClientContext *context = nullptr;
 	std::string remote_path;
 	const bool profiling_enabled;
+	const idx_t pipeline_read_bytes;
 	SftpReadStats stats;
 	std::array<SftpReadHandle, SFTP_HANDLE_POOL_SIZE> sftp_handles;
 	idx_t file_size = 0;
@@ -2182,10 +2658,23 @@ H5ExpandedFileList ExpandH5SftpFilePattern(ClientContext &context, const std::st
 		return result;
 	}
 
-	std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	auto concurrency = ResolveSftpGlobConcurrencyOption(context);
+	H5SftpGlobExpander expander(url.url_authority, std::move(pattern));
+	std::unique_lock<std::recursive_mutex> lock(hdf5_global_mutex);
 	auto config = ResolveSftpConfig(context, url);
 	auto connection = GetOrCreateCachedSftpConnection(context, config);
-	result.filenames = H5SftpGlobExpander(connection, url.url_authority, std::move(pattern)).Expand();
+	// Listings run on the query's connection until there are several to make at once, e.g. below a '**'. The rest
+	// run concurrently on connections of their own, without hdf5_global_mutex.
+	expander.ExpandSerially(connection, concurrency > 1 ? std::optional<idx_t>(1) : std::nullopt);
+	if (expander.HasPendingTasks()) {
+		lock.unlock();
+		{
+			H5SftpGlobConnections glob_connections(context, config);
+			expander.ExpandConcurrently(concurrency, glob_connections);
+		}
+		lock.lock();
+	}
+	result.filenames = expander.Finish();
 	if (result.filenames.empty()) {
 		// Match DuckDB reader semantics for local paths: if glob expansion finds
 		// nothing, fall back to treating the full input as an exact path.
@@ -3,22 +3,42 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context_state.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "h5_internal.hpp"
+#include "h5_raii.hpp"
 #include "h5_remote_backend.hpp"
+#include "h5_scan_stats.hpp"
 
 #include <hdf5.h>
 #include <H5FDdevelop.h>
+#include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <list>
+#include <map>
 #include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 namespace duckdb {
 
 static constexpr H5FD_class_value_t DUCKDB_VFD_VALUE = 600;
-static constexpr idx_t REMOTE_CACHE_BLOCK_SIZE = 30ULL * 1024ULL;
 static constexpr idx_t REMOTE_CACHE_MAX_BLOCKS = 100;
+// Blocks a metadata read that misses the block cache outside the file head loads with one request.
+static constexpr idx_t REMOTE_METADATA_RUN_BLOCKS = 4;
+// Number of independent access streams (e.g. the datasets of one h5_read) tracked per file for readahead.
+static constexpr idx_t REMOTE_READAHEAD_MAX_STREAMS = 8;
+// Largest gap between equally sized reads, in multiples of the read size, that is still treated as a stride.
+static constexpr idx_t REMOTE_READAHEAD_MAX_STRIDE_FACTOR = 16;
+// Planned prefetches (H5RemoteVFD::Prefetch) merge ranges separated by at most this many bytes, up to a maximum
+// request size, and buffer at most REMOTE_PLAN_MAX_BYTES per file.
+static constexpr idx_t REMOTE_PLAN_MAX_GAP_BYTES = 64ULL * 1024ULL;
+static constexpr idx_t REMOTE_PLAN_MAX_REQUEST_BYTES = 4ULL * 1024ULL * 1024ULL;
+static constexpr idx_t REMOTE_PLAN_MAX_BYTES = 128ULL * 1024ULL * 1024ULL;
+static constexpr idx_t REMOTE_PLAN_KEEP_PLANS = 4;
 static constexpr idx_t REMOTE_LARGE_DATA_CACHE_BUDGET = 200ULL * 1024ULL * 1024ULL;
 static hid_t duckdb_vfd_driver_id = -1;
 static std::once_flag duckdb_vfd_register_once;
@@ -26,6 +46,13 @@ static thread_local ClientContext *duckdb_vfd_open_context = nullptr;
 static thread_local std::string duckdb_vfd_last_error;
 static thread_local bool duckdb_vfd_last_error_interrupted = false;
 
+// Backend opened by H5RemoteVFD::PrepareOpen for the next open of path on this thread.
+struct H5RemotePreparedOpen {
+	std::string path;
+	unique_ptr<H5RemoteBackend> backend;
+};
+static thread_local H5RemotePreparedOpen duckdb_vfd_prepared_open;
+
 struct DuckDBVFDConfig {
 	ClientContext *context;
 };
@@ -63,9 +90,471 @@ static shared_ptr<H5RemoteVFDQueryState> GetOrCreateRemoteVFDQueryState(ClientCo
 	return context.registered_state->GetOrCreate<H5RemoteVFDQueryState>("h5db_remote_vfd_query_state");
 }
 
+static bool IsContextInterrupted(ClientContext *context) {
+	return context && context->interrupted.load(std::memory_order_relaxed);
+}
+
+// Every request sent to the backend, whether for the block cache, a large raw read, or readahead
+static void H5RecordRemoteFetch(idx_t bytes) {
+	H5RecordScanStat(H5ScanCounter::REMOTE_FETCHES);
+	H5RecordScanStat(H5ScanCounter::REMOTE_BYTES_FETCHED, bytes);
+}
+
+struct H5RemoteReadaheadOptions {
+	idx_t block_size = H5DB_DEFAULT_REMOTE_BLOCK_SIZE_BYTES;
+	idx_t max_bytes = 0; // 0 disables readahead
+	idx_t concurrency = 1;
+};
+
+// Detects sequential and fixed-stride raw data reads on one remote file and fetches the predicted byte ranges on
+// background threads, several range requests at a time, while HDF5 is still busy with the current read. Each access
+// stream starts with a window of two requests that doubles on every read continuing the pattern, up to max_bytes
+// of buffered data per file. Requests are sent by up to h5db_remote_readahead_concurrency fetch workers per file,
+// started on first use and kept until the file is closed.
+//
+// Callers can also hand in planned ranges they are about to read (Prefetch), e.g. every chunk of the next h5_read
+// cache windows; those are merged into a few large requests and are not subject to stream detection.
+//
+// The public methods are only called by threads holding hdf5_global_mutex. Fetch workers never take
+// hdf5_global_mutex: they read through their own backend instances, which share DuckDB's external file cache.
+class H5RemoteReadahead {
+public:
+	H5RemoteReadahead(ClientContext &context_p, std::string path_p, idx_t eof_p, H5RemoteReadaheadOptions options_p,
+	                  shared_ptr<H5RemoteVFDQueryState> query_state_p)
+	    : context(context_p), buffer_manager(BufferManager::GetBufferManager(context_p)), path(std::move(path_p)),
+	      eof(eof_p), options(options_p),
+	      query_state(std::move(query_state_p)) {
+	}
+
+	~H5RemoteReadahead() {
+		vector<std::thread> stopping;
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			closing = true;
+			for (auto &segment : queued) {
+				segment->state = SegmentState::DROPPED;
+			}
+			queued.clear();
+			stopping = std::move(workers);
+		}
+		work.notify_all();
+		// Workers finish the request they are sending, if any, and then see closing.
+		for (auto &worker : stopping) {
+			worker.join();
+		}
+	}
+
+	// Copies [offset, offset + size) into buf if prefetched segments cover it, waiting for fetches still in flight.
+	// Segments that have not started are fetched through backend on the calling thread. Returns false (possibly
+	// after writing part of buf) if the range is not covered or a covering fetch failed. planned is set when a
+	// covering segment came from Prefetch.
+	bool TryRead(idx_t offset, idx_t size, char *buf, H5RemoteBackend &backend, bool &planned) {
+		std::unique_lock<std::mutex> guard(lock);
+		auto current = offset;
+		auto end = offset + size;
+		while (current < end) {
+			auto segment = FindCoveringSegmentLocked(current);
+			if (!segment) {
+				return false;
+			}
+			if (segment->state == SegmentState::QUEUED) {
+				// Not started yet: fetch it on this thread instead of waiting for a free slot.
+				segment->state = SegmentState::RUNNING;
+				guard.unlock();
+				auto success = Fetch(*segment, backend, buffer_manager);
+				guard.lock();
+				segment->state = success ? SegmentState::DONE : SegmentState::FAILED;
+				fetched.notify_all();
+			}
+			// Fetching threads notify after every request, which is also when an interrupt is noticed here.
+			fetched.wait(guard,
+			             [&]() { return segment->state != SegmentState::RUNNING || IsContextInterrupted(&context); });
+			if (segment->state == SegmentState::RUNNING) {
+				throw InterruptException();
+			}
+			if (segment->state != SegmentState::DONE) {
+				return false;
+			}
+			auto to_copy = MinValue<idx_t>(end, segment->offset + segment->size) - current;
+			std::memcpy(buf + (current - offset), segment->data.Ptr() + (current - segment->offset), to_copy);
+			current += to_copy;
+			if (segment->plan_generation > 0) {
+				planned = true;
+				// HDF5 reads each chunk once per fill, so a fully consumed plan segment can go right away.
+				segment->consumed += to_copy;
+				if (segment->consumed >= segment->size) {
+					EraseSegmentLocked(*segment);
+				}
+			}
+		}
+		return true;
+	}
+
+	// Fetches ranges the caller is about to read, merging nearby ranges into fewer, larger requests. Unconsumed
+	// segments of older plans are dropped once REMOTE_PLAN_KEEP_PLANS newer plans arrived, so concurrent window
+	// fills do not discard each other's plans.
+	void Prefetch(vector<H5RemoteByteRange> ranges) {
+		std::lock_guard<std::mutex> guard(lock);
+		plan_generation++;
+		for (auto it = segments.begin(); it != segments.end();) {
+			auto &segment = *it->second;
+			if (segment.plan_generation > 0 && segment.plan_generation + REMOTE_PLAN_KEEP_PLANS <= plan_generation) {
+				RetireSegmentLocked(segment);
+				it = segments.erase(it);
+			} else {
+				++it;
+			}
+		}
+
+		std::sort(ranges.begin(), ranges.end(), [](const H5RemoteByteRange &lhs, const H5RemoteByteRange &rhs) {
+			return lhs.offset < rhs.offset;
+		});
+		idx_t i = 0;
+		while (i < ranges.size()) {
+			auto start = ranges[i].offset;
+			auto end = start + ranges[i].size;
+			for (i++; i < ranges.size() && ranges[i].offset <= end + REMOTE_PLAN_MAX_GAP_BYTES; i++) {
+				auto range_end = MaxValue<idx_t>(end, ranges[i].offset + ranges[i].size);
+				if (range_end - start > REMOTE_PLAN_MAX_REQUEST_BYTES) {
+					break;
+				}
+				end = range_end;
+			}
+			end = MinValue<idx_t>(end, eof);
+			// Large single ranges (e.g. a contiguous dataset slice) are split so their pieces download in parallel.
+			for (; start < end; start += REMOTE_PLAN_MAX_REQUEST_BYTES) {
+				auto piece = MinValue<idx_t>(REMOTE_PLAN_MAX_REQUEST_BYTES, end - start);
+				if (!AddSegmentLocked(PLANNED_STREAM, start, piece, plan_generation)) {
+					StartQueuedLocked();
+					return;
+				}
+			}
+		}
+		StartQueuedLocked();
+	}
+
+	// Records a raw data read and, if schedule is set, schedules prefetches when it continues a sequential or
+	// strided stream.
+	void Observe(idx_t offset, idx_t size, bool schedule) {
+		std::lock_guard<std::mutex> guard(lock);
+		clock++;
+
+		auto stream_idx = MatchStreamLocked(offset, size);
+		auto &stream = streams[stream_idx];
+		stream.last_offset = offset;
+		stream.last_size = size;
+		stream.last_used = clock;
+		if (stream.kind != StreamKind::CONTIGUOUS && stream.kind != StreamKind::STRIDED) {
+			return;
+		}
+		DropSegmentsLocked(stream_idx, offset);
+		if (!schedule) {
+			return;
+		}
+		auto initial_window = 2 * stream.piece_size;
+		stream.window = MinValue<idx_t>(MaxValue<idx_t>(stream.window * 2, initial_window), options.max_bytes);
+		if (stream.kind == StreamKind::CONTIGUOUS) {
+			ScheduleContiguousLocked(stream_idx, offset + size);
+		} else {
+			ScheduleStridedLocked(stream_idx, offset);
+		}
+		StartQueuedLocked();
+	}
+
+private:
+	static constexpr idx_t PLANNED_STREAM = REMOTE_READAHEAD_MAX_STREAMS;
+
+	enum class SegmentState : uint8_t { QUEUED, RUNNING, DONE, FAILED, DROPPED };
+	enum class StreamKind : uint8_t { UNUSED, NEW, STRIDE_CANDIDATE, CONTIGUOUS, STRIDED };
+
+	struct Segment {
+		idx_t offset = 0;
+		idx_t size = 0;
+		idx_t stream = 0;          // Stream index, or PLANNED_STREAM
+		idx_t plan_generation = 0; // Prefetch call that planned the segment; 0 for stream readahead
+		idx_t consumed = 0;        // Bytes of a planned segment copied out by TryRead
+		bool through_cache = false;
+		shared_ptr<H5ScanStats> stats; // The scan whose read scheduled the segment, if any
+		SegmentState state = SegmentState::QUEUED; // Protected by lock
+		BufferHandle data; // Pinned buffer written by the fetching thread before state leaves RUNNING
+	};
+
+	struct Stream {
+		StreamKind kind = StreamKind::UNUSED;
+		idx_t last_offset = 0;
+		idx_t last_size = 0;
+		idx_t stride = 0;
+		idx_t piece_size = 0;
+		idx_t window = 0;
+		idx_t next_offset = 0; // First byte (contiguous) or read offset (strided) not yet scheduled
+		idx_t last_used = 0;
+	};
+
+	idx_t MatchStreamLocked(idx_t offset, idx_t size) {
+		// Continuations of established streams, including jumps forward into the already scheduled range
+		for (idx_t i = 0; i < streams.size(); i++) {
+			auto &stream = streams[i];
+			auto stream_end = stream.last_offset + stream.last_size;
+			if (stream.kind == StreamKind::CONTIGUOUS && offset >= stream_end &&
+			    offset <= MaxValue<idx_t>(stream_end, stream.next_offset)) {
+				return i;
+			}
+			if ((stream.kind == StreamKind::STRIDED || stream.kind == StreamKind::STRIDE_CANDIDATE) &&
+			    size == stream.last_size && offset == stream.last_offset + stream.stride) {
+				if (stream.kind == StreamKind::STRIDE_CANDIDATE) {
+					StartStreamLocked(stream, StreamKind::STRIDED, size);
+				}
+				return i;
+			}
+		}
+		// Second read of a stream: directly adjacent, or the nearest equally sized read a short stride behind
+		optional_idx best;
+		for (idx_t i = 0; i < streams.size(); i++) {
+			auto &stream = streams[i];
+			if (stream.kind != StreamKind::NEW || offset <= stream.last_offset) {
+				continue;
+			}
+			auto stream_end = stream.last_offset + stream.last_size;
+			if (offset == stream_end) {
+				StartStreamLocked(stream, StreamKind::CONTIGUOUS, MaxValue<idx_t>(size, stream.last_size));
+				return i;
+			}
+			if (size == stream.last_size && offset > stream_end &&
+			    offset - stream.last_offset <= REMOTE_READAHEAD_MAX_STRIDE_FACTOR * size &&
+			    (!best.IsValid() || stream.last_offset > streams[best.GetIndex()].last_offset)) {
+				best = i;
+			}
+		}
+		if (best.IsValid()) {
+			auto &stream = streams[best.GetIndex()];
+			stream.kind = StreamKind::STRIDE_CANDIDATE;
+			stream.stride = offset - stream.last_offset;
+			return best.GetIndex();
+		}
+		// Otherwise start tracking a new stream in place of the least recently used one
+		idx_t victim = 0;
+		for (idx_t i = 1; i < streams.size(); i++) {
+			if (streams[i].last_used < streams[victim].last_used) {
+				victim = i;
+			}
+		}
+		DropSegmentsLocked(victim, NumericLimits<idx_t>::Maximum());
+		streams[victim] = Stream();
+		streams[victim].kind = StreamKind::NEW;
+		return victim;
+	}
+
+	void StartStreamLocked(Stream &stream, StreamKind kind, idx_t read_size) {
+		stream.kind = kind;
+		stream.window = 0;
+		stream.next_offset = 0;
+		if (kind == StreamKind::CONTIGUOUS) {
+			// Whole blocks on a fixed grid, so repeated scans request the same ranges from the external file cache
+			auto piece_size = MaxValue<idx_t>(read_size, options.block_size);
+			piece_size = (piece_size + options.block_size - 1) / options.block_size * options.block_size;
+			stream.piece_size = MinValue<idx_t>(piece_size, options.max_bytes);
+		} else {
+			stream.piece_size = read_size;
+		}
+	}
+
+	void ScheduleContiguousLocked(idx_t stream_idx, idx_t read_end) {
+		auto &stream = streams[stream_idx];
+		auto target = MinValue<idx_t>(read_end + stream.window, eof);
+		auto cursor = MaxValue<idx_t>(stream.next_offset, read_end / stream.piece_size * stream.piece_size);
+		while (cursor < target) {
+			auto piece = MinValue<idx_t>(stream.piece_size - cursor % stream.piece_size, eof - cursor);
+			if (!AddSegmentLocked(stream_idx, cursor, piece)) {
+				break;
+			}
+			cursor += piece;
+		}
+		stream.next_offset = MaxValue<idx_t>(stream.next_offset, cursor);
+	}
+
+	void ScheduleStridedLocked(idx_t stream_idx, idx_t read_offset) {
+		auto &stream = streams[stream_idx];
+		auto cursor = MaxValue<idx_t>(stream.next_offset, read_offset + stream.stride);
+		while (cursor + stream.piece_size <= eof &&
+		       (cursor - read_offset) / stream.stride * stream.piece_size <= stream.window) {
+			if (!AddSegmentLocked(stream_idx, cursor, stream.piece_size)) {
+				break;
+			}
+			cursor += stream.stride;
+		}
+		stream.next_offset = MaxValue<idx_t>(stream.next_offset, cursor);
+	}
+
+	bool AddSegmentLocked(idx_t stream_idx, idx_t offset, idx_t size, idx_t generation = 0) {
+		auto &used_bytes = generation > 0 ? planned_bytes : buffered_bytes;
+		auto max_bytes = generation > 0 ? REMOTE_PLAN_MAX_BYTES : options.max_bytes;
+		if (size == 0 || used_bytes + size > max_bytes) {
+			return false;
+		}
+		if (segments.find(offset) != segments.end()) {
+			return true;
+		}
+		auto segment = make_shared_ptr<Segment>();
+		segment->offset = offset;
+		segment->size = size;
+		segment->stream = stream_idx;
+		segment->plan_generation = generation;
+		// Raw data goes through DuckDB's external file cache while the query's large-read budget lasts, as in
+		// DuckDBRead
+		segment->through_cache = query_state->TryConsumeLargeDataCacheBudget(size);
+		segment->stats = H5CurrentScanStats();
+		segments.emplace(offset, segment);
+		queued.push_back(std::move(segment));
+		used_bytes += size;
+		return true;
+	}
+
+	// Returns the segment holding offset. Planned and stream segments may overlap, so a few predecessors are
+	// checked.
+	shared_ptr<Segment> FindCoveringSegmentLocked(idx_t offset) {
+		auto it = segments.upper_bound(offset);
+		for (idx_t checked = 0; checked < 4 && it != segments.begin(); checked++) {
+			--it;
+			auto &segment = it->second;
+			if (offset < segment->offset + segment->size) {
+				return segment;
+			}
+		}
+		return nullptr;
+	}
+
+	// Releases the accounting of a segment that is being removed from segments.
+	void RetireSegmentLocked(Segment &segment) {
+		if (segment.state == SegmentState::QUEUED) {
+			segment.state = SegmentState::DROPPED;
+		}
+		(segment.plan_generation > 0 ? planned_bytes : buffered_bytes) -= segment.size;
+	}
+
+	void EraseSegmentLocked(Segment &segment) {
+		auto it = segments.find(segment.offset);
+		if (it != segments.end() && it->second.get() == &segment) {
+			RetireSegmentLocked(segment);
+			segments.erase(it);
+		}
+	}
+
+	// Drops the stream's segments that end at or before offset.
+	void DropSegmentsLocked(idx_t stream_idx, idx_t offset) {
+		for (auto it = segments.begin(); it != segments.end();) {
+			auto &segment = *it->second;
+			if (segment.stream == stream_idx && segment.offset + segment.size <= offset) {
+				RetireSegmentLocked(segment);
+				it = segments.erase(it);
+			} else {
+				++it;
+			}
+		}
+	}
+
+	// Wakes the fetch workers for newly queued segments, starting more of them while there are fewer idle workers
+	// than queued segments, up to the configured concurrency.
+	void StartQueuedLocked() {
+		if (closing || queued.empty()) {
+			return;
+		}
+		while (workers.size() < options.concurrency && idle_workers < queued.size()) {
+			workers.emplace_back([this]() { RunWorker(); });
+			idle_workers++;
+		}
+		work.notify_all();
+	}
+
+	// Fetch worker: sends the queued segments' requests one at a time through its own backend until the readahead
+	// is closed. Segments scheduled while the query is interrupted fail without a request.
+	void RunWorker() {
+		unique_ptr<H5RemoteBackend> reader;
+		std::unique_lock<std::mutex> guard(lock);
+		while (true) {
+			work.wait(guard, [&]() { return closing || !queued.empty(); });
+			if (closing) {
+				return;
+			}
+			auto segment = std::move(queued.front());
+			queued.pop_front();
+			if (segment->state != SegmentState::QUEUED) {
+				continue;
+			}
+			segment->state = SegmentState::RUNNING;
+			idle_workers--;
+			guard.unlock();
+
+			auto success = false;
+			if (!IsContextInterrupted(&context)) {
+				// Fetches count towards the scan that scheduled them, like reads on the scan's own threads.
+				unique_ptr<H5ScanStatsScope> stats_scope;
+				if (segment->stats) {
+					stats_scope = make_uniq<H5ScanStatsScope>(segment->stats);
+				}
+				try {
+					if (!reader) {
+						reader = OpenH5RemoteBackend(context, path);
+					}
+					success = Fetch(*segment, *reader, buffer_manager);
+				} catch (...) {
+					// Reported by the read that needs the bytes, see Fetch
+				}
+			}
+
+			guard.lock();
+			segment->state = success ? SegmentState::DONE : SegmentState::FAILED;
+			idle_workers++;
+			fetched.notify_all();
+		}
+	}
+
+	// Errors are not reported here: the read that needs the bytes falls back to the regular path and reports them
+	// there. That includes running out of memory for the buffer, which is allocated from the buffer manager so that
+	// readahead counts against memory_limit.
+	static bool Fetch(Segment &segment, H5RemoteBackend &reader, BufferManager &buffer_manager) {
+		try {
+			segment.data = buffer_manager.Allocate(MemoryTag::EXTENSION, segment.size);
+			auto data = char_ptr_cast(segment.data.Ptr());
+			H5RecordRemoteFetch(segment.size);
+			if (segment.through_cache) {
+				reader.ReadCached(segment.offset, segment.size, data);
+			} else {
+				reader.ReadDirect(segment.offset, segment.size, data);
+			}
+			return true;
+		} catch (...) {
+			segment.data.Destroy();
+			return false;
+		}
+	}
+
+	ClientContext &context;
+	BufferManager &buffer_manager;
+	const std::string path;
+	const idx_t eof;
+	const H5RemoteReadaheadOptions options;
+	shared_ptr<H5RemoteVFDQueryState> query_state;
+
+	std::mutex lock;
+	std::condition_variable fetched; // Notified whenever a segment is fetched or fails
+	std::condition_variable work;    // Notified when segments are queued or the readahead closes
+	std::array<Stream, REMOTE_READAHEAD_MAX_STREAMS> streams;
+	idx_t clock = 0;
+	std::map<idx_t, shared_ptr<Segment>> segments; // Scheduled segments by offset
+	idx_t buffered_bytes = 0;                      // Total size of stream segments
+	idx_t planned_bytes = 0;                       // Total size of planned segments
+	idx_t plan_generation = 0;
+	std::deque<shared_ptr<Segment>> queued;
+	bool closing = false;
+	vector<std::thread> workers;
+	idx_t idle_workers = 0; // Workers not sending a request
+};
+
 struct H5FD_duckdb_t : public H5FD_t {
+	// Blocks live unpinned in the buffer manager between reads, so they count against memory_limit and may be
+	// evicted under memory pressure; an evicted block is fetched again on its next use.
 	struct CachedBlock {
-		std::vector<char> data;
+		shared_ptr<BlockHandle> data;
 		idx_t valid_bytes = 0;
 		std::list<idx_t>::iterator lru_it;
 	};
@@ -73,12 +562,16 @@ struct H5FD_duckdb_t : public H5FD_t {
 
 	unique_ptr<H5RemoteBackend> backend;
 	ClientContext *context = nullptr;
+	BufferManager *buffer_manager = nullptr;
 	std::string path;
 	haddr_t eof;
 	haddr_t eoa;
 	shared_ptr<H5RemoteVFDQueryState> query_state;
+	idx_t block_size = H5DB_DEFAULT_REMOTE_BLOCK_SIZE_BYTES;
+	idx_t metadata_prefetch_bytes = 0; // File head loaded by the first metadata read, 0 when disabled
 	CachedBlockMap cached_blocks;
 	std::list<idx_t> cache_lru;
+	unique_ptr<H5RemoteReadahead> readahead; // Null when disabled or unsupported by the backend
 };
 
 static inline H5FD_duckdb_t *GetFile(H5FD_t *f) {
@@ -89,12 +582,8 @@ static inline const H5FD_duckdb_t *GetFile(const H5FD_t *f) {
 	return reinterpret_cast<const H5FD_duckdb_t *>(f);
 }
 
-static inline idx_t CacheBlockId(idx_t offset) {
-	return offset / REMOTE_CACHE_BLOCK_SIZE;
-}
-
-static bool IsContextInterrupted(ClientContext *context) {
-	return context && context->interrupted.load(std::memory_order_relaxed);
+static inline idx_t CacheBlockId(const H5FD_duckdb_t &file, idx_t offset) {
+	return offset / file.block_size;
 }
 
 static void ThrowIfContextInterrupted(ClientContext *context) {
@@ -123,25 +612,65 @@ static void TouchBlock(H5FD_duckdb_t &file, H5FD_duckdb_t::CachedBlockMap::itera
 	it->second.lru_it = file.cache_lru.begin();
 }
 
-static void EvictBlockIfNeeded(H5FD_duckdb_t &file) {
-	while (file.cached_blocks.size() >= REMOTE_CACHE_MAX_BLOCKS && !file.cache_lru.empty()) {
+// Makes room for block_count new blocks.
+static void EvictBlocksIfNeeded(H5FD_duckdb_t &file, idx_t block_count) {
+	while (file.cached_blocks.size() + block_count > REMOTE_CACHE_MAX_BLOCKS && !file.cache_lru.empty()) {
 		auto evict_block_id = file.cache_lru.back();
 		file.cache_lru.pop_back();
 		file.cached_blocks.erase(evict_block_id);
 	}
 }
 
-static H5FD_duckdb_t::CachedBlock &LoadCachedBlock(H5FD_duckdb_t &file, idx_t block_id) {
+// Exclusive end of the blocks a cache miss on block_id loads with one request. A metadata miss inside the file head
+// loads the rest of the head, where HDF5 keeps the superblock, the root group and usually most other metadata of
+// files written in one go; other metadata misses load the next few blocks, since object headers, B-tree nodes and
+// heaps are often allocated next to each other. Both stop at the first block that is already cached.
+static idx_t CacheMissRunEnd(const H5FD_duckdb_t &file, idx_t block_id, bool metadata) {
+	if (!metadata || file.metadata_prefetch_bytes == 0) {
+		return block_id + 1;
+	}
+	auto head_blocks = (file.metadata_prefetch_bytes + file.block_size - 1) / file.block_size;
+	auto file_blocks = (static_cast<idx_t>(file.eof) + file.block_size - 1) / file.block_size;
+	auto limit = MinValue<idx_t>(block_id < head_blocks ? head_blocks : block_id + REMOTE_METADATA_RUN_BLOCKS,
+	                             file_blocks);
+	auto run_end = block_id + 1;
+	while (run_end < limit && file.cached_blocks.find(run_end) == file.cached_blocks.end()) {
+		run_end++;
+	}
+	return run_end;
+}
+
+static void AddCachedBlock(H5FD_duckdb_t &file, idx_t block_id, BufferHandle &pinned, idx_t valid_bytes) {
+	H5FD_duckdb_t::CachedBlock block;
+	block.data = pinned.GetBlockHandle();
+	block.valid_bytes = valid_bytes;
+	file.cache_lru.push_front(block_id);
+	block.lru_it = file.cache_lru.begin();
+	file.cached_blocks.emplace(block_id, std::move(block));
+}
+
+// Returns the pinned block and sets valid_bytes to the number of bytes it holds. On a miss, metadata reads may load
+// the blocks after it with the same request, see CacheMissRunEnd.
+static BufferHandle LoadCachedBlock(H5FD_duckdb_t &file, idx_t block_id, bool metadata, idx_t &valid_bytes) {
 	auto it = file.cached_blocks.find(block_id);
 	if (it != file.cached_blocks.end()) {
-		TouchBlock(file, it);
-		return it->second;
+		auto pinned = file.buffer_manager->Pin(it->second.data);
+		if (pinned.IsValid()) {
+			TouchBlock(file, it);
+			H5RecordScanStat(H5ScanCounter::REMOTE_BLOCK_HITS);
+			valid_bytes = it->second.valid_bytes;
+			return pinned;
+		}
+		// Evicted by the buffer manager
+		file.cache_lru.erase(it->second.lru_it);
+		file.cached_blocks.erase(it);
 	}
 
-	EvictBlockIfNeeded(file);
+	auto run_end = CacheMissRunEnd(file, block_id, metadata);
+	EvictBlocksIfNeeded(file, run_end - block_id);
 
-	auto block_offset = block_id * REMOTE_CACHE_BLOCK_SIZE;
-	auto bytes_to_read = MinValue<idx_t>(REMOTE_CACHE_BLOCK_SIZE, static_cast<idx_t>(file.eof) - block_offset);
+	auto block_offset = block_id * file.block_size;
+	auto bytes_to_read = MinValue<idx_t>(run_end * file.block_size, static_cast<idx_t>(file.eof)) - block_offset;
 	if (bytes_to_read == 0) {
 		throw IOException("Failed to load remote cache block: zero bytes available");
 	}
@@ -150,34 +679,54 @@ static H5FD_duckdb_t::CachedBlock &LoadCachedBlock(H5FD_duckdb_t &file, idx_t bl
 	}
 
 	ThrowIfContextInterrupted(file.context);
-	H5FD_duckdb_t::CachedBlock block;
-	block.data.resize(bytes_to_read);
-	file.backend->ReadCached(block_offset, bytes_to_read, block.data.data());
-	ThrowIfContextInterrupted(file.context);
-	block.valid_bytes = bytes_to_read;
-	file.cache_lru.push_front(block_id);
-	block.lru_it = file.cache_lru.begin();
+	H5RecordScanStat(H5ScanCounter::REMOTE_BLOCK_MISSES);
+	H5RecordRemoteFetch(bytes_to_read);
+	if (run_end == block_id + 1) {
+		auto pinned = file.buffer_manager->Allocate(MemoryTag::EXTENSION, bytes_to_read);
+		file.backend->ReadCached(block_offset, bytes_to_read, char_ptr_cast(pinned.Ptr()));
+		ThrowIfContextInterrupted(file.context);
+		AddCachedBlock(file, block_id, pinned, bytes_to_read);
+		valid_bytes = bytes_to_read;
+		return pinned;
+	}
 
-	auto inserted = file.cached_blocks.emplace(block_id, std::move(block));
-	return inserted.first->second;
+	auto run = file.buffer_manager->Allocate(MemoryTag::EXTENSION, bytes_to_read);
+	file.backend->ReadCached(block_offset, bytes_to_read, char_ptr_cast(run.Ptr()));
+	ThrowIfContextInterrupted(file.context);
+	H5RecordScanStat(H5ScanCounter::REMOTE_BLOCK_PREFETCHES, run_end - block_id - 1);
+	// Added back to front, so the block that was asked for is the most recently used one.
+	BufferHandle result;
+	for (auto id = run_end; id-- > block_id;) {
+		auto offset_in_run = (id - block_id) * file.block_size;
+		auto block_bytes = MinValue<idx_t>(file.block_size, bytes_to_read - offset_in_run);
+		auto pinned = file.buffer_manager->Allocate(MemoryTag::EXTENSION, block_bytes);
+		std::memcpy(pinned.Ptr(), run.Ptr() + offset_in_run, block_bytes);
+		AddCachedBlock(file, id, pinned, block_bytes);
+		if (id == block_id) {
+			valid_bytes = block_bytes;
+			result = std::move(pinned);
+		}
+	}
+	return result;
 }
 
-static void ReadFromBlockCache(H5FD_duckdb_t &file, idx_t read_offset, idx_t read_size, void *buf) {
+static void ReadFromBlockCache(H5FD_duckdb_t &file, idx_t read_offset, idx_t read_size, bool metadata, void *buf) {
 	auto *out = static_cast<char *>(buf);
 	idx_t remaining = read_size;
 	idx_t current_offset = read_offset;
 	while (remaining > 0) {
 		ThrowIfContextInterrupted(file.context);
-		auto block_id = CacheBlockId(current_offset);
-		auto &block = LoadCachedBlock(file, block_id);
-		auto block_offset = block_id * REMOTE_CACHE_BLOCK_SIZE;
+		auto block_id = CacheBlockId(file, current_offset);
+		idx_t valid_bytes;
+		auto block = LoadCachedBlock(file, block_id, metadata, valid_bytes);
+		auto block_offset = block_id * file.block_size;
 		auto offset_in_block = current_offset - block_offset;
-		if (offset_in_block >= block.valid_bytes) {
+		if (offset_in_block >= valid_bytes) {
 			throw IOException("Failed to read remote cache block: read past valid block data");
 		}
-		auto bytes_in_block = block.valid_bytes - offset_in_block;
+		auto bytes_in_block = valid_bytes - offset_in_block;
 		auto to_copy = MinValue<idx_t>(remaining, bytes_in_block);
-		std::memcpy(out, block.data.data() + offset_in_block, to_copy);
+		std::memcpy(out, block.Ptr() + offset_in_block, to_copy);
 		out += to_copy;
 		current_offset += to_copy;
 		remaining -= to_copy;
@@ -190,6 +739,7 @@ static void ReadExact(H5FD_duckdb_t &file, idx_t read_offset, idx_t read_size, v
 		throw IOException("Failed to read remote data: no readable backend");
 	}
 	ThrowIfContextInterrupted(file.context);
+	H5RecordRemoteFetch(read_size);
 	file.backend->ReadDirect(read_offset, read_size, buf);
 	ThrowIfContextInterrupted(file.context);
 }
@@ -199,6 +749,7 @@ static void ReadExactCached(H5FD_duckdb_t &file, idx_t read_offset, idx_t read_s
 		throw IOException("Failed to read remote data: no readable backend");
 	}
 	ThrowIfContextInterrupted(file.context);
+	H5RecordRemoteFetch(read_size);
 	file.backend->ReadCached(read_offset, read_size, buf);
 	ThrowIfContextInterrupted(file.context);
 }
@@ -237,12 +788,30 @@ static H5FD_t *DuckDBOpen(const char *name, unsigned flags, hid_t fapl_id, haddr
 	try {
 		ThrowIfContextInterrupted(context);
 		auto file = make_uniq<H5FD_duckdb_t>();
-		file->backend = OpenH5RemoteBackend(*context, name);
+		if (duckdb_vfd_prepared_open.backend && duckdb_vfd_prepared_open.path == name) {
+			file->backend = std::move(duckdb_vfd_prepared_open.backend);
+		} else {
+			file->backend = OpenH5RemoteBackend(*context, name);
+		}
 		file->context = context;
+		file->buffer_manager = &BufferManager::GetBufferManager(*context);
 		file->path = name;
 		file->query_state = GetOrCreateRemoteVFDQueryState(*context);
 		file->eof = static_cast<haddr_t>(file->backend->GetFileSize());
 		file->eoa = file->eof;
+		file->block_size = ResolveRemoteBlockSizeOption(*context);
+		// At most half of the block cache, so the head does not push out everything else.
+		file->metadata_prefetch_bytes = MinValue<idx_t>(ResolveRemoteMetadataPrefetchOption(*context),
+		                                                REMOTE_CACHE_MAX_BLOCKS / 2 * file->block_size);
+		H5RemoteReadaheadOptions readahead_options;
+		readahead_options.block_size = file->block_size;
+		readahead_options.max_bytes = ResolveRemoteReadaheadOption(*context);
+		readahead_options.concurrency = ResolveRemoteReadaheadConcurrencyOption(*context);
+		// SFTP sessions are single-threaded and cached per query, so prefetching needs DuckDB's own file systems.
+		if (readahead_options.max_bytes > 0 && DescribeH5RemotePath(name).type == H5RemoteBackendType::DUCKDB_FS) {
+			file->readahead = make_uniq<H5RemoteReadahead>(*context, file->path, static_cast<idx_t>(file->eof),
+			                                               readahead_options, file->query_state);
+		}
 		ClearLastErrorInternal();
 		return reinterpret_cast<H5FD_t *>(file.release());
 	} catch (const InterruptException &) {
@@ -316,18 +885,34 @@ static herr_t DuckDBRead(H5FD_t *file, H5FD_mem_t mem_type, hid_t, haddr_t addr,
 		ThrowIfContextInterrupted(f->context);
 		auto read_size = static_cast<idx_t>(size);
 		auto read_offset = static_cast<idx_t>(addr);
+		H5RecordScanStat(H5ScanCounter::REMOTE_READS);
+		H5RecordScanStat(H5ScanCounter::REMOTE_BYTES_READ, read_size);
 		// HDF5 can issue tiny chunk-sized raw reads even when the application requested a large hyperslab. Use the
 		// VFD block cache for small reads to collapse those requests. For large raw reads, route only a limited number
 		// of requested bytes through ReadExactCached before falling back to ReadExact. This budget controls the VFD's
 		// routing decision, not the exact number of bytes DuckDB's external file cache may admit.
-		if (mem_type == H5FD_MEM_DRAW && read_size >= REMOTE_CACHE_BLOCK_SIZE) {
+		// Raw data reads also feed the readahead engine, which is consulted first; metadata stays on the block cache.
+		if (mem_type == H5FD_MEM_DRAW && f->readahead) {
+			bool planned = false;
+			auto prefetched =
+			    f->readahead->TryRead(read_offset, read_size, static_cast<char *>(buf), *f->backend, planned);
+			// Reads covered by a caller's plan keep stream state current without prefetching on top of the plan.
+			f->readahead->Observe(read_offset, read_size, !planned);
+			if (prefetched) {
+				H5RecordScanStat(H5ScanCounter::REMOTE_READAHEAD_HITS);
+				ThrowIfContextInterrupted(f->context);
+				ClearLastErrorInternal();
+				return 0;
+			}
+		}
+		if (mem_type == H5FD_MEM_DRAW && read_size >= f->block_size) {
 			if (f->query_state->TryConsumeLargeDataCacheBudget(read_size)) {
 				ReadExactCached(*f, read_offset, read_size, buf);
 			} else {
 				ReadExact(*f, read_offset, read_size, buf);
 			}
 		} else {
-			ReadFromBlockCache(*f, read_offset, read_size, buf);
+			ReadFromBlockCache(*f, read_offset, read_size, mem_type != H5FD_MEM_DRAW, buf);
 		}
 		ClearLastErrorInternal();
 		return 0;
@@ -346,6 +931,14 @@ static herr_t DuckDBRead(H5FD_t *file, H5FD_mem_t mem_type, hid_t, haddr_t addr,
 	}
 }
 
+static herr_t DuckDBGetHandle(H5FD_t *file, hid_t, void **file_handle) {
+	if (!file_handle) {
+		return -1;
+	}
+	*file_handle = file;
+	return 0;
+}
+
 static herr_t DuckDBWrite(H5FD_t *, H5FD_mem_t, hid_t, haddr_t, size_t, const void *) {
 	return -1;
 }
@@ -384,6 +977,7 @@ static const H5FD_class_t &DuckDBVFDClass() {
 		cls.get_eof = DuckDBGetEOF;
 		cls.read = DuckDBRead;
 		cls.write = DuckDBWrite;
+		cls.get_handle = DuckDBGetHandle;
 		cls.truncate = DuckDBTruncate;
 		cls.lock = DuckDBLock;
 		cls.unlock = DuckDBUnlock;
@@ -415,13 +1009,93 @@ std::string H5RemoteVFD::GetRequiredExtension(const std::string &path) {
 	return DescribeH5RemotePath(path).required_extension;
 }
 
-void H5RemoteVFD::ConfigureFAPL(ClientContext &context, hid_t fapl_id) {
+bool H5RemoteVFD::ConfigureFAPL(ClientContext &context, hid_t fapl_id, bool page_buffer) {
 	DuckDBVFDConfig config;
 	config.context = &context;
 
 	if (H5Pset_driver(fapl_id, GetDriver(), &config) < 0) {
 		throw IOException("Failed to configure h5db remote HDF5 VFD");
 	}
+
+	auto metadata_cache_size = ResolveRemoteMetadataCacheOption(context);
+	if (metadata_cache_size > 0) {
+		H5AC_cache_config_t cache_config;
+		cache_config.version = H5AC__CURR_CACHE_CONFIG_VERSION;
+		if (H5Pget_mdc_config(fapl_id, &cache_config) < 0) {
+			throw IOException("Failed to read the HDF5 metadata cache configuration");
+		}
+		// Starts at the configured size instead of growing to it through HDF5's adaptive resizing.
+		cache_config.set_initial_size = true;
+		cache_config.initial_size = metadata_cache_size;
+		cache_config.min_size = MinValue<size_t>(cache_config.min_size, metadata_cache_size);
+		cache_config.max_size = MaxValue<size_t>(cache_config.max_size, metadata_cache_size);
+		if (H5Pset_mdc_config(fapl_id, &cache_config) < 0) {
+			throw IOException("Failed to configure the HDF5 metadata cache of remote files");
+		}
+	}
+
+	auto page_buffer_size = page_buffer ? ResolveRemotePageBufferOption(context) : 0;
+	if (page_buffer_size == 0) {
+		return false;
+	}
+	if (H5Pset_page_buffer_size(fapl_id, page_buffer_size, 0, 0) < 0) {
+		throw IOException("Failed to configure the HDF5 page buffer of remote files");
+	}
+	return true;
+}
+
+// Returns the VFD file of an open HDF5 file if it was opened through the h5db remote VFD. Caller must hold
+// hdf5_global_mutex.
+static H5FD_duckdb_t *TryGetRemoteVFDFile(hid_t file_id) {
+	if (duckdb_vfd_driver_id < 0) {
+		return nullptr;
+	}
+	H5ErrorSuppressor suppress;
+	hid_t fapl_id = H5Fget_access_plist(file_id);
+	if (fapl_id < 0) {
+		return nullptr;
+	}
+	auto driver_id = H5Pget_driver(fapl_id);
+	H5Pclose(fapl_id);
+	if (driver_id != duckdb_vfd_driver_id) {
+		return nullptr;
+	}
+	void *handle = nullptr;
+	if (H5Fget_vfd_handle(file_id, H5P_DEFAULT, &handle) < 0 || !handle) {
+		return nullptr;
+	}
+	return GetFile(static_cast<H5FD_t *>(handle));
+}
+
+bool H5RemoteVFD::SupportsPrefetch(hid_t file_id) {
+	auto file = TryGetRemoteVFDFile(file_id);
+	return file && file->readahead;
+}
+
+void H5RemoteVFD::Prefetch(hid_t file_id, vector<H5RemoteByteRange> ranges) {
+	auto file = TryGetRemoteVFDFile(file_id);
+	if (file && file->readahead && !ranges.empty()) {
+		file->readahead->Prefetch(std::move(ranges));
+	}
+}
+
+void H5RemoteVFD::PrepareOpen(ClientContext &context, const std::string &path) {
+	ClearPreparedOpen();
+	// SFTP connections are shared per query and only used while holding hdf5_global_mutex.
+	if (DescribeH5RemotePath(path).type != H5RemoteBackendType::DUCKDB_FS) {
+		return;
+	}
+	try {
+		duckdb_vfd_prepared_open.backend = OpenH5RemoteBackend(context, path);
+		duckdb_vfd_prepared_open.path = path;
+	} catch (std::exception &) {
+		// The open through HDF5 tries again and reports the error.
+	}
+}
+
+void H5RemoteVFD::ClearPreparedOpen() {
+	duckdb_vfd_prepared_open.backend.reset();
+	duckdb_vfd_prepared_open.path.clear();
 }
 
 void H5RemoteVFD::SetOpenContext(ClientContext *context) {
@@ -436,6 +1110,10 @@ void H5RemoteVFD::ClearLastError() {
 	ClearLastErrorInternal();
 }
 
+bool H5RemoteVFD::HasLastError() {
+	return !duckdb_vfd_last_error.empty();
+}
+
 H5RemoteErrorInfo H5RemoteVFD::TakeLastErrorInfo() {
 	H5RemoteErrorInfo error;
 	error.message = duckdb_vfd_last_error;
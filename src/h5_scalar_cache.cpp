@@ -0,0 +1,354 @@
+#include "h5_scalar_cache.hpp"
+#include "h5_file_cache.hpp"
+#include "h5_internal.hpp"
+#include "h5_scan_stats.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/main/client_context_state.hpp"
+#if __has_include("duckdb/common/vector/constant_vector.hpp")
+#include "duckdb/common/vector/constant_vector.hpp"
+#include "duckdb/common/vector/flat_vector.hpp"
+#else
+#include "duckdb/common/types/vector.hpp"
+#endif
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace duckdb {
+
+namespace {
+
+idx_t H5SaturatingAdd(idx_t left, idx_t right) {
+	return left > NumericLimits<idx_t>::Maximum() - right ? NumericLimits<idx_t>::Maximum() : left + right;
+}
+
+struct H5ScalarCacheValue {
+	unique_ptr<Vector> value; // One row of the function's result type
+	idx_t size = 0;           // Estimated size reported by the function
+	idx_t charged_size = 0;   // size plus the entry's own overhead, counted against h5db_scalar_cache_size
+	std::list<std::pair<string, string>>::iterator lru_position;
+};
+
+struct H5ScalarCacheFile {
+	H5FileIdentity identity;
+	std::unordered_map<string, shared_ptr<H5ScalarCacheValue>> values;
+	bool validated = false; // Identity checked during the current query
+};
+
+class H5ScalarCacheState : public ClientContextState {
+public:
+	void QueryBegin(ClientContext &) override {
+		std::lock_guard<std::mutex> guard(lock);
+		for (auto &file : files) {
+			file.second->validated = false;
+		}
+	}
+
+	// Returns the identity of filename as of the current query, or nullopt when its results cannot be cached. Cached
+	// results of a file that changed are dropped.
+	std::optional<H5FileIdentity> Validate(ClientContext &context, const string &filename) {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			auto it = files.find(filename);
+			if (it != files.end() && it->second->validated) {
+				return it->second->identity;
+			}
+		}
+		auto identity = H5TryGetFileIdentity(context, filename);
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = files.find(filename);
+		if (it == files.end()) {
+			return identity;
+		}
+		if (!identity || *identity != it->second->identity) {
+			RemoveFileLocked(it);
+			return identity;
+		}
+		it->second->validated = true;
+		return identity;
+	}
+
+	shared_ptr<H5ScalarCacheValue> Lookup(const string &filename, const H5FileIdentity &identity, const string &key) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto file_it = files.find(filename);
+		if (file_it == files.end() || file_it->second->identity != identity) {
+			return nullptr;
+		}
+		auto value_it = file_it->second->values.find(key);
+		if (value_it == file_it->second->values.end()) {
+			return nullptr;
+		}
+		lru.splice(lru.begin(), lru, value_it->second->lru_position);
+		return value_it->second;
+	}
+
+	void Store(const string &filename, const H5FileIdentity &identity, const string &key, unique_ptr<Vector> value,
+	           idx_t size, idx_t capacity) {
+		auto entry = make_shared_ptr<H5ScalarCacheValue>();
+		entry->value = std::move(value);
+		entry->size = size;
+		entry->charged_size = H5SaturatingAdd(size, sizeof(H5ScalarCacheValue) + filename.size() + 2 * key.size());
+		if (entry->charged_size > capacity) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(lock);
+		auto file_it = files.find(filename);
+		if (file_it == files.end()) {
+			auto file = make_shared_ptr<H5ScalarCacheFile>();
+			file->identity = identity;
+			file->validated = true;
+			file_it = files.emplace(filename, std::move(file)).first;
+		} else if (file_it->second->identity != identity) {
+			// The file changed while this query read it; keep the result of the newer lookup.
+			return;
+		}
+		if (file_it->second->values.count(key) != 0) {
+			// Another thread stored the same result first.
+			return;
+		}
+		lru.emplace_front(filename, key);
+		entry->lru_position = lru.begin();
+		total_size += entry->charged_size;
+		file_it->second->values.emplace(key, std::move(entry));
+		EvictLocked(capacity);
+	}
+
+	void Evict(idx_t capacity) {
+		std::lock_guard<std::mutex> guard(lock);
+		EvictLocked(capacity);
+	}
+
+private:
+	using FileMap = std::unordered_map<string, shared_ptr<H5ScalarCacheFile>>;
+	using ValueMap = std::unordered_map<string, shared_ptr<H5ScalarCacheValue>>;
+
+	void RemoveValueLocked(FileMap::iterator file_it, ValueMap::iterator value_it) {
+		lru.erase(value_it->second->lru_position);
+		total_size -= value_it->second->charged_size;
+		file_it->second->values.erase(value_it);
+		if (file_it->second->values.empty()) {
+			files.erase(file_it);
+		}
+	}
+
+	void RemoveFileLocked(FileMap::iterator file_it) {
+		auto &values = file_it->second->values;
+		while (!values.empty()) {
+			auto value_it = values.begin();
+			lru.erase(value_it->second->lru_position);
+			total_size -= value_it->second->charged_size;
+			values.erase(value_it);
+		}
+		files.erase(file_it);
+	}
+
+	void EvictLocked(idx_t capacity) {
+		while (total_size > capacity) {
+			auto &oldest = lru.back();
+			auto file_it = files.find(oldest.first);
+			D_ASSERT(file_it != files.end());
+			auto value_it = file_it->second->values.find(oldest.second);
+			D_ASSERT(value_it != file_it->second->values.end());
+			RemoveValueLocked(file_it, value_it);
+		}
+	}
+
+	std::mutex lock;
+	std::list<std::pair<string, string>> lru; // (filename, key), most recently used first
+	FileMap files;
+	idx_t total_size = 0;
+};
+
+// Returns the cache when it is enabled and may hold results of a read with this swmr mode, after trimming it to the
+// configured size.
+shared_ptr<H5ScalarCacheState> GetUsableScalarCache(ClientContext &context, bool swmr, idx_t &capacity) {
+	capacity = ResolveScalarCacheSizeOption(context);
+	auto state = capacity == 0 ? context.registered_state->Get<H5ScalarCacheState>("h5db_scalar_cache")
+	                           : context.registered_state->GetOrCreate<H5ScalarCacheState>("h5db_scalar_cache");
+	if (state) {
+		state->Evict(capacity);
+	}
+	if (capacity == 0 || swmr) {
+		return nullptr;
+	}
+	return state;
+}
+
+// The rows of one chunk that read from one file, with their object paths deduplicated.
+struct H5ScalarFileRows {
+	string filename;
+	vector<string> paths;                          // Distinct object paths, in order of first use
+	std::unordered_map<string, idx_t> path_lookup; // Index of every path in paths
+	vector<idx_t> row_idxs;                        // Result rows
+	vector<idx_t> row_path_idxs;                   // Index into paths for every result row
+	unique_ptr<Vector> values;                     // One row per path
+	vector<idx_t> sizes;                           // Estimated size of every value
+	vector<bool> cached;                           // Whether every value came from the cache
+};
+
+string H5ScalarCacheEntryKey(const string &cache_key, const string &path) {
+	// The length prefix keeps function keys and paths from running into each other.
+	return std::to_string(cache_key.size()) + ":" + cache_key + path;
+}
+
+void H5ScalarEvaluateFile(ClientContext &context, H5ScalarFileRows &file_rows, const LogicalType &type, bool swmr,
+                          const string &cache_key, const H5ScalarReadPaths &read_paths) {
+	ThrowIfInterrupted(context);
+	auto path_count = file_rows.paths.size();
+	file_rows.values = make_uniq<Vector>(type, path_count);
+	file_rows.sizes.assign(path_count, 0);
+	file_rows.cached.assign(path_count, false);
+
+	idx_t capacity;
+	auto cache = GetUsableScalarCache(context, swmr, capacity);
+	std::optional<H5FileIdentity> identity;
+	if (cache) {
+		identity = cache->Validate(context, file_rows.filename);
+	}
+
+	vector<idx_t> missing;
+	for (idx_t path_idx = 0; path_idx < path_count; path_idx++) {
+		if (identity) {
+			auto key = H5ScalarCacheEntryKey(cache_key, file_rows.paths[path_idx]);
+			if (auto entry = cache->Lookup(file_rows.filename, *identity, key)) {
+				VectorOperations::Copy(*entry->value, *file_rows.values, 1, 0, path_idx);
+				file_rows.sizes[path_idx] = entry->size;
+				file_rows.cached[path_idx] = true;
+				continue;
+			}
+		}
+		missing.push_back(path_idx);
+	}
+	if (identity) {
+		H5RecordScanStat(H5ScanCounter::SCALAR_CACHE_HITS, path_count - missing.size());
+		H5RecordScanStat(H5ScanCounter::SCALAR_CACHE_MISSES, missing.size());
+	}
+	if (missing.empty()) {
+		return;
+	}
+
+	read_paths(file_rows.filename, file_rows.paths, missing, *file_rows.values, file_rows.sizes, identity.has_value());
+	if (!identity) {
+		return;
+	}
+	for (auto path_idx : missing) {
+		auto value = make_uniq<Vector>(type, 1);
+		VectorOperations::Copy(*file_rows.values, *value, path_idx + 1, path_idx, 0);
+		cache->Store(file_rows.filename, *identity, H5ScalarCacheEntryKey(cache_key, file_rows.paths[path_idx]),
+		             std::move(value), file_rows.sizes[path_idx], capacity);
+	}
+}
+
+// Evaluates the files of a chunk in order. HDF5 runs one call at a time anyway, and DuckDB already evaluates the
+// function on several chunks in parallel, so more threads per chunk would only oversubscribe the CPU.
+void H5ScalarEvaluateFiles(ClientContext &context, vector<H5ScalarFileRows> &files, const LogicalType &type,
+                           bool swmr, const string &cache_key, const H5ScalarReadPaths &read_paths) {
+	for (auto &file_rows : files) {
+		H5ScalarEvaluateFile(context, file_rows, type, swmr, cache_key, read_paths);
+	}
+}
+
+} // namespace
+
+void H5ScalarExecute(DataChunk &args, ExpressionState &state, Vector &result, bool swmr, const string &cache_key,
+                     const H5ScalarReadPaths &read_paths, const H5ScalarReuseRow &reuse_row) {
+	if (args.size() == 0) {
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+		return;
+	}
+
+	auto &filename_vec = args.data[0];
+	auto &path_vec = args.data[1];
+	UnifiedVectorFormat filename_data;
+	UnifiedVectorFormat path_data;
+	filename_vec.ToUnifiedFormat(args.size(), filename_data);
+	path_vec.ToUnifiedFormat(args.size(), path_data);
+	auto filename_ptr = UnifiedVectorFormat::GetData<string_t>(filename_data);
+	auto path_ptr = UnifiedVectorFormat::GetData<string_t>(path_data);
+	auto &context = state.GetContext();
+	auto constant = filename_vec.GetVectorType() == VectorType::CONSTANT_VECTOR &&
+	                path_vec.GetVectorType() == VectorType::CONSTANT_VECTOR;
+	auto row_count = constant ? 1 : args.size();
+	result.SetVectorType(constant ? VectorType::CONSTANT_VECTOR : VectorType::FLAT_VECTOR);
+
+	std::unordered_map<string, idx_t> file_lookup;
+	vector<H5ScalarFileRows> files;
+	for (idx_t i = 0; i < row_count; i++) {
+		auto filename_idx = filename_data.sel->get_index(i);
+		auto path_idx = path_data.sel->get_index(i);
+		if (!filename_data.validity.RowIsValid(filename_idx) || !path_data.validity.RowIsValid(path_idx)) {
+			if (constant) {
+				ConstantVector::SetNull(result, true);
+				return;
+			}
+			FlatVector::Validity(result).SetInvalid(i);
+			continue;
+		}
+		if (!constant) {
+			FlatVector::Validity(result).SetValid(i);
+		}
+		auto file_inserted = file_lookup.emplace(filename_ptr[filename_idx].GetString(), files.size());
+		if (file_inserted.second) {
+			files.emplace_back();
+			files.back().filename = file_inserted.first->first;
+		}
+		auto &file_rows = files[file_inserted.first->second];
+		auto path = path_ptr[path_idx].GetString();
+		auto path_inserted = file_rows.path_lookup.emplace(path, file_rows.paths.size());
+		if (path_inserted.second) {
+			file_rows.paths.push_back(std::move(path));
+		}
+		file_rows.row_idxs.push_back(i);
+		file_rows.row_path_idxs.push_back(path_inserted.first->second);
+	}
+	if (files.empty()) {
+		return;
+	}
+
+	H5ScalarEvaluateFiles(context, files, result.GetType(), swmr, cache_key, read_paths);
+
+	for (auto &file_rows : files) {
+		vector<bool> used(file_rows.paths.size(), false);
+		for (idx_t i = 0; i < file_rows.row_idxs.size(); i++) {
+			auto path_idx = file_rows.row_path_idxs[i];
+			if (reuse_row && (used[path_idx] || file_rows.cached[path_idx])) {
+				reuse_row(file_rows.filename, file_rows.paths[path_idx], file_rows.sizes[path_idx]);
+			}
+			used[path_idx] = true;
+			VectorOperations::Copy(*file_rows.values, result, path_idx + 1, path_idx, file_rows.row_idxs[i]);
+		}
+	}
+}
+
+idx_t H5ScalarValueSize(const Value &value) {
+	idx_t size = sizeof(Value);
+	if (value.IsNull()) {
+		return size;
+	}
+	// Dispatch on the physical type, so MAP (a LIST) and VARIANT (a STRUCT) are walked like their storage.
+	switch (value.type().InternalType()) {
+	case PhysicalType::VARCHAR:
+		return size + StringValue::Get(value).size();
+	case PhysicalType::LIST:
+		for (auto &child : ListValue::GetChildren(value)) {
+			size += H5ScalarValueSize(child);
+		}
+		return size;
+	case PhysicalType::STRUCT:
+		for (auto &child : StructValue::GetChildren(value)) {
+			size += H5ScalarValueSize(child);
+		}
+		return size;
+	case PhysicalType::ARRAY:
+		for (auto &child : ArrayValue::GetChildren(value)) {
+			size += H5ScalarValueSize(child);
+		}
+		return size;
+	default:
+		return size;
+	}
+}
+
+} // namespace duckdb
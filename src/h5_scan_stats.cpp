@@ -0,0 +1,182 @@
+#include "h5_scan_stats.hpp"
+#include "h5_functions.hpp"
+#include "h5_internal.hpp"
+
+#include "duckdb/function/table_function.hpp"
+#include "duckdb/parser/parsed_data/create_table_function_info.hpp"
+#if __has_include("duckdb/common/vector/flat_vector.hpp")
+#include "duckdb/common/vector/flat_vector.hpp"
+#include "duckdb/common/vector/string_vector.hpp"
+#else
+#include "duckdb/common/types/vector.hpp"
+#endif
+
+namespace duckdb {
+
+static H5ScanStats h5_scan_stats_totals;
+static thread_local H5ScanStatsScope *h5_current_scan_stats_scope = nullptr;
+static thread_local H5ScanStats *h5_current_scan_stats = nullptr;
+
+const char *H5ScanCounterName(H5ScanCounter counter) {
+	switch (counter) {
+	case H5ScanCounter::SCANS:
+		return "scans";
+	case H5ScanCounter::FILES_BOUND_AT_SCAN:
+		return "files_bound_at_scan";
+	case H5ScanCounter::ROWS_RETURNED:
+		return "rows_returned";
+	case H5ScanCounter::BYTES_RETURNED:
+		return "bytes_returned";
+	case H5ScanCounter::H5DREAD_CALLS:
+		return "h5dread_calls";
+	case H5ScanCounter::CHUNK_DIRECT_READS:
+		return "chunk_direct_reads";
+	case H5ScanCounter::CHUNK_DIRECT_BYTES:
+		return "chunk_direct_bytes";
+	case H5ScanCounter::CONTIGUOUS_DIRECT_READS:
+		return "contiguous_direct_reads";
+	case H5ScanCounter::CONTIGUOUS_DIRECT_BYTES:
+		return "contiguous_direct_bytes";
+	case H5ScanCounter::LATE_ROWS_SKIPPED:
+		return "late_rows_skipped";
+	case H5ScanCounter::CACHE_WINDOW_FILLS:
+		return "cache_window_fills";
+	case H5ScanCounter::FETCH_WAITS:
+		return "fetch_waits";
+	case H5ScanCounter::FETCH_WAIT_NANOS:
+		return "fetch_wait_ns";
+	case H5ScanCounter::LOCK_ACQUISITIONS:
+		return "hdf5_lock_acquisitions";
+	case H5ScanCounter::LOCK_WAITS:
+		return "hdf5_lock_waits";
+	case H5ScanCounter::LOCK_WAIT_NANOS:
+		return "hdf5_lock_wait_ns";
+	case H5ScanCounter::REMOTE_READS:
+		return "remote_reads";
+	case H5ScanCounter::REMOTE_BYTES_READ:
+		return "remote_bytes_read";
+	case H5ScanCounter::REMOTE_BLOCK_HITS:
+		return "remote_block_cache_hits";
+	case H5ScanCounter::REMOTE_BLOCK_MISSES:
+		return "remote_block_cache_misses";
+	case H5ScanCounter::REMOTE_BLOCK_PREFETCHES:
+		return "remote_block_cache_prefetches";
+	case H5ScanCounter::REMOTE_READAHEAD_HITS:
+		return "remote_readahead_hits";
+	case H5ScanCounter::REMOTE_FETCHES:
+		return "remote_fetches";
+	case H5ScanCounter::REMOTE_BYTES_FETCHED:
+		return "remote_bytes_fetched";
+	case H5ScanCounter::SCALAR_CACHE_HITS:
+		return "scalar_cache_hits";
+	case H5ScanCounter::SCALAR_CACHE_MISSES:
+		return "scalar_cache_misses";
+	case H5ScanCounter::FILE_CACHE_HITS:
+		return "file_cache_hits";
+	case H5ScanCounter::FILE_CACHE_MISSES:
+		return "file_cache_misses";
+	case H5ScanCounter::VIRTUAL_SOURCES_SCANNED:
+		return "virtual_sources_scanned";
+	case H5ScanCounter::DICTIONARY_WINDOWS:
+		return "string_dictionary_windows";
+	case H5ScanCounter::COUNT:
+		break;
+	}
+	throw InternalException("Unknown h5db scan counter");
+}
+
+const H5ScanStats &H5ScanStatsTotals() {
+	return h5_scan_stats_totals;
+}
+
+void H5RecordScanStat(H5ScanCounter counter, idx_t value) {
+	h5_scan_stats_totals.Add(counter, value);
+	if (h5_current_scan_stats) {
+		h5_current_scan_stats->Add(counter, value);
+	}
+}
+
+H5ScanStatsScope::H5ScanStatsScope(shared_ptr<H5ScanStats> stats_p)
+    : stats(std::move(stats_p)), previous(h5_current_scan_stats_scope) {
+	h5_current_scan_stats_scope = this;
+	h5_current_scan_stats = stats.get();
+}
+
+H5ScanStatsScope::~H5ScanStatsScope() {
+	h5_current_scan_stats_scope = previous;
+	h5_current_scan_stats = previous ? previous->stats.get() : nullptr;
+}
+
+shared_ptr<H5ScanStats> H5CurrentScanStats() {
+	return h5_current_scan_stats_scope ? h5_current_scan_stats_scope->stats : nullptr;
+}
+
+idx_t H5ScanStatsElapsedNanos(std::chrono::steady_clock::time_point start) {
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	return static_cast<idx_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+std::unique_lock<std::recursive_mutex> H5LockForScan() {
+	std::unique_lock<std::recursive_mutex> lock(hdf5_global_mutex, std::try_to_lock);
+	H5RecordScanStat(H5ScanCounter::LOCK_ACQUISITIONS);
+	if (!lock.owns_lock()) {
+		auto start = std::chrono::steady_clock::now();
+		lock.lock();
+		H5RecordScanStat(H5ScanCounter::LOCK_WAITS);
+		H5RecordScanStat(H5ScanCounter::LOCK_WAIT_NANOS, H5ScanStatsElapsedNanos(start));
+	}
+	return lock;
+}
+
+//===--------------------------------------------------------------------===//
+// h5db_scan_stats - Process-wide h5_read scan counters
+//===--------------------------------------------------------------------===//
+
+struct H5ScanStatsGlobalState : public GlobalTableFunctionState {
+	// Counter values are read once so that one query sees a consistent set of totals
+	std::array<idx_t, H5_SCAN_COUNTER_COUNT> values {};
+	idx_t next_counter = 0;
+};
+
+static unique_ptr<FunctionData> H5ScanStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"metric", "value"};
+	return_types = {LogicalType::VARCHAR, LogicalType::UBIGINT};
+	return make_uniq<TableFunctionData>();
+}
+
+static unique_ptr<GlobalTableFunctionState> H5ScanStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<H5ScanStatsGlobalState>();
+	const auto &totals = H5ScanStatsTotals();
+	for (idx_t i = 0; i < H5_SCAN_COUNTER_COUNT; i++) {
+		result->values[i] = totals.Get(static_cast<H5ScanCounter>(i));
+	}
+	return std::move(result);
+}
+
+static void H5ScanStatsScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
+	auto &gstate = data.global_state->Cast<H5ScanStatsGlobalState>();
+	auto metrics = FlatVector::GetData<string_t>(output.data[0]);
+	auto values = FlatVector::GetData<uint64_t>(output.data[1]);
+	idx_t count = 0;
+	while (gstate.next_counter < H5_SCAN_COUNTER_COUNT && count < STANDARD_VECTOR_SIZE) {
+		auto counter = static_cast<H5ScanCounter>(gstate.next_counter);
+		metrics[count] = StringVector::AddString(output.data[0], H5ScanCounterName(counter));
+		values[count] = gstate.values[gstate.next_counter];
+		gstate.next_counter++;
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void RegisterH5ScanStatsFunction(ExtensionLoader &loader) {
+	TableFunction h5db_scan_stats("h5db_scan_stats", {}, H5ScanStatsScan, H5ScanStatsBind, H5ScanStatsInit);
+	CreateTableFunctionInfo info(h5db_scan_stats);
+	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
+	info.descriptions.push_back(H5FunctionDescription(
+	    {}, {}, "Returns h5_read I/O and contention counters summed over every scan since h5db was loaded.",
+	    {"FROM h5db_scan_stats()"}));
+	loader.RegisterFunction(std::move(info));
+}
+
+} // namespace duckdb
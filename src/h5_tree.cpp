@@ -14,6 +14,7 @@
 #else
 #include "duckdb/common/types/vector.hpp"
 #endif
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -45,15 +46,15 @@ struct H5TreeScanLayout {
 	H5TreeReadOptions read_options;
 };
 
-class H5TreeScanner;
-
+// Files are handed out to local scan states one at a time; each file is traversed entirely by the
+// thread that claimed it, so many files are opened and walked at the same time.
 struct H5TreeGlobalState : public GlobalTableFunctionState {
-	unique_ptr<H5TreeScanner> scanner;
-	idx_t file_idx = 0;
 	H5TreeScanLayout output_layout;
+	idx_t file_count = 0;
+	std::atomic<idx_t> next_file_idx {0};
 
 	idx_t MaxThreads() const override {
-		return 1;
+		return MaxValue<idx_t>(file_count, 1);
 	}
 };
 
@@ -302,6 +303,11 @@ private:
 	}
 };
 
+struct H5TreeLocalState : public LocalTableFunctionState {
+	unique_ptr<H5TreeScanner> scanner;
+	idx_t file_idx = 0; // Current file, also the batch index of its rows
+};
+
 static unique_ptr<FunctionData> H5TreeBind(ClientContext &context, TableFunctionBindInput &input,
                                            vector<LogicalType> &return_types, vector<string> &names) {
 	auto result = make_uniq<H5TreeBindData>();
@@ -334,12 +340,17 @@ static void H5TreePushdownComplexFilter(ClientContext &context, LogicalGet &get,
 	H5ApplyFilenameFilterPushdown(context, get, bind_data.visible_filename_idx, bind_data.filenames, filters);
 }
 
-static void H5TreeOpenFileScanner(ClientContext &context, const H5TreeBindData &bind_data, H5TreeGlobalState &state,
-                                  idx_t file_idx) {
-	D_ASSERT(file_idx < bind_data.filenames.size());
-	state.file_idx = file_idx;
-	state.scanner = make_uniq<H5TreeScanner>(context, bind_data.filenames[file_idx], bind_data.swmr,
-	                                         bind_data.projected_attributes, state.output_layout.read_options);
+// Claims the next unscanned file for a local state. Returns false once every file has been claimed.
+static bool H5TreeOpenNextFileScanner(ClientContext &context, const H5TreeBindData &bind_data,
+                                      H5TreeGlobalState &gstate, H5TreeLocalState &lstate) {
+	auto file_idx = gstate.next_file_idx.fetch_add(1);
+	if (file_idx >= bind_data.filenames.size()) {
+		return false;
+	}
+	lstate.file_idx = file_idx;
+	lstate.scanner = make_uniq<H5TreeScanner>(context, bind_data.filenames[file_idx], bind_data.swmr,
+	                                          bind_data.projected_attributes, gstate.output_layout.read_options);
+	return true;
 }
 
 static unique_ptr<GlobalTableFunctionState> H5TreeInit(ClientContext &context, TableFunctionInitInput &input) {
@@ -347,33 +358,31 @@ static unique_ptr<GlobalTableFunctionState> H5TreeInit(ClientContext &context, T
 	auto &bind_data = input.bind_data->Cast<H5TreeBindData>();
 	auto result = make_uniq<H5TreeGlobalState>();
 	result->output_layout = H5TreeBuildOutputLayout(bind_data, input.column_ids);
-	if (!bind_data.filenames.empty()) {
-		H5TreeOpenFileScanner(context, bind_data, *result, 0);
-	}
+	result->file_count = bind_data.filenames.size();
 	return std::move(result);
 }
 
+static unique_ptr<LocalTableFunctionState> H5TreeInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                           GlobalTableFunctionState *global_state) {
+	return make_uniq<H5TreeLocalState>();
+}
+
 static void H5TreeScan(ClientContext &context, TableFunctionInput &data, DataChunk &output) {
 	ThrowIfInterrupted(context);
 	auto &bind_data = data.bind_data->Cast<H5TreeBindData>();
 	auto &gstate = data.global_state->Cast<H5TreeGlobalState>();
+	auto &lstate = data.local_state->Cast<H5TreeLocalState>();
 	vector<H5TreeRow> rows;
-	if (!gstate.scanner) {
-		D_ASSERT(bind_data.filenames.empty());
-		output.SetCardinality(0);
-		return;
-	}
 	while (true) {
-		gstate.scanner->ReadRows(rows);
-		if (!rows.empty()) {
-			break;
-		}
-		auto next_file_idx = gstate.file_idx + 1;
-		if (next_file_idx >= bind_data.filenames.size()) {
+		if (!lstate.scanner && !H5TreeOpenNextFileScanner(context, bind_data, gstate, lstate)) {
 			output.SetCardinality(0);
 			return;
 		}
-		H5TreeOpenFileScanner(context, bind_data, gstate, next_file_idx);
+		lstate.scanner->ReadRows(rows);
+		if (!rows.empty()) {
+			break;
+		}
+		lstate.scanner.reset();
 	}
 
 	output.SetCardinality(rows.size());
@@ -403,11 +412,20 @@ static void H5TreeScan(ClientContext &context, TableFunctionInput &data, DataChu
 	if (shape_output_idx.has_value()) {
 		ListVector::SetListSize(output.data[*shape_output_idx], shape_offset);
 	}
-	H5TreePopulateFilenameColumns(bind_data.filenames[gstate.file_idx], gstate.output_layout.filename_output_idxs,
+	H5TreePopulateFilenameColumns(bind_data.filenames[lstate.file_idx], gstate.output_layout.filename_output_idxs,
 	                              output);
 	H5TreePopulateEmptyColumns(gstate.output_layout.empty_output_idxs, output);
 }
 
+// All rows of a file carry its index as batch index. Local states claim files in increasing order, so
+// their batch indexes never decrease, and order-preserving sinks return the files in input order.
+static OperatorPartitionData H5TreeGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	if (input.partition_info.RequiresPartitionColumns()) {
+		throw InternalException("h5_tree does not support partition columns");
+	}
+	return OperatorPartitionData(input.local_state->Cast<H5TreeLocalState>().file_idx);
+}
+
 void RegisterH5TreeFunction(ExtensionLoader &loader) {
 	TableFunction function("h5_tree", {LogicalType::VARCHAR}, H5TreeScan, H5TreeBind, H5TreeInit);
 	function.varargs = LogicalType::ANY;
@@ -416,6 +434,8 @@ void RegisterH5TreeFunction(ExtensionLoader &loader) {
 	function.projection_pushdown = true;
 	function.pushdown_complex_filter = H5TreePushdownComplexFilter;
 	function.get_virtual_columns = H5TreeGetFilenameVirtualColumns;
+	function.init_local = H5TreeInitLocal;
+	function.get_partition_data = H5TreeGetPartitionData;
 	auto function_set = MultiFileReader::CreateFunctionSet(std::move(function));
 	CreateTableFunctionInfo info(std::move(function_set));
 	info.on_conflict = OnCreateConflict::ALTER_ON_CONFLICT;
@@ -1,6 +1,7 @@
 #include "h5_tree_shared.hpp"
 #include "h5_functions.hpp"
 #include "h5_internal.hpp"
+#include "h5_file_cache.hpp"
 #include "duckdb/common/exception.hpp"
 #if __has_include("duckdb/common/vector/flat_vector.hpp")
 #include "duckdb/common/vector/flat_vector.hpp"
@@ -336,7 +337,7 @@ H5TreeFileReader::H5TreeFileReader(ClientContext &context_p, const std::string &
                                    H5TreeReadOptions read_options_p)
     : filename(filename_p), projected_attributes(projected_attributes_p), read_options(std::move(read_options_p)) {
 	H5ErrorSuppressor suppress;
-	file = H5FileHandle(&context_p, filename.c_str(), H5F_ACC_RDONLY, swmr);
+	file = H5OpenFile(context_p, filename, swmr);
 	if (!file.is_valid()) {
 		throw IOException(FormatRemoteFileError("Failed to open HDF5 file", filename));
 	}
@@ -0,0 +1,166 @@
+#include "h5_type_convert.hpp"
+#include "h5_internal.hpp"
+#include <cstring>
+
+namespace duckdb {
+
+// Half-precision values are widened through a stack buffer of this many floats, see H5ConvertHalfToFloat.
+static constexpr idx_t H5_HALF_CONVERSION_BLOCK = 1024;
+
+// The kernels below move elements through memcpy into plain integers, which compilers turn into vector shuffles and
+// conversions without violating aliasing rules on the typed output buffers.
+
+static inline uint16_t H5SwapBytes(uint16_t value) {
+	return static_cast<uint16_t>((value >> 8) | (value << 8));
+}
+
+static inline uint32_t H5SwapBytes(uint32_t value) {
+	return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) | ((value & 0x00FF0000u) >> 8) |
+	       ((value & 0xFF000000u) >> 24);
+}
+
+static inline uint64_t H5SwapBytes(uint64_t value) {
+	return (static_cast<uint64_t>(H5SwapBytes(static_cast<uint32_t>(value))) << 32) |
+	       H5SwapBytes(static_cast<uint32_t>(value >> 32));
+}
+
+template <class U>
+static void H5SwapElementBytes(data_ptr_t data, idx_t element_count) {
+	for (idx_t i = 0; i < element_count; i++) {
+		U value;
+		std::memcpy(&value, data + i * sizeof(U), sizeof(U));
+		value = H5SwapBytes(value);
+		std::memcpy(data + i * sizeof(U), &value, sizeof(U));
+	}
+}
+
+// IEEE 754 binary16 to binary32 bits. Every half value, subnormals included, is exactly representable as a float.
+static inline uint32_t H5HalfToFloatBits(uint16_t half) {
+	uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+	uint32_t exponent = (half >> 10) & 0x1Fu;
+	uint32_t mantissa = half & 0x3FFu;
+	if (exponent == 0x1F) {
+		// Infinities and NaNs, keeping the NaN payload
+		return sign | 0x7F800000u | (mantissa << 13);
+	}
+	if (exponent != 0) {
+		// Rebias the exponent from 15 to 127
+		return sign | ((exponent + 112) << 23) | (mantissa << 13);
+	}
+	// Zero and subnormals: mantissa * 2^-24
+	float magnitude = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+	uint32_t bits;
+	std::memcpy(&bits, &magnitude, sizeof(bits));
+	return sign | bits;
+}
+
+template <bool SWAP>
+static void H5ConvertHalfToFloat(data_ptr_t data, idx_t element_count) {
+	uint32_t block[H5_HALF_CONVERSION_BLOCK];
+	// Floats take twice the bytes of halves, so converting from the end backwards never overwrites halves that have
+	// not been read yet.
+	idx_t end = element_count;
+	while (end > 0) {
+		idx_t start = end > H5_HALF_CONVERSION_BLOCK ? end - H5_HALF_CONVERSION_BLOCK : 0;
+		for (idx_t i = start; i < end; i++) {
+			uint16_t half;
+			std::memcpy(&half, data + i * sizeof(uint16_t), sizeof(half));
+			if (SWAP) {
+				half = H5SwapBytes(half);
+			}
+			block[i - start] = H5HalfToFloatBits(half);
+		}
+		std::memcpy(data + start * sizeof(float), block, (end - start) * sizeof(float));
+		end = start;
+	}
+}
+
+static bool H5IsIeeeHalf(hid_t type_id) {
+	size_t sign_pos = 0;
+	size_t exponent_pos = 0;
+	size_t exponent_size = 0;
+	size_t mantissa_pos = 0;
+	size_t mantissa_size = 0;
+	if (H5Tget_size(type_id) != 2 || H5Tget_precision(type_id) != 16 || H5Tget_offset(type_id) != 0 ||
+	    H5Tget_fields(type_id, &sign_pos, &exponent_pos, &exponent_size, &mantissa_pos, &mantissa_size) < 0) {
+		return false;
+	}
+	return sign_pos == 15 && exponent_pos == 10 && exponent_size == 5 && mantissa_pos == 0 && mantissa_size == 10 &&
+	       H5Tget_ebias(type_id) == 15 && H5Tget_norm(type_id) == H5T_NORM_IMPLIED;
+}
+
+static H5T_order_t H5OppositeOrder(H5T_order_t order) {
+	switch (order) {
+	case H5T_ORDER_LE:
+		return H5T_ORDER_BE;
+	case H5T_ORDER_BE:
+		return H5T_ORDER_LE;
+	default:
+		return H5T_ORDER_ERROR;
+	}
+}
+
+std::optional<H5StoredConversion> H5GetStoredConversion(hid_t file_type, hid_t mem_type) {
+	H5ErrorSuppressor suppress;
+	if (H5Tequal(file_type, mem_type) != 0) {
+		return std::nullopt;
+	}
+	auto file_class = H5Tget_class(file_type);
+	if ((file_class != H5T_INTEGER && file_class != H5T_FLOAT) || H5Tget_class(mem_type) != file_class) {
+		return std::nullopt;
+	}
+	auto native_order = H5Tget_order(mem_type);
+	auto swapped_order = H5OppositeOrder(native_order);
+	if (swapped_order == H5T_ORDER_ERROR) {
+		return std::nullopt;
+	}
+
+	H5StoredConversion result;
+	H5TypeHandle swapped(mem_type);
+	if (H5Tset_order(swapped, swapped_order) >= 0 && H5Tequal(file_type, swapped) > 0) {
+		result.kind = H5StoredConversionKind::BYTE_SWAP;
+		result.read_type = std::move(swapped);
+		result.stored_size = H5Tget_size(mem_type);
+		return result;
+	}
+
+	if (file_class != H5T_FLOAT || H5Tequal(mem_type, H5T_NATIVE_FLOAT) <= 0 || !H5IsIeeeHalf(file_type)) {
+		return std::nullopt;
+	}
+	auto file_order = H5Tget_order(file_type);
+	if (file_order == native_order) {
+		result.kind = H5StoredConversionKind::HALF_TO_FLOAT;
+	} else if (file_order == swapped_order) {
+		result.kind = H5StoredConversionKind::SWAPPED_HALF_TO_FLOAT;
+	} else {
+		return std::nullopt;
+	}
+	result.read_type = H5TypeHandle(file_type);
+	result.stored_size = sizeof(uint16_t);
+	return result;
+}
+
+void H5ApplyStoredConversion(const H5StoredConversion &conversion, data_ptr_t data, idx_t element_count) {
+	switch (conversion.kind) {
+	case H5StoredConversionKind::BYTE_SWAP:
+		switch (conversion.stored_size) {
+		case 1:
+			return;
+		case 2:
+			return H5SwapElementBytes<uint16_t>(data, element_count);
+		case 4:
+			return H5SwapElementBytes<uint32_t>(data, element_count);
+		case 8:
+			return H5SwapElementBytes<uint64_t>(data, element_count);
+		default:
+			throw InternalException("Unsupported element size for h5db byte swapping: %llu", conversion.stored_size);
+		}
+	case H5StoredConversionKind::HALF_TO_FLOAT:
+		return H5ConvertHalfToFloat<false>(data, element_count);
+	case H5StoredConversionKind::SWAPPED_HALF_TO_FLOAT:
+		return H5ConvertHalfToFloat<true>(data, element_count);
+	}
+	throw InternalException("Unknown h5db stored conversion");
+}
+
+} // namespace duckdb
@@ -0,0 +1,157 @@
+#include "h5_zone_map.hpp"
+#include "h5_internal.hpp"
+#include <list>
+#include <unordered_map>
+
+namespace duckdb {
+
+// Upper bound on the memory held by cached zone maps. A zone map costs a fixed amount per chunk, so this also bounds
+// the number of chunks with statistics.
+static constexpr idx_t H5_ZONE_MAP_CACHE_MAX_BYTES = 64ULL * 1024 * 1024;
+
+H5ZoneMap::H5ZoneMap(idx_t num_rows_p, idx_t chunk_rows_p) : num_rows(num_rows_p), chunk_rows(chunk_rows_p) {
+	D_ASSERT(chunk_rows > 0);
+	chunks.resize((num_rows + chunk_rows - 1) / chunk_rows);
+}
+
+idx_t H5ZoneMap::MemorySize() const {
+	// The statistics are numeric Values, which keep no heap allocations.
+	return sizeof(H5ZoneMap) + chunks.size() * sizeof(ChunkStats);
+}
+
+bool H5ZoneMap::IsKnown(idx_t chunk_idx) const {
+	std::lock_guard<std::mutex> guard(lock);
+	return chunk_idx < chunks.size() && chunks[chunk_idx].known;
+}
+
+void H5ZoneMap::Record(idx_t chunk_idx, Value min_value, Value max_value) {
+	std::lock_guard<std::mutex> guard(lock);
+	if (chunk_idx >= chunks.size() || chunks[chunk_idx].known) {
+		return;
+	}
+	auto &stats = chunks[chunk_idx];
+	stats.min_value = std::move(min_value);
+	stats.max_value = std::move(max_value);
+	stats.known = true;
+}
+
+void H5ZoneMap::ForEachKnownChunk(const std::function<void(idx_t, const Value &, const Value &)> &callback) const {
+	std::lock_guard<std::mutex> guard(lock);
+	for (idx_t chunk_idx = 0; chunk_idx < chunks.size(); chunk_idx++) {
+		if (chunks[chunk_idx].known) {
+			callback(chunk_idx, chunks[chunk_idx].min_value, chunks[chunk_idx].max_value);
+		}
+	}
+}
+
+bool H5ZoneMap::TryGetRange(Value &min_value, Value &max_value) const {
+	std::lock_guard<std::mutex> guard(lock);
+	if (chunks.empty()) {
+		return false;
+	}
+	for (auto &stats : chunks) {
+		if (!stats.known) {
+			return false;
+		}
+	}
+	min_value = chunks[0].min_value;
+	max_value = chunks[0].max_value;
+	for (auto &stats : chunks) {
+		if (stats.min_value < min_value) {
+			min_value = stats.min_value;
+		}
+		if (stats.max_value > max_value) {
+			max_value = stats.max_value;
+		}
+	}
+	return true;
+}
+
+namespace {
+
+class H5ZoneMapCache {
+public:
+	shared_ptr<H5ZoneMap> GetOrCreate(const string &key, idx_t num_rows, idx_t chunk_rows) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entries.find(key);
+		if (it != entries.end() && it->second.zone_map->ChunkRows() == chunk_rows) {
+			lru.splice(lru.begin(), lru, it->second.lru_position);
+			return it->second.zone_map;
+		}
+		if (it != entries.end()) {
+			EraseLocked(it);
+		}
+		auto zone_map = make_shared_ptr<H5ZoneMap>(num_rows, chunk_rows);
+		auto size = key.size() + zone_map->MemorySize();
+		if (size > H5_ZONE_MAP_CACHE_MAX_BYTES) {
+			// Still usable by this scan, but too large to keep.
+			return zone_map;
+		}
+		while (!lru.empty() && total_bytes + size > H5_ZONE_MAP_CACHE_MAX_BYTES) {
+			EraseLocked(entries.find(lru.back()));
+		}
+		lru.push_front(key);
+		entries.emplace(key, Entry {zone_map, lru.begin(), size});
+		total_bytes += size;
+		return zone_map;
+	}
+
+	shared_ptr<H5ZoneMap> Find(const string &key) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto it = entries.find(key);
+		return it == entries.end() ? nullptr : it->second.zone_map;
+	}
+
+private:
+	struct Entry {
+		shared_ptr<H5ZoneMap> zone_map;
+		std::list<string>::iterator lru_position;
+		idx_t size; // Key and zone map bytes
+	};
+
+	void EraseLocked(std::unordered_map<string, Entry>::iterator it) {
+		total_bytes -= it->second.size;
+		lru.erase(it->second.lru_position);
+		entries.erase(it);
+	}
+
+	std::mutex lock;
+	std::list<string> lru; // Most recently used first
+	std::unordered_map<string, Entry> entries;
+	idx_t total_bytes = 0;
+};
+
+H5ZoneMapCache &GetZoneMapCache() {
+	static H5ZoneMapCache cache;
+	return cache;
+}
+
+} // namespace
+
+// The chunk size is not part of the key: it cannot change without rewriting the file, which changes its identity.
+static string H5ZoneMapKey(const std::string &filename, const H5FileIdentity &identity,
+                           const std::string &dataset_path, const LogicalType &column_type, idx_t num_rows) {
+	string key = filename;
+	key += '\0';
+	key += dataset_path;
+	key += '\0';
+	key += column_type.ToString();
+	key += '\0';
+	key += std::to_string(identity.file_size) + ":" + std::to_string(identity.last_modified) + ":" +
+	       std::to_string(num_rows);
+	return key;
+}
+
+shared_ptr<H5ZoneMap> H5GetZoneMap(const std::string &filename, const H5FileIdentity &identity,
+                                   const std::string &dataset_path, const LogicalType &column_type, idx_t num_rows,
+                                   idx_t chunk_rows) {
+	return GetZoneMapCache().GetOrCreate(H5ZoneMapKey(filename, identity, dataset_path, column_type, num_rows),
+	                                     num_rows, chunk_rows);
+}
+
+shared_ptr<H5ZoneMap> H5FindZoneMap(const std::string &filename, const H5FileIdentity &identity,
+                                    const std::string &dataset_path, const LogicalType &column_type, idx_t num_rows) {
+	return GetZoneMapCache().Find(H5ZoneMapKey(filename, identity, dataset_path, column_type, num_rows));
+}
+
+} // namespace duckdb
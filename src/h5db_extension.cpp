@@ -75,6 +75,76 @@ static void SetH5dbScalarReadMemoryLimit(ClientContext &, SetScope, Value &param
 	parameter = Value(parsed == NumericLimits<idx_t>::Maximum() ? "none" : parameter.ToString());
 }
 
+static void SetH5dbMaxFilesInFlight(ClientContext &, SetScope, Value &parameter) {
+	ParsePositiveCountSetting(parameter, "h5db_max_files_in_flight");
+}
+
+static void SetH5dbFileCacheSize(ClientContext &, SetScope, Value &parameter) {
+	ParseFileCacheSizeSetting(parameter);
+}
+
+static void SetH5dbScalarCacheSize(ClientContext &, SetScope, Value &parameter) {
+	if (ParseScalarCacheSizeSetting(parameter) == 0) {
+		parameter = Value("none");
+	}
+}
+
+static void SetH5dbRemoteBlockSize(ClientContext &, SetScope, Value &parameter) {
+	ParseRemoteBlockSizeSetting(parameter);
+}
+
+static void SetH5dbRemoteReadahead(ClientContext &, SetScope, Value &parameter) {
+	if (ParseRemoteReadaheadSetting(parameter) == 0) {
+		parameter = Value("none");
+	}
+}
+
+static void SetH5dbRemoteReadaheadConcurrency(ClientContext &, SetScope, Value &parameter) {
+	ParsePositiveCountSetting(parameter, "h5db_remote_readahead_concurrency");
+}
+
+static void SetH5dbRemoteMetadataPrefetch(ClientContext &, SetScope, Value &parameter) {
+	if (ParseRemoteMetadataPrefetchSetting(parameter) == 0) {
+		parameter = Value("none");
+	}
+}
+
+static void SetH5dbRemotePageBuffer(ClientContext &, SetScope, Value &parameter) {
+	if (ParseRemotePageBufferSetting(parameter) == 0) {
+		parameter = Value("none");
+	}
+}
+
+static void SetH5dbRemoteMetadataCache(ClientContext &, SetScope, Value &parameter) {
+	if (ParseRemoteMetadataCacheSetting(parameter) == 0) {
+		parameter = Value("none");
+	}
+}
+
+static void SetH5dbCacheWindows(ClientContext &, SetScope, Value &parameter) {
+	ParsePositiveCountSetting(parameter, "h5db_cache_windows");
+}
+
+static void SetH5dbRangeAttributes(ClientContext &, SetScope, Value &parameter) {
+	ParseRangeAttributesSetting(parameter);
+}
+
+static void SetH5dbSftpPipelineDepth(ClientContext &, SetScope, Value &parameter) {
+	ParsePositiveCountSetting(parameter, "h5db_sftp_pipeline_depth");
+}
+
+static void SetH5dbSftpPoolSize(ClientContext &, SetScope, Value &parameter) {
+	ParseSftpPoolSizeSetting(parameter);
+}
+
+static void SetH5dbSftpPoolIdleTimeout(ClientContext &, SetScope, Value &parameter) {
+	ParsePositiveCountSetting(parameter, "h5db_sftp_pool_idle_timeout");
+}
+
+static void SetH5dbSftpGlobConcurrency(ClientContext &, SetScope, Value &parameter) {
+	ParsePositiveCountSetting(parameter, "h5db_sftp_glob_concurrency");
+}
+
 static void LoadInternal(ExtensionLoader &loader) {
 	child_list_t<LogicalType> version_struct_children = {
 	    {"h5db_version", LogicalType::VARCHAR},
@@ -99,6 +169,87 @@ static void LoadInternal(ExtensionLoader &loader) {
 	                          "Estimated peak memory limit for scalar h5_read materialization (e.g. 64MB, none)",
 	                          LogicalType::VARCHAR, Value(H5DB_DEFAULT_SCALAR_READ_MEMORY_LIMIT_SETTING),
 	                          SetH5dbScalarReadMemoryLimit);
+	config.AddExtensionOption("h5db_max_files_in_flight",
+	                          "Maximum number of files a multi-file h5_read scan opens and scans concurrently",
+	                          LogicalType::UBIGINT, Value::UBIGINT(H5DB_DEFAULT_MAX_FILES_IN_FLIGHT),
+	                          SetH5dbMaxFilesInFlight);
+	config.AddExtensionOption("h5db_zone_maps",
+	                          "Skip chunks of numeric datasets using per-chunk min/max recorded by earlier scans",
+	                          LogicalType::BOOLEAN, Value(true));
+	config.AddExtensionOption("h5db_late_materialization",
+	                          "Read wide numeric columns only for rows that pass value filters on 1-D columns",
+	                          LogicalType::BOOLEAN, Value(true));
+	config.AddExtensionOption("h5db_string_dictionary",
+	                          "Read cached fixed-length string columns as dictionary vectors over per-window values",
+	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("h5db_virtual_sources",
+	                          "Scan the source files of HDF5 virtual datasets directly, as concurrent partitions",
+	                          LogicalType::BOOLEAN, Value(true));
+	config.AddExtensionOption("h5db_cache_windows",
+	                          "Number of read-ahead cache windows h5_read keeps per cached column",
+	                          LogicalType::UBIGINT, Value::UBIGINT(H5DB_DEFAULT_CACHE_WINDOWS), SetH5dbCacheWindows);
+	config.AddExtensionOption("h5db_cache_prefetch",
+	                          "Fill h5_read cache windows from a background thread per file instead of from scan threads",
+	                          LogicalType::BOOLEAN, Value(false));
+	config.AddExtensionOption("h5db_range_attributes",
+	                          "Dataset attributes h5_read reports as column min/max to the optimizer: one [min, max] "
+	                          "attribute (e.g. valid_range) or a min and a max attribute (e.g. 'valid_min,valid_max')",
+	                          LogicalType::VARCHAR, Value(""), SetH5dbRangeAttributes);
+	config.AddExtensionOption("h5db_bind_sample_files",
+	                          "Number of files a multi-file h5_read binds up front; the others are checked against "
+	                          "their schema when the scan opens them (0 binds every file)",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0));
+	config.AddExtensionOption("h5db_file_cache_size",
+	                          "Number of open HDF5 files (with h5_read schemas) each connection keeps across queries; "
+	                          "0 disables the cache",
+	                          LogicalType::UBIGINT, Value::UBIGINT(0), SetH5dbFileCacheSize);
+	config.AddExtensionOption("h5db_scalar_cache_size",
+	                          "Memory each connection uses to keep scalar h5_read, h5_attributes and h5_ls results "
+	                          "across queries (e.g. 16MiB, none)",
+	                          LogicalType::VARCHAR, Value("none"), SetH5dbScalarCacheSize);
+	config.AddExtensionOption("h5db_remote_block_size",
+	                          "Block size of the remote file block cache for small HDF5 reads (e.g. 30KiB, 256KiB)",
+	                          LogicalType::VARCHAR, Value(H5DB_DEFAULT_REMOTE_BLOCK_SIZE_SETTING),
+	                          SetH5dbRemoteBlockSize);
+	config.AddExtensionOption("h5db_remote_readahead",
+	                          "Maximum bytes prefetched ahead of sequential or strided reads of a remote file (e.g. "
+	                          "16MB, none)",
+	                          LogicalType::VARCHAR, Value(H5DB_DEFAULT_REMOTE_READAHEAD_SETTING),
+	                          SetH5dbRemoteReadahead);
+	config.AddExtensionOption("h5db_remote_readahead_concurrency",
+	                          "Number of readahead range requests kept in flight per remote file",
+	                          LogicalType::UBIGINT, Value::UBIGINT(H5DB_DEFAULT_REMOTE_READAHEAD_CONCURRENCY),
+	                          SetH5dbRemoteReadaheadConcurrency);
+	config.AddExtensionOption("h5db_remote_metadata_prefetch",
+	                          "Bytes at the start of a remote file loaded with one request by its first metadata read "
+	                          "(e.g. 1MiB, none)",
+	                          LogicalType::VARCHAR, Value(H5DB_DEFAULT_REMOTE_METADATA_PREFETCH_SETTING),
+	                          SetH5dbRemoteMetadataPrefetch);
+	config.AddExtensionOption("h5db_remote_page_buffer",
+	                          "Size of the HDF5 page buffer for remote files written with paged aggregation (e.g. "
+	                          "4MiB, none)",
+	                          LogicalType::VARCHAR, Value("none"), SetH5dbRemotePageBuffer);
+	config.AddExtensionOption("h5db_remote_metadata_cache",
+	                          "Initial size of the HDF5 metadata cache of remote files (e.g. 16MiB); none keeps HDF5's "
+	                          "default",
+	                          LogicalType::VARCHAR, Value("none"), SetH5dbRemoteMetadataCache);
+	config.AddExtensionOption("h5db_sftp_pipeline_depth",
+	                          "Number of SFTP read requests kept in flight ahead of sequential reads of an sftp:// file",
+	                          LogicalType::UBIGINT, Value::UBIGINT(H5DB_DEFAULT_SFTP_PIPELINE_DEPTH),
+	                          SetH5dbSftpPipelineDepth);
+	config.AddExtensionOption("h5db_sftp_pool_size",
+	                          "Number of idle SFTP connections kept open across queries for reuse; 0 closes "
+	                          "connections when each query ends",
+	                          LogicalType::UBIGINT, Value::UBIGINT(H5DB_DEFAULT_SFTP_POOL_SIZE), SetH5dbSftpPoolSize);
+	config.AddExtensionOption("h5db_sftp_pool_idle_timeout",
+	                          "Seconds an idle pooled SFTP connection stays open before it is closed",
+	                          LogicalType::UBIGINT, Value::UBIGINT(H5DB_DEFAULT_SFTP_POOL_IDLE_TIMEOUT_SECONDS),
+	                          SetH5dbSftpPoolIdleTimeout);
+	config.AddExtensionOption("h5db_sftp_glob_concurrency",
+	                          "Number of directory listings sftp:// glob expansion keeps in flight, each on its own "
+	                          "connection",
+	                          LogicalType::UBIGINT, Value::UBIGINT(H5DB_DEFAULT_SFTP_GLOB_CONCURRENCY),
+	                          SetH5dbSftpGlobConcurrency);
 
 	// Register HDF5 functions
 	RegisterH5TreeFunction(loader);
@@ -107,11 +258,13 @@ static void LoadInternal(ExtensionLoader &loader) {
 	RegisterH5ReadScalarFunction(loader);
 	RegisterH5RseFunction(loader);
 	RegisterH5ReeFunction(loader);
+	RegisterH5SliceFunction(loader);
 	RegisterH5AliasFunction(loader);
 	RegisterH5AttrFunction(loader);
 	RegisterH5IndexFunction(loader);
 	RegisterH5FirstFileFunction(loader);
 	RegisterH5AttributesFunction(loader);
+	RegisterH5ScanStatsFunction(loader);
 	RegisterH5SftpSecrets(loader);
 }
 
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "hdf5.h"
+#include <atomic>
+#include <optional>
+#include <vector>
+
+namespace duckdb {
+
+// Chunk-direct reads bypass HDF5's filter pipeline for chunked numeric datasets whose filters h5db can decode
+// itself. Raw chunk bytes are fetched with H5Dread_chunk while holding hdf5_global_mutex; decompression and
+// the copy into the destination rows then run on scan threads without the lock. Datasets that do not match the
+// supported shape fall back to H5Dread.
+
+struct H5ChunkDirectFilter {
+	H5Z_filter_t id = H5Z_FILTER_NONE;
+	// Element size the shuffle filter was configured with (shuffle only).
+	size_t shuffle_element_size = 0;
+};
+
+struct H5ChunkDirectLayout {
+	hsize_t chunk_rows = 0; // Chunk extent along the row dimension
+	idx_t row_bytes = 0;    // Decoded bytes of one dataset row
+	idx_t chunk_bytes = 0;  // Decoded bytes of one full chunk
+	int ndims = 0;          // Dataset rank
+	vector<H5ChunkDirectFilter> filters; // Pipeline in write order
+};
+
+// One raw chunk plus the destination of the rows it contributes to a read.
+struct H5ChunkDirectRawChunk {
+	std::vector<uint8_t> data;
+	uint32_t filter_mask = 0;
+	idx_t chunk_row_offset = 0; // First row of the chunk that is copied
+	idx_t row_count = 0;        // Rows copied from the chunk
+	data_ptr_t target = nullptr;
+};
+
+// Returns the chunk-direct layout when the dataset is chunked along rows only, stored in the memory type's exact
+// representation, and filtered only by deflate and/or shuffle. Caller must hold hdf5_global_mutex.
+std::optional<H5ChunkDirectLayout> H5ChunkDirectTryGetLayout(hid_t dataset_id, hid_t mem_type,
+                                                             const std::vector<hsize_t> &dims);
+
+// Fetches the raw chunks covering [row_start, row_start + row_count) for decoding into target. Returns false when
+// a chunk is unallocated or cannot be read, in which case the caller should use H5Dread instead. Caller must hold
+// hdf5_global_mutex.
+bool H5ChunkDirectReadRaw(hid_t dataset_id, const H5ChunkDirectLayout &layout, idx_t row_start, idx_t row_count,
+                          data_ptr_t target, vector<H5ChunkDirectRawChunk> &chunks);
+
+// Decodes one raw chunk into its destination rows. Does not call into HDF5, so it is safe without
+// hdf5_global_mutex. Returns false for data that does not decode to the expected chunk size.
+bool H5ChunkDirectDecode(const H5ChunkDirectLayout &layout, const H5ChunkDirectRawChunk &chunk);
+
+// Contiguous-direct reads serve unfiltered contiguous numeric datasets of local files with positional reads of the
+// file itself, so scan threads read them in parallel without HDF5 or hdf5_global_mutex.
+struct H5ContiguousDirectLayout {
+	idx_t address = 0;   // File offset of the first row
+	idx_t row_bytes = 0; // Stored bytes of one dataset row
+};
+
+// Returns the contiguous-direct layout when the file is opened with the sec2 driver and the dataset is allocated,
+// contiguous, stored in the file itself (no external storage) and in the memory type's exact representation.
+// Caller must hold hdf5_global_mutex.
+std::optional<H5ContiguousDirectLayout> H5ContiguousDirectTryGetLayout(hid_t file_id, hid_t dataset_id,
+                                                                       hid_t mem_type,
+                                                                       const std::vector<hsize_t> &dims);
+
+// A set of raw chunks that any number of scan threads can decode cooperatively.
+class H5ChunkDirectDecodeBatch {
+public:
+	H5ChunkDirectDecodeBatch(const H5ChunkDirectLayout &layout, vector<H5ChunkDirectRawChunk> chunks);
+
+	// Claims and decodes chunks until every chunk has been claimed.
+	void Help();
+	// Helps with the remaining chunks, then waits for chunks claimed by other threads.
+	// Returns false if any chunk failed to decode.
+	bool Finish();
+
+private:
+	H5ChunkDirectLayout layout;
+	vector<H5ChunkDirectRawChunk> chunks;
+	std::atomic<idx_t> next_chunk {0};
+	std::atomic<idx_t> decoded_chunks {0};
+	std::atomic<bool> failed {false};
+};
+
+} // namespace duckdb
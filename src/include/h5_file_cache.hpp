@@ -0,0 +1,58 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "h5_raii.hpp"
+#include <optional>
+
+namespace duckdb {
+
+// Identity of a file used to invalidate cached handles and metadata when the file is rewritten.
+struct H5FileIdentity {
+	idx_t file_size = 0;
+	int64_t last_modified = 0;
+	string version_tag; // e.g. an HTTP ETag; empty when the file system does not report one
+
+	bool operator==(const H5FileIdentity &other) const {
+		return file_size == other.file_size && last_modified == other.last_modified &&
+		       version_tag == other.version_tag;
+	}
+	bool operator!=(const H5FileIdentity &other) const {
+		return !(*this == other);
+	}
+};
+
+// Returns the size and modification time of a local file, or nullopt for remote paths and files that cannot be
+// inspected.
+std::optional<H5FileIdentity> H5TryGetLocalFileIdentity(ClientContext &context, const std::string &filename);
+
+// Like H5TryGetLocalFileIdentity, but also inspects remote files served by DuckDB file systems (one metadata
+// request, e.g. an HTTP HEAD). Returns nullopt for sftp:// paths and files that cannot be inspected.
+std::optional<H5FileIdentity> H5TryGetFileIdentity(ClientContext &context, const std::string &filename);
+
+// Per-file metadata a table function keeps next to a cached file handle, e.g. its bind-time schema.
+class H5FileCacheMetadata {
+public:
+	virtual ~H5FileCacheMetadata() = default;
+};
+
+// The file cache keeps open HDF5 files (and their cached metadata) per DuckDB connection across queries, bounded by
+// h5db_file_cache_size (0 disables it, which is the default). An entry is reused while the file's size,
+// modification time, and version tag are unchanged; the identity is checked once per file and query. SWMR reads and
+// sftp:// files are never cached, and a SWMR read closes the handles of its file cached by any connection (a handle
+// still in use by a running query stays open until that query is done with it). Opens served from the cache and opens
+// that had to open the file are counted as file_cache_hits and file_cache_misses.
+
+// Opens filename read-only like H5FileHandle, reusing a cached open file when possible. Returns an invalid handle if
+// the file cannot be opened; callers suppress HDF5 errors and report the failure as before.
+H5FileHandle H5OpenFile(ClientContext &context, const std::string &filename, bool swmr);
+
+// Returns metadata stored under key for a cached, unchanged file, or nullptr.
+shared_ptr<H5FileCacheMetadata> H5FileCacheGetMetadata(ClientContext &context, const std::string &filename, bool swmr,
+                                                       const std::string &key);
+
+// Stores metadata under key for a file that was opened through H5OpenFile in the current query. Does nothing when
+// the file is not cached.
+void H5FileCacheSetMetadata(ClientContext &context, const std::string &filename, bool swmr, const std::string &key,
+                            shared_ptr<H5FileCacheMetadata> metadata);
+
+} // namespace duckdb
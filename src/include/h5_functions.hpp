@@ -23,10 +23,14 @@ struct H5ExpandedFileList {
 
 // Validate whether a decoded HDF5 string satisfies its declared character set.
 bool H5StringMatchesCharset(const std::string &value, H5T_cset_t cset);
+bool H5StringMatchesCharset(const char *data, size_t size, H5T_cset_t cset);
 
 // Decode a fixed-length HDF5 string according to its declared padding mode.
 std::string H5DecodeFixedLengthString(const char *raw_data, size_t raw_size, H5T_str_t strpad);
 
+// Length of a fixed-length HDF5 string once its padding is removed; the value is a prefix of raw_data.
+size_t H5FixedLengthStringSize(const char *raw_data, size_t raw_size, H5T_str_t strpad);
+
 // Helper function to get HDF5 type as string
 std::string H5TypeToString(hid_t type_id);
 
@@ -79,6 +83,9 @@ void RegisterH5RseFunction(ExtensionLoader &loader);
 // Scalar function for creating REE (run-end encoded) column specs
 void RegisterH5ReeFunction(ExtensionLoader &loader);
 
+// Scalar function for creating sliced column specs (hyperslabs of inner dimensions)
+void RegisterH5SliceFunction(ExtensionLoader &loader);
+
 // Scalar function for aliasing column specs with custom names
 void RegisterH5AliasFunction(ExtensionLoader &loader);
 
@@ -94,6 +101,9 @@ void RegisterH5FirstFileFunction(ExtensionLoader &loader);
 // Table function for reading HDF5 attributes
 void RegisterH5AttributesFunction(ExtensionLoader &loader);
 
+// Table function returning the process-wide h5_read scan counters
+void RegisterH5ScanStatsFunction(ExtensionLoader &loader);
+
 // Secret type/provider registration for native sftp support
 void RegisterH5SftpSecrets(ExtensionLoader &loader);
 
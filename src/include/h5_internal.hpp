@@ -31,6 +31,44 @@ static constexpr const char *H5DB_MAX_BATCH_SIZE_SETTING = "1GB";
 static constexpr idx_t H5DB_DEFAULT_SCALAR_READ_MEMORY_LIMIT_BYTES = 64 * 1000 * 1000;
 static constexpr const char *H5DB_DEFAULT_SCALAR_READ_MEMORY_LIMIT_SETTING = "64MB";
 
+// Bounds how many files a multi-file h5_read scan keeps open and scans concurrently.
+static constexpr idx_t H5DB_DEFAULT_MAX_FILES_IN_FLIGHT = 4;
+
+// Remote VFD block cache granularity, and the largest block size accepted by h5db_remote_block_size.
+static constexpr idx_t H5DB_DEFAULT_REMOTE_BLOCK_SIZE_BYTES = 30 * 1024;
+static constexpr const char *H5DB_DEFAULT_REMOTE_BLOCK_SIZE_SETTING = "30KiB";
+static constexpr idx_t H5DB_MAX_REMOTE_BLOCK_SIZE_BYTES = 64 * 1024 * 1024;
+
+// Upper bound on the bytes the remote VFD prefetches ahead of sequential or strided reads of one file, and the
+// number of range requests it keeps in flight per file.
+static constexpr idx_t H5DB_DEFAULT_REMOTE_READAHEAD_BYTES = 16 * 1000 * 1000;
+static constexpr const char *H5DB_DEFAULT_REMOTE_READAHEAD_SETTING = "16MB";
+static constexpr idx_t H5DB_MAX_REMOTE_READAHEAD_BYTES = 1 * 1024 * 1024 * 1024;
+static constexpr idx_t H5DB_DEFAULT_REMOTE_READAHEAD_CONCURRENCY = 4;
+
+// Bytes at the start of a remote file loaded into the block cache by the first metadata read, the largest HDF5 page
+// buffer for remote files written with paged aggregation, and the largest HDF5 metadata cache (HDF5's own limit).
+static constexpr idx_t H5DB_DEFAULT_REMOTE_METADATA_PREFETCH_BYTES = 1024 * 1024;
+static constexpr const char *H5DB_DEFAULT_REMOTE_METADATA_PREFETCH_SETTING = "1MiB";
+static constexpr idx_t H5DB_MAX_REMOTE_METADATA_PREFETCH_BYTES = 64 * 1024 * 1024;
+static constexpr idx_t H5DB_MAX_REMOTE_PAGE_BUFFER_BYTES = 1 * 1024 * 1024 * 1024;
+static constexpr idx_t H5DB_MIN_REMOTE_METADATA_CACHE_BYTES = 1024;
+static constexpr idx_t H5DB_MAX_REMOTE_METADATA_CACHE_BYTES = 128 * 1024 * 1024;
+
+// Number of SFTP read requests kept in flight ahead of sequential reads of one SFTP file handle.
+static constexpr idx_t H5DB_DEFAULT_SFTP_PIPELINE_DEPTH = 64;
+static constexpr idx_t H5DB_MAX_SFTP_PIPELINE_DEPTH = 256;
+
+// Cache windows h5_read keeps per cached column, filled ahead of the scan as a ring.
+static constexpr idx_t H5DB_DEFAULT_CACHE_WINDOWS = 3;
+static constexpr idx_t H5DB_MAX_CACHE_WINDOWS = 16;
+
+// Idle SFTP connections kept open across queries by the process-wide pool, and how long each stays open unused.
+static constexpr idx_t H5DB_DEFAULT_SFTP_POOL_SIZE = 8;
+static constexpr idx_t H5DB_DEFAULT_SFTP_POOL_IDLE_TIMEOUT_SECONDS = 300;
+static constexpr idx_t H5DB_DEFAULT_SFTP_GLOB_CONCURRENCY = 4;
+static constexpr idx_t H5DB_MAX_SFTP_GLOB_CONCURRENCY = 32;
+
 // Resolve SWMR read mode from named parameters or default setting.
 // Named parameter "swmr" takes precedence over h5db_swmr_default.
 bool ResolveSwmrOption(ClientContext &context, const named_parameter_map_t &named_parameters);
@@ -57,6 +95,76 @@ idx_t ResolveBatchSizeOption(ClientContext &context);
 idx_t ParseScalarReadMemoryLimitSetting(const Value &setting_value);
 idx_t ResolveScalarReadMemoryLimitOption(ClientContext &context);
 
+// Parse and resolve a count setting that must be at least 1. Invalid inputs
+// throw InvalidInputException naming the setting.
+idx_t ParsePositiveCountSetting(const Value &setting_value, const char *setting_name);
+idx_t ResolvePositiveCountOption(ClientContext &context, const char *setting_name, idx_t default_value);
+idx_t ResolveMaxFilesInFlightOption(ClientContext &context);
+
+// Resolve whether h5_read records and uses per-chunk min/max zone maps.
+bool ResolveZoneMapsOption(ClientContext &context);
+
+// Resolve whether h5_read reads wide columns only for rows passing claimed filters on its 1-D columns.
+bool ResolveLateMaterializationOption(ClientContext &context);
+
+// Resolve whether h5_read fills cache windows of fixed-length string columns with per-window dictionaries.
+bool ResolveStringDictionaryOption(ClientContext &context);
+
+// Resolve whether h5_read scans the source datasets of virtual datasets in place of the virtual datasets' file.
+bool ResolveVirtualSourcesOption(ClientContext &context);
+
+// Resolve the number of cache windows per cached h5_read column. Values above the maximum are clamped.
+idx_t ResolveCacheWindowsOption(ClientContext &context);
+
+// Resolve whether a background task per file fills h5_read cache windows ahead of the scan threads.
+bool ResolveCachePrefetchOption(ClientContext &context);
+
+// Parse and resolve the dataset attributes h5_read reports as column value ranges to DuckDB's optimizer: none, one
+// name of a [min, max] attribute, or the names of a min and a max attribute.
+vector<string> ParseRangeAttributesSetting(const Value &setting_value);
+vector<string> ResolveRangeAttributesOption(ClientContext &context);
+
+// Resolve how many files multi-file h5_read binds up front (0 binds every file). The others are bound when the scan
+// opens them.
+idx_t ResolveBindSampleFilesOption(ClientContext &context);
+
+// Resolve how many open files the per-connection file cache keeps (0 disables it).
+idx_t ParseFileCacheSizeSetting(const Value &setting_value);
+idx_t ResolveFileCacheSizeOption(ClientContext &context);
+
+// Parse and resolve the byte budget of the per-connection scalar result cache. "0" and "none" disable it.
+idx_t ParseScalarCacheSizeSetting(const Value &setting_value);
+idx_t ResolveScalarCacheSizeOption(ClientContext &context);
+
+// Parse and resolve the remote VFD block size. Values above the maximum are clamped.
+idx_t ParseRemoteBlockSizeSetting(const Value &setting_value);
+idx_t ResolveRemoteBlockSizeOption(ClientContext &context);
+
+// Parse and resolve the remote VFD readahead window. "0" and "none" disable readahead.
+idx_t ParseRemoteReadaheadSetting(const Value &setting_value);
+idx_t ResolveRemoteReadaheadOption(ClientContext &context);
+idx_t ResolveRemoteReadaheadConcurrencyOption(ClientContext &context);
+
+// Parse and resolve the remote metadata prefetch, page buffer and metadata cache sizes. "0" and "none" disable the
+// prefetch and the page buffer, and keep HDF5's default metadata cache size. Values out of range are clamped.
+idx_t ParseRemoteMetadataPrefetchSetting(const Value &setting_value);
+idx_t ResolveRemoteMetadataPrefetchOption(ClientContext &context);
+idx_t ParseRemotePageBufferSetting(const Value &setting_value);
+idx_t ResolveRemotePageBufferOption(ClientContext &context);
+idx_t ParseRemoteMetadataCacheSetting(const Value &setting_value);
+idx_t ResolveRemoteMetadataCacheOption(ClientContext &context);
+
+// Resolve the SFTP pipeline depth. Values above the maximum are clamped.
+idx_t ResolveSftpPipelineDepthOption(ClientContext &context);
+
+// Parse and resolve the SFTP connection pool settings. A pool size of 0 closes connections when queries end.
+idx_t ParseSftpPoolSizeSetting(const Value &setting_value);
+idx_t ResolveSftpPoolSizeOption(ClientContext &context);
+idx_t ResolveSftpPoolIdleTimeoutOption(ClientContext &context);
+
+// Resolve how many directory listings sftp:// glob expansion keeps in flight. Values above the maximum are clamped.
+idx_t ResolveSftpGlobConcurrencyOption(ClientContext &context);
+
 FunctionDescription H5FunctionDescription(vector<LogicalType> parameter_types, vector<string> parameter_names,
                                           string description, vector<string> examples = {},
                                           vector<string> categories = {"hdf5"});
@@ -134,6 +242,18 @@ auto DispatchOnNumericType(LogicalType logical_type, Func &&func) {
 		return func(TypeTag<float> {});
 	case LogicalTypeId::DOUBLE:
 		return func(TypeTag<double> {});
+	case LogicalTypeId::ENUM:
+		// Enum datasets are read as their ENUM codes
+		switch (logical_type.InternalType()) {
+		case PhysicalType::UINT8:
+			return func(TypeTag<uint8_t> {});
+		case PhysicalType::UINT16:
+			return func(TypeTag<uint16_t> {});
+		case PhysicalType::UINT32:
+			return func(TypeTag<uint32_t> {});
+		default:
+			throw IOException("Unsupported DuckDB type");
+		}
 	default:
 		throw IOException("Unsupported DuckDB type");
 	}
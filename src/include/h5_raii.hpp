@@ -22,20 +22,27 @@ using namespace duckdb;
 
 // RAII wrapper for HDF5 error handler state
 // Automatically disables HDF5 error printing on construction and restores it on destruction
+// The handler is process-wide and suppressors can overlap on bind threads, so they are counted: the first saves and
+// clears the handler, and the last restores it, whatever order they are destroyed in.
 class H5ErrorSuppressor {
-	H5E_auto2_t old_func;
-	void *old_client_data;
+	static inline idx_t active_count = 0;
+	static inline H5E_auto2_t old_func = nullptr;
+	static inline void *old_client_data = nullptr;
 
 public:
 	H5ErrorSuppressor() {
 		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
-		H5Eget_auto2(H5E_DEFAULT, &old_func, &old_client_data);
-		H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+		if (active_count++ == 0) {
+			H5Eget_auto2(H5E_DEFAULT, &old_func, &old_client_data);
+			H5Eset_auto2(H5E_DEFAULT, nullptr, nullptr);
+		}
 	}
 
 	~H5ErrorSuppressor() {
 		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
-		H5Eset_auto2(H5E_DEFAULT, old_func, old_client_data);
+		if (--active_count == 0) {
+			H5Eset_auto2(H5E_DEFAULT, old_func, old_client_data);
+		}
 	}
 
 	// Disable copy and move to prevent double restoration
@@ -116,25 +123,14 @@ public:
 class H5FileHandle {
 	hid_t id;
 
-public:
-	H5FileHandle() : id(-1) {
-	}
-
-	H5FileHandle(ClientContext *context, const char *filename, unsigned flags, bool swmr) {
-		bool is_remote = filename && H5RemoteVFD::IsRemotePath(filename);
-		if (is_remote) {
-			if (!context) {
-				throw IOException("Remote HDF5 paths require an active DuckDB context");
-			}
-			auto required_extension = H5RemoteVFD::GetRequiredExtension(filename);
-			if (!required_extension.empty()) {
-				ExtensionHelper::AutoLoadExtension(*context, required_extension);
-			}
-		}
-
-		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+	// Opens filename with a new file access property list. page_buffer asks for the page buffer configured for remote
+	// files and page_buffer_used reports whether one was set. Caller must hold hdf5_global_mutex.
+	static hid_t Open(ClientContext *context, const char *filename, unsigned open_flags, bool is_remote,
+	                  bool page_buffer, bool &page_buffer_used) {
 		hid_t fapl = -1;
 		bool open_context_set = false;
+		hid_t result = -1;
+		page_buffer_used = false;
 		try {
 			fapl = H5Pcreate(H5P_FILE_ACCESS);
 			if (fapl >= 0) {
@@ -143,23 +139,15 @@ public:
 				// Ignore errors in case the HDF5 build does not support this API.
 				H5Pset_file_locking(fapl, 0, 0);
 				if (is_remote) {
-					H5RemoteVFD::ConfigureFAPL(*context, fapl);
+					page_buffer_used = H5RemoteVFD::ConfigureFAPL(*context, fapl, page_buffer);
 				}
 			}
-
-			unsigned open_flags = flags;
-			// Remote files are opened read-only through the remote VFD.
-			// SWMR coordination with live writers does not apply in this mode, and
-			// passing H5F_ACC_SWMR_READ can fail for the custom remote VFD path.
-			if (swmr && !is_remote) {
-				open_flags |= H5F_ACC_SWMR_READ;
-			}
 			if (is_remote) {
 				H5RemoteVFD::ClearLastError();
 				H5RemoteVFD::SetOpenContext(context);
 				open_context_set = true;
 			}
-			id = H5Fopen(filename, open_flags, fapl >= 0 ? fapl : H5P_DEFAULT);
+			result = H5Fopen(filename, open_flags, fapl >= 0 ? fapl : H5P_DEFAULT);
 		} catch (...) {
 			if (open_context_set) {
 				H5RemoteVFD::SetOpenContext(nullptr);
@@ -175,11 +163,69 @@ public:
 		if (fapl >= 0) {
 			H5Pclose(fapl);
 		}
+		return result;
+	}
+
+public:
+	H5FileHandle() : id(-1) {
+	}
+
+	H5FileHandle(ClientContext *context, const char *filename, unsigned flags, bool swmr) {
+		bool is_remote = filename && H5RemoteVFD::IsRemotePath(filename);
+		if (is_remote) {
+			if (!context) {
+				throw IOException("Remote HDF5 paths require an active DuckDB context");
+			}
+			auto required_extension = H5RemoteVFD::GetRequiredExtension(filename);
+			if (!required_extension.empty()) {
+				ExtensionHelper::AutoLoadExtension(*context, required_extension);
+			}
+			H5RemoteVFD::PrepareOpen(*context, filename);
+		}
+
+		unsigned open_flags = flags;
+		// Remote files are opened read-only through the remote VFD.
+		// SWMR coordination with live writers does not apply in this mode, and
+		// passing H5F_ACC_SWMR_READ can fail for the custom remote VFD path.
+		if (swmr && !is_remote) {
+			open_flags |= H5F_ACC_SWMR_READ;
+		}
+
+		std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+		try {
+			bool page_buffer = false;
+			id = Open(context, filename, open_flags, is_remote, true, page_buffer);
+			// HDF5 rejects a page buffer for files written without paged aggregation. Errors of the remote VFD itself
+			// are reported as they are.
+			if (id < 0 && page_buffer && !H5RemoteVFD::HasLastError()) {
+				id = Open(context, filename, open_flags, is_remote, false, page_buffer);
+			}
+		} catch (...) {
+			if (is_remote) {
+				H5RemoteVFD::ClearPreparedOpen();
+			}
+			throw;
+		}
+		if (is_remote) {
+			H5RemoteVFD::ClearPreparedOpen();
+		}
 		if (id >= 0 && is_remote) {
 			H5RemoteVFD::ClearLastError();
 		}
 	}
 
+	// Returns a new identifier for an already open file (H5Freopen). It shares the open file and its metadata
+	// cache with other, but is closed independently. Returns an invalid handle on failure.
+	static H5FileHandle Reopen(const H5FileHandle &other) {
+		H5FileHandle result;
+		if (other.id >= 0) {
+			std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
+			H5ErrorSuppressor suppress;
+			result.id = H5Freopen(other.id);
+		}
+		return result;
+	}
+
 	~H5FileHandle() {
 		if (id >= 0) {
 			std::lock_guard<std::recursive_mutex> lock(hdf5_global_mutex);
@@ -16,6 +16,36 @@ idx_t CheckedDatasetSizeProduct(idx_t left, idx_t right, const string &filename,
 std::pair<H5DatasetHandle, H5TypeHandle> OpenDatasetAndGetType(hid_t file, const string &filename,
                                                                const string &dataset_path);
 
+// Storage and character set of an HDF5 string type.
+struct H5StringReadInfo {
+	bool is_variable = false;
+	H5T_cset_t cset = H5T_CSET_ASCII;
+	idx_t fixed_length = 0;             // Bytes per stored value (fixed-length only)
+	H5T_str_t strpad = H5T_STR_NULLPAD; // Padding of stored values (fixed-length only)
+};
+
+H5StringReadInfo InspectHDF5StringType(hid_t h5_type, const string &filename, const string &dataset_path);
+
+// Throws if the bytes are not valid in the declared character set.
+void ValidateHDF5String(const char *data, idx_t size, H5T_cset_t cset, const string &filename,
+                        const string &dataset_path);
+
+// Reads count variable-length strings and hands the HDF5-owned values (nullptr for NULL strings) to consume; they
+// are reclaimed once consume returns.
+void ReadHDF5VariableStrings(hid_t dataset_id, hid_t h5_type, hid_t mem_space, hid_t file_space, idx_t count,
+                             const string &filename, const string &dataset_path,
+                             const std::function<void(char *const *values)> &consume);
+
+// Reads fixed-length strings as stored (count * fixed_length bytes, padding included) into buffer.
+void ReadHDF5FixedStrings(hid_t dataset_id, hid_t h5_type, hid_t mem_space, hid_t file_space, const string &filename,
+                          const string &dataset_path, data_ptr_t buffer);
+
+// Reads and validates count strings, passing each decoded value as a (pointer, size) view that is only valid during
+// the callback.
+void ReadHDF5StringViews(hid_t dataset_id, hid_t h5_type, const H5StringReadInfo &info, hid_t mem_space,
+                         hid_t file_space, idx_t count, const string &filename, const string &dataset_path,
+                         const std::function<void(idx_t, const char *, idx_t)> &callback);
+
 void ReadHDF5Strings(hid_t dataset_id, hid_t h5_type, hid_t mem_space, hid_t file_space, idx_t count,
                      const string &filename, const string &dataset_path,
                      std::function<void(idx_t, const string &)> callback);
@@ -5,6 +5,11 @@
 
 namespace duckdb {
 
+struct H5RemoteByteRange {
+	idx_t offset;
+	idx_t size;
+};
+
 struct H5RemoteErrorInfo {
 	std::string message;
 	bool interrupted = false;
@@ -14,12 +19,29 @@ class H5RemoteVFD {
 public:
 	static bool IsRemotePath(const std::string &path);
 	static std::string GetRequiredExtension(const std::string &path);
-	static void ConfigureFAPL(ClientContext &context, hid_t fapl_id);
+	// Sets the remote VFD and the configured HDF5 metadata cache size on fapl_id and, if page_buffer is set, the
+	// configured page buffer. Returns whether a page buffer was set: HDF5 refuses to open files written without paged
+	// aggregation with one, so those opens are retried without it.
+	static bool ConfigureFAPL(ClientContext &context, hid_t fapl_id, bool page_buffer);
+	// Opens the backend of a remote path served by DuckDB's file systems (e.g. its HTTP HEAD request) for the next
+	// open of path on this thread. Called before taking hdf5_global_mutex, so threads opening different files do not
+	// wait for each other's requests. Does nothing for sftp:// paths; errors are left for the open to report.
+	static void PrepareOpen(ClientContext &context, const std::string &path);
+	// Drops a backend left over from PrepareOpen if the open did not use it.
+	static void ClearPreparedOpen();
 	static void SetOpenContext(ClientContext *context);
 	static ClientContext *GetOpenContext();
 	static void ClearLastError();
+	// Whether the remote VFD recorded an error on this thread since it was last cleared or taken.
+	static bool HasLastError();
 	static H5RemoteErrorInfo TakeLastErrorInfo();
 	static std::string TakeLastError();
+	// Whether file_id was opened through the remote VFD with readahead enabled. Caller must hold hdf5_global_mutex.
+	static bool SupportsPrefetch(hid_t file_id);
+	// Starts fetching byte ranges of file_id that are about to be read, merged into a few parallel requests, so the
+	// HDF5 reads that follow are served from memory. Does nothing for other files. Caller must hold
+	// hdf5_global_mutex.
+	static void Prefetch(hid_t file_id, vector<H5RemoteByteRange> ranges);
 };
 
 } // namespace duckdb
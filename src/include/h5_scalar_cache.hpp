@@ -0,0 +1,38 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/function/scalar_function.hpp"
+#include <functional>
+
+namespace duckdb {
+
+// Scalar h5_read, h5_attributes and h5_ls read one object path of one file per row. H5ScalarExecute groups the rows
+// of a chunk by file and reads every distinct path of a file once.
+//
+// Results can also be kept in the scalar cache, which holds them per DuckDB connection across chunks and queries,
+// bounded by h5db_scalar_cache_size (none disables it, which is the default). Results are keyed by file, function,
+// and object path, and reused while the file's size, modification time, and version tag are unchanged; as in the file
+// cache, the identity is checked once per file and query. SWMR reads and sftp:// files are never cached.
+
+// Reads the object paths of one file that are not cached: writes paths[i] into values[i] for every i in path_idxs.
+// When estimate_sizes is set, the results will be cached and sizes[i] must be set to the estimated size of the result
+// in bytes; otherwise sizes may be left at zero. Called on the calling thread, once per file.
+using H5ScalarReadPaths =
+    std::function<void(const string &filename, const vector<string> &paths, const vector<idx_t> &path_idxs,
+                       Vector &values, vector<idx_t> &sizes, bool estimate_sizes)>;
+
+// Called on the calling thread for every result row whose value was not read for it, because an earlier row of the
+// chunk read the same path or the value was cached. size is the value's estimated size from H5ScalarReadPaths.
+using H5ScalarReuseRow = std::function<void(const string &filename, const string &path, idx_t size)>;
+
+// Evaluates a scalar function whose first two arguments are a filename and an object path. Rows with a NULL
+// argument return NULL. cache_key identifies the function and any bind options its results depend on; results are
+// only cached when swmr is false.
+void H5ScalarExecute(DataChunk &args, ExpressionState &state, Vector &result, bool swmr, const string &cache_key,
+                     const H5ScalarReadPaths &read_paths, const H5ScalarReuseRow &reuse_row = nullptr);
+
+// Estimated size in bytes of a result built as a Value, for H5ScalarReadPaths: the Value itself, its string payload,
+// and its nested values, without rendering it.
+idx_t H5ScalarValueSize(const Value &value);
+
+} // namespace duckdb
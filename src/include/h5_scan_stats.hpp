@@ -0,0 +1,98 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace duckdb {
+
+// Counters collected while h5_read scans run. Every scan has its own H5ScanStats, reported in the profiling output
+// of its operator, and every increment also goes to process-wide totals returned by h5db_scan_stats().
+enum class H5ScanCounter : uint8_t {
+	SCANS,
+	FILES_BOUND_AT_SCAN,     // Files of multi-file scans bound when the scan opened them (h5db_bind_sample_files)
+	ROWS_RETURNED,
+	BYTES_RETURNED,          // Dataset values returned, in DuckDB's in-memory layout
+	H5DREAD_CALLS,           // H5Dread calls, including those reading strings and run-encoded datasets
+	CHUNK_DIRECT_READS,      // Raw chunks read with H5Dread_chunk and decoded by scan threads
+	CHUNK_DIRECT_BYTES,      // Stored (compressed) bytes of those chunks
+	CONTIGUOUS_DIRECT_READS, // Positional reads of contiguous local datasets that bypass H5Dread
+	CONTIGUOUS_DIRECT_BYTES, // Bytes read by them
+	LATE_ROWS_SKIPPED,       // Rows whose late-materialized columns were not read because a claimed filter failed
+	CACHE_WINDOW_FILLS,      // Cache windows filled, by read-ahead or by scans that missed the cache
+	FETCH_WAITS,             // Times a scan thread blocked until another thread filled a window
+	FETCH_WAIT_NANOS,        // Time spent blocked in those waits
+	LOCK_ACQUISITIONS,       // hdf5_global_mutex acquisitions by scan threads
+	LOCK_WAITS,              // Acquisitions that found the mutex held by another thread
+	LOCK_WAIT_NANOS,         // Time spent waiting for hdf5_global_mutex
+	REMOTE_READS,            // Reads HDF5 issued to the remote VFD
+	REMOTE_BYTES_READ,       // Bytes HDF5 read through the remote VFD
+	REMOTE_BLOCK_HITS,       // Remote VFD block cache lookups served from memory
+	REMOTE_BLOCK_MISSES,     // Remote VFD block cache lookups that fetched the block
+	REMOTE_BLOCK_PREFETCHES, // Blocks loaded along with a metadata block that missed the block cache
+	REMOTE_READAHEAD_HITS,   // Remote VFD reads served from readahead or planned window fetches
+	REMOTE_FETCHES,          // Requests sent to the remote backend (HTTP ranges, S3 gets, SFTP reads)
+	REMOTE_BYTES_FETCHED,    // Bytes requested from the remote backend
+	SCALAR_CACHE_HITS,       // Scalar function results served from the scalar cache
+	SCALAR_CACHE_MISSES,     // Results of cacheable files that scalar functions had to read
+	FILE_CACHE_HITS,         // File opens served by a handle kept open by the file cache
+	FILE_CACHE_MISSES,       // File opens with the file cache enabled that had to open the file
+	VIRTUAL_SOURCES_SCANNED, // Source files of virtual datasets scanned in place of the virtual datasets' file
+	DICTIONARY_WINDOWS,      // Fixed-length string cache windows filled with a dictionary of their values
+	COUNT
+};
+
+static constexpr idx_t H5_SCAN_COUNTER_COUNT = static_cast<idx_t>(H5ScanCounter::COUNT);
+
+// Metric name of a counter, as used by h5db_scan_stats() and the profiling output.
+const char *H5ScanCounterName(H5ScanCounter counter);
+
+struct H5ScanStats {
+	std::array<std::atomic<idx_t>, H5_SCAN_COUNTER_COUNT> counters {};
+
+	void Add(H5ScanCounter counter, idx_t value) {
+		counters[static_cast<idx_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+	}
+	idx_t Get(H5ScanCounter counter) const {
+		return counters[static_cast<idx_t>(counter)].load(std::memory_order_relaxed);
+	}
+};
+
+// Process-wide totals of every scan since the extension was loaded.
+const H5ScanStats &H5ScanStatsTotals();
+
+// Adds value to the totals and to the scan the calling thread is working for, if any. Code below the scan (the
+// remote VFD, readahead planning) records through this, so it needs no access to the scan's state. Work done outside
+// scans, such as binding or h5_tree, only counts towards the totals. Background threads started for a scan (readahead
+// fetches, cache prefetch) record to it through their own H5ScanStatsScope.
+void H5RecordScanStat(H5ScanCounter counter, idx_t value = 1);
+
+// Makes stats the scan the calling thread records to until the scope ends.
+class H5ScanStatsScope {
+public:
+	explicit H5ScanStatsScope(shared_ptr<H5ScanStats> stats);
+	~H5ScanStatsScope();
+
+	H5ScanStatsScope(const H5ScanStatsScope &) = delete;
+	H5ScanStatsScope &operator=(const H5ScanStatsScope &) = delete;
+
+private:
+	friend shared_ptr<H5ScanStats> H5CurrentScanStats();
+
+	shared_ptr<H5ScanStats> stats;
+	H5ScanStatsScope *previous;
+};
+
+// The scan the calling thread records to, or nullptr. Work handed to other threads keeps it to open a scope there.
+shared_ptr<H5ScanStats> H5CurrentScanStats();
+
+// Locks hdf5_global_mutex for a scan, recording the acquisition and, when another thread holds the mutex, how long
+// the scan waited for it. Uncontended acquisitions are not timed.
+std::unique_lock<std::recursive_mutex> H5LockForScan();
+
+// Nanoseconds since an earlier steady clock reading, for recording wait times.
+idx_t H5ScanStatsElapsedNanos(std::chrono::steady_clock::time_point start);
+
+} // namespace duckdb
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "h5_raii.hpp"
+#include "hdf5.h"
+#include <optional>
+
+namespace duckdb {
+
+// Stored conversions cover numeric datasets whose file type differs from the native type of their DuckDB column only
+// in ways h5db undoes itself: the opposite byte order, or IEEE half precision read as FLOAT. Such columns are read in
+// their stored representation, so HDF5 copies the bytes without converting them while hdf5_global_mutex is held, and
+// scan threads convert the values in place after releasing it. Other representations keep HDF5's conversion path.
+
+enum class H5StoredConversionKind : uint8_t {
+	BYTE_SWAP,             // The native type in the opposite byte order
+	HALF_TO_FLOAT,         // IEEE 754 binary16 in native byte order, widened to float
+	SWAPPED_HALF_TO_FLOAT, // IEEE 754 binary16 in the opposite byte order, widened to float
+};
+
+struct H5StoredConversion {
+	H5StoredConversionKind kind = H5StoredConversionKind::BYTE_SWAP;
+	H5TypeHandle read_type; // Memory type with the stored representation, so HDF5 reads without converting
+	idx_t stored_size = 0;  // Bytes of one stored element
+};
+
+// Returns how to convert values of file_type into mem_type (a native numeric type) outside HDF5, or nullopt when the
+// types are already equal or only HDF5 can convert between them. Caller must hold hdf5_global_mutex.
+std::optional<H5StoredConversion> H5GetStoredConversion(hid_t file_type, hid_t mem_type);
+
+// Converts element_count values stored densely at the start of data into native values, in place. data must have room
+// for element_count native values. Does not call into HDF5, so it is safe without hdf5_global_mutex.
+void H5ApplyStoredConversion(const H5StoredConversion &conversion, data_ptr_t data, idx_t element_count);
+
+} // namespace duckdb
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "h5_file_cache.hpp"
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace duckdb {
+
+// Per-chunk min/max statistics for one chunked 1-D numeric dataset. Statistics are recorded while chunks are
+// scanned, so a zone map fills in gradually and only covers chunks some scan has fully read.
+class H5ZoneMap {
+public:
+	H5ZoneMap(idx_t num_rows, idx_t chunk_rows);
+
+	idx_t ChunkRows() const {
+		return chunk_rows;
+	}
+	idx_t NumRows() const {
+		return num_rows;
+	}
+	idx_t ChunkCount() const {
+		return chunks.size();
+	}
+	// Bytes held by the zone map, which is fixed at construction.
+	idx_t MemorySize() const;
+
+	bool IsKnown(idx_t chunk_idx) const;
+	void Record(idx_t chunk_idx, Value min_value, Value max_value);
+	// Calls callback(chunk_idx, min, max) for every chunk with statistics, in chunk order.
+	void ForEachKnownChunk(const std::function<void(idx_t, const Value &, const Value &)> &callback) const;
+	// Sets min and max over the whole dataset once every chunk has statistics. Returns false otherwise.
+	bool TryGetRange(Value &min_value, Value &max_value) const;
+
+private:
+	struct ChunkStats {
+		bool known = false;
+		Value min_value;
+		Value max_value;
+	};
+
+	const idx_t num_rows;
+	const idx_t chunk_rows;
+	mutable std::mutex lock;
+	vector<ChunkStats> chunks; // Protected by lock
+};
+
+// Returns the shared zone map for a dataset, creating an empty one on first use. Zone maps are kept in a
+// process-wide cache bounded by memory, keyed by file identity, dataset path, row count, chunk size and column type,
+// so a rewritten file or a grown dataset starts a fresh zone map.
+shared_ptr<H5ZoneMap> H5GetZoneMap(const std::string &filename, const H5FileIdentity &identity,
+                                   const std::string &dataset_path, const LogicalType &column_type, idx_t num_rows,
+                                   idx_t chunk_rows);
+
+// Returns the zone map H5GetZoneMap would return for a dataset with any chunk size, or nullptr if no scan has
+// created one.
+shared_ptr<H5ZoneMap> H5FindZoneMap(const std::string &filename, const H5FileIdentity &identity,
+                                    const std::string &dataset_path, const LogicalType &column_type, idx_t num_rows);
+
+} // namespace duckdb
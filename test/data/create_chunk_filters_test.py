@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+"""Create filtered chunked datasets for the chunk-direct decode path and its H5Dread fallbacks."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 100_000
+WIDE_ROWS = 20_000
+SPARSE_ROWS = 50_000
+
+
+def make_rows_2d(rows: int) -> np.ndarray:
+    return np.arange(rows, dtype=np.int64)[:, None] * 10 + np.arange(3, dtype=np.int64)[None, :]
+
+
+output_path = Path(__file__).with_name("chunk_filters.h5")
+
+with h5py.File(output_path, "w") as f:
+    # Decoded by h5db: deflate and/or shuffle on native little-endian types with full-row chunks.
+    f.create_dataset("small_deflate_i32", data=np.arange(1000, dtype=np.int32), chunks=(100,), compression="gzip")
+    f.create_dataset("deflate_i32", data=np.arange(ROWS, dtype=np.int32), chunks=(4096,), compression="gzip")
+    f.create_dataset(
+        "shuffle_deflate_f64",
+        data=np.arange(ROWS, dtype=np.float64) * 0.5,
+        chunks=(1000,),
+        compression="gzip",
+        shuffle=True,
+    )
+    f.create_dataset(
+        "shuffle_u16", data=(np.arange(70_000) % 65536).astype(np.uint16), chunks=(3000,), shuffle=True
+    )
+    f.create_dataset(
+        "rows_2d", data=make_rows_2d(WIDE_ROWS), chunks=(512, 3), compression="gzip", shuffle=True
+    )
+
+    # Fallbacks: chunks not spanning full rows, unsupported filters, unallocated chunks. The big-endian dataset is
+    # decoded by h5db and byte swapped after decoding.
+    f.create_dataset("partial_2d", data=make_rows_2d(WIDE_ROWS), chunks=(512, 2), compression="gzip")
+    f.create_dataset(
+        "fletcher32_i32", data=np.arange(ROWS, dtype=np.int32), chunks=(4096,), compression="gzip", fletcher32=True
+    )
+    f.create_dataset("big_endian_i32", data=np.arange(ROWS, dtype=">i4"), chunks=(4096,), compression="gzip")
+    sparse = f.create_dataset(
+        "sparse_i32", shape=(SPARSE_ROWS,), dtype=np.int32, chunks=(1000,), compression="gzip", fillvalue=-1
+    )
+    sparse[10_000:20_000] = np.arange(10_000, 20_000, dtype=np.int32)
+
+print(f"Created {output_path.name} successfully!")
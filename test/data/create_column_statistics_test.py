@@ -0,0 +1,38 @@
+#!/usr/bin/env python3
+"""Create datasets whose value ranges h5_read reports as column statistics: range attributes and run-encoded values."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+def write_file(path: Path, rows: int, temperature_range: list, starts: list, run_values: list) -> None:
+    with h5py.File(path, "w") as f:
+        positions = np.arange(rows, dtype=np.int64)
+
+        # One attribute holding [min, max], like the CF valid_range convention.
+        temperature = f.create_dataset("temperature", data=(positions % 100).astype(np.float32))
+        temperature.attrs["valid_range"] = np.array(temperature_range, dtype=np.float32)
+
+        # Separate min and max attributes.
+        counts = f.create_dataset("counts", data=(positions % 500).astype(np.int32))
+        counts.attrs["valid_min"] = np.int32(0)
+        counts.attrs["valid_max"] = np.int32(499)
+
+        # Attributes of the wrong shape or class are ignored.
+        f.create_dataset("bad_range", data=positions.astype(np.int32)).attrs["valid_range"] = np.arange(3)
+        f.create_dataset("text_range", data=positions.astype(np.int32)).attrs["valid_range"] = ["a", "b"]
+
+        # No attributes at all.
+        f.create_dataset("plain", data=positions)
+
+        f.create_dataset("run_starts", data=np.array(starts, dtype=np.int64))
+        f.create_dataset("run_values", data=np.array(run_values, dtype=np.int16))
+
+
+output_dir = Path(__file__).parent
+write_file(output_dir / "column_statistics.h5", 10_000, [-50.0, 150.0], [0, 1000, 5000], [3, 7, 5])
+write_file(output_dir / "column_statistics_more.h5", 5_000, [-80.0, 120.0], [100, 200], [1, 7])
+
+print("Created column_statistics.h5 and column_statistics_more.h5 successfully!")
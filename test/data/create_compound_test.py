@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""Create compound datasets for h5_read field columns."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 100_000
+TRACKS = 1000
+
+
+output_path = Path(__file__).with_name("compound.h5")
+
+with h5py.File(output_path, "w") as f:
+    # Chunked 1-D table with numeric, fixed-length string, and variable-length string fields.
+    event_dtype = np.dtype(
+        [
+            ("id", np.int64),
+            ("energy", np.float64),
+            ("detector", np.int16),
+            ("label", "S8"),
+            ("name", h5py.string_dtype("utf-8")),
+        ]
+    )
+    events = np.empty(ROWS, dtype=event_dtype)
+    events["id"] = np.arange(ROWS)
+    events["energy"] = np.arange(ROWS) * 0.5
+    events["detector"] = np.arange(ROWS) % 8
+    events["label"] = [f"ev{i:05d}".encode() for i in range(ROWS)]
+    events["name"] = [f"event-{i}" for i in range(ROWS)]
+    f.create_dataset("events", data=events, chunks=(10_000,))
+
+    # 2-D compound dataset: every field becomes an ARRAY column.
+    grid_dtype = np.dtype([("a", np.int32), ("b", np.float32)])
+    grid = np.empty((4, 3), dtype=grid_dtype)
+    grid["a"] = np.arange(12).reshape(4, 3)
+    grid["b"] = np.arange(12).reshape(4, 3) * 0.25
+    f.create_dataset("grid", data=grid)
+
+    # Nested compound members are not supported: they are skipped, and a dataset of only such members fails.
+    inner_dtype = np.dtype([("x", np.int32), ("y", np.int32)])
+    nested_dtype = np.dtype([("id", np.int32), ("inner", inner_dtype)])
+    nested = np.zeros(3, dtype=nested_dtype)
+    nested["id"] = np.arange(3)
+    f.create_dataset("nested", data=nested)
+    f.create_dataset("only_nested", data=np.zeros(3, dtype=[("inner", inner_dtype)]))
+
+    # Array members become ARRAY columns; arrays of strings are skipped like nested members.
+    track_dtype = np.dtype(
+        [
+            ("id", np.int32),
+            ("pos", np.float64, (3,)),
+            ("cov", np.float32, (2, 2)),
+            ("codes", "S2", (2,)),
+            ("hits", inner_dtype),
+        ]
+    )
+    tracks = np.zeros(TRACKS, dtype=track_dtype)
+    tracks["id"] = np.arange(TRACKS)
+    tracks["pos"] = np.arange(TRACKS)[:, None] * np.array([1.0, 2.0, 3.0])
+    tracks["cov"][:, 0, 0] = np.arange(TRACKS)
+    tracks["cov"][:, 0, 1] = 0.5
+    tracks["cov"][:, 1, 0] = 0.5
+    tracks["cov"][:, 1, 1] = np.arange(TRACKS)
+    f.create_dataset("tracks", data=tracks, chunks=(100,))
+
+    # Array members of a 2-D dataset: the member's shape follows the dataset's inner dimension.
+    cells = np.zeros((4, 2), dtype=[("v", np.int32, (3,))])
+    cells["v"] = np.arange(24).reshape(4, 2, 3)
+    f.create_dataset("cells", data=cells)
+
+    f.create_dataset("index", data=np.arange(ROWS, dtype=np.int64))
+
+print(f"Created {output_path.name} successfully!")
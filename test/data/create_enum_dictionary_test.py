@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Create enum datasets and low-cardinality fixed-length strings for ENUM columns and dictionary string windows."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 60_000
+CHUNK_ROWS = 1000
+DETECTORS = [b"ECAL", b"HCAL", b"MUON", b"TRACKER"]
+
+output_path = Path(__file__).with_name("enum_dictionary.h5")
+rows = np.arange(ROWS)
+
+with h5py.File(output_path, "w") as f:
+    # Members numbered 0, 1, 2 in an unsigned byte: the stored values are the ENUM codes.
+    run_type = h5py.enum_dtype({"calibration": 0, "physics": 1, "cosmics": 2}, basetype="u1")
+    f.create_dataset(
+        "run_type", data=(rows % 3).astype(np.uint8), dtype=run_type, chunks=(CHUNK_ROWS,), compression="gzip"
+    )
+
+    # Members with other values in a 2-byte integer, contiguous: HDF5 maps them to codes.
+    quality = h5py.enum_dtype({"bad": -1, "good": 1, "unknown": 7}, basetype="i2")
+    quality_values = np.array([1, 1, 1, -1, 7], dtype=np.int16)[rows % 5]
+    f.create_dataset("quality", data=quality_values, dtype=quality)
+
+    # 2-D enum: [i % 2, (i // 2) % 2]
+    switch = h5py.enum_dtype({"off": 0, "on": 1}, basetype="u1")
+    flags = np.stack([rows % 2, (rows // 2) % 2], axis=1).astype(np.uint8)
+    f.create_dataset("flags", data=flags, dtype=switch)
+
+    # Stored values that are not members read as NULL: 5 in every tenth row, copied as stored (chunked), and 9 in
+    # every fourth row, mapped by HDF5 (contiguous).
+    level = h5py.enum_dtype({"low": 0, "high": 1}, basetype="u1")
+    level_values = np.where(rows % 10 == 0, 5, rows % 2).astype(np.uint8)
+    f.create_dataset("level", data=level_values, dtype=level, chunks=(CHUNK_ROWS,), compression="gzip")
+    status = h5py.enum_dtype({"bad": -1, "good": 1}, basetype="i2")
+    status_values = np.where(rows % 4 == 0, 9, 1).astype(np.int16)
+    f.create_dataset("status", data=status_values, dtype=status)
+
+    # Never written: reads the fill value 0, which is not a member of quality
+    f.create_dataset("pending", shape=(ROWS,), dtype=quality, chunks=(CHUNK_ROWS,))
+
+    # Scalar enum
+    mode = h5py.enum_dtype({"sim": 0, "data": 1}, basetype="u1")
+    f.create_dataset("mode", data=np.array(1, dtype=np.uint8), dtype=mode)
+
+    # Compound dataset with an enum field: every fourth row is a miss
+    outcome = h5py.enum_dtype({"hit": 3, "miss": 5}, basetype="i1")
+    events = np.zeros(ROWS, dtype=[("id", np.int32), ("kind", outcome)])
+    events["id"] = rows
+    events["kind"] = np.where(rows % 4 == 0, 5, 3)
+    f.create_dataset("events", data=events, chunks=(CHUNK_ROWS,))
+
+    # Fixed-length strings: a detector name per block of 1000 rows, and a unique label per row.
+    detectors = np.array(DETECTORS, dtype="S8")[(rows // 1000) % len(DETECTORS)]
+    f.create_dataset("detector", data=detectors, chunks=(CHUNK_ROWS,))
+    labels = np.array([f"label-{i:05d}".encode() for i in rows], dtype="S12")
+    f.create_dataset("label", data=labels, chunks=(CHUNK_ROWS,))
+
+print(f"Created {output_path.name} successfully!")
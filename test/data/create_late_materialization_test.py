@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+"""Create narrow filter columns next to wide array columns for late materialization of filtered scans."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 16_384
+CATEGORIES = 16
+WIDE_WIDTH = 16
+HALF_WIDTH = 32
+
+output_path = Path(__file__).with_name("late_materialization.h5")
+
+with h5py.File(output_path, "w") as f:
+    # 1-D columns that filters are evaluated on.
+    f.create_dataset("id", data=np.arange(ROWS, dtype=np.int64))
+    f.create_dataset("category", data=(np.arange(ROWS) % CATEGORIES).astype(np.int32))
+
+    # Wide rows: element [j] of row i is i * 100 + j (contiguous, read with positional reads for local files).
+    rows = np.arange(ROWS, dtype=np.float64)[:, None]
+    f.create_dataset("wide", data=rows * 100 + np.arange(WIDE_WIDTH, dtype=np.float64)[None, :])
+
+    # Half precision rows widened to FLOAT after the read: element [j] of row i is i % 1024 + j.
+    halves = (np.arange(ROWS) % 1024)[:, None] + np.arange(HALF_WIDTH)[None, :]
+    f.create_dataset("wide_f16", data=halves.astype("<f2"))
+
+print(f"Created {output_path.name} successfully!")
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+"""Create a metadata-heavy file written with paged aggregation, for the HDF5 page buffer and metadata prefetch."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+GROUPS = 200
+ROWS = 10
+
+output_path = Path(__file__).with_name("paged_metadata.h5")
+
+# Paged aggregation needs the newer file format, which stores the page size in the superblock extension.
+with h5py.File(output_path, "w", libver="latest", fs_strategy="page", fs_page_size=4096) as f:
+    for i in range(GROUPS):
+        group = f.create_group(f"group_{i:03d}")
+        group.attrs["index"] = np.int32(i)
+        group.create_dataset("values", data=np.arange(ROWS, dtype=np.int64) + i * ROWS)
+    f.create_dataset("all_values", data=np.arange(GROUPS * ROWS, dtype=np.int64), chunks=(256,))
+
+print(f"Created {output_path.name} successfully!")
@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""Create run-encoded columns with more runs than one h5_read run window (32768 runs)."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 300_000
+
+
+output_path = Path(__file__).with_name("run_windows.h5")
+
+with h5py.File(output_path, "w") as f:
+    f.create_dataset("index", data=np.arange(ROWS, dtype=np.int64))
+
+    # RSE: runs of 3 rows starting at row 7 (rows 0-6 are NULL); values are the run number.
+    rse_starts = np.arange(7, ROWS, 3, dtype=np.uint64)
+    f.create_dataset("rse/run_starts", data=rse_starts)
+    f.create_dataset("rse/values", data=np.arange(len(rse_starts), dtype=np.int64))
+
+    # REE: runs of 3 rows (the first has 2) covering all but the last 10 rows; values repeat every 1000 runs.
+    ree_ends = np.arange(1, ROWS - 10, 3, dtype=np.uint64)
+    f.create_dataset("ree/run_ends", data=ree_ends)
+    f.create_dataset("ree/values", data=np.arange(len(ree_ends), dtype=np.int32) % 1000)
+
+    # RSE with string values: runs of 5 rows starting at row 1.
+    label_starts = np.arange(1, ROWS, 5, dtype=np.uint64)
+    f.create_dataset("labels/run_starts", data=label_starts)
+    f.create_dataset(
+        "labels/values",
+        data=[f"value-{i:05d}" for i in range(len(label_starts))],
+        dtype=h5py.string_dtype("ascii"),
+    )
+
+    # RSE whose run starts are out of order only in its second window.
+    unsorted_starts = np.arange(0, ROWS, 3, dtype=np.uint64)
+    unsorted_starts[[40_000, 40_001]] = unsorted_starts[[40_001, 40_000]]
+    f.create_dataset("unsorted_late/run_starts", data=unsorted_starts)
+    f.create_dataset("unsorted_late/values", data=np.arange(len(unsorted_starts), dtype=np.int32))
+
+print(f"Created {output_path.name} successfully!")
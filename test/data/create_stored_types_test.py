@@ -0,0 +1,45 @@
+#!/usr/bin/env python3
+"""Create non-native numeric representations that h5_read converts on scan threads: big-endian and float16 datasets."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 100_000
+U16_ROWS = 70_000
+WIDE_ROWS = 20_000
+
+# Zero, negative zero, the largest half, the smallest normal and subnormal halves, infinities and NaN.
+HALF_SPECIALS = [0.0, -0.0, 1.0, -2.5, 65504.0, 2.0**-14, 2.0**-24, np.inf, -np.inf, np.nan]
+
+
+def make_rows_2d(rows: int) -> np.ndarray:
+    return np.arange(rows, dtype=np.float64)[:, None] * 10 + np.arange(3, dtype=np.float64)[None, :]
+
+
+output_path = Path(__file__).with_name("stored_types.h5")
+
+with h5py.File(output_path, "w") as f:
+    # Big-endian datasets: contiguous, chunked without filters, and chunk-direct (deflate, shuffle).
+    f.create_dataset("be_i64", data=np.arange(ROWS, dtype=">i8"))
+    f.create_dataset("be_u16", data=(np.arange(U16_ROWS) % 65536).astype(">u2"))
+    f.create_dataset("be_f64", data=np.arange(ROWS, dtype=np.float64).astype(">f8") * 0.5, chunks=(1000,))
+    f.create_dataset(
+        "be_i32_shuffle",
+        data=np.arange(ROWS, dtype=">i4"),
+        chunks=(3000,),
+        compression="gzip",
+        shuffle=True,
+    )
+    f.create_dataset("be_f32_2d", data=make_rows_2d(WIDE_ROWS).astype(">f4"))
+
+    # Half precision in both byte orders, widened to FLOAT.
+    halves = (np.arange(ROWS) % 2048).astype(np.float64)
+    f.create_dataset("f16", data=halves.astype("<f2"))
+    f.create_dataset("f16_be_deflate", data=halves.astype(">f2"), chunks=(4096,), compression="gzip")
+    f.create_dataset("f16_special", data=np.array(HALF_SPECIALS, dtype="<f2"))
+    f.create_dataset("f16_special_be", data=np.array(HALF_SPECIALS, dtype=">f2"))
+
+print(f"Created {output_path.name} successfully!")
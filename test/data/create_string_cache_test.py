@@ -0,0 +1,48 @@
+#!/usr/bin/env python3
+"""Create string datasets large enough for h5_read string cache windows."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 50_000
+CHUNK_ROWS = 1000
+
+
+def create_fixed_string_dataset(group, name, values, size, strpad, chunks=None):
+    tid = h5py.h5t.C_S1.copy()
+    tid.set_size(size)
+    tid.set_cset(h5py.h5t.CSET_ASCII)
+    tid.set_strpad(strpad)
+
+    sid = h5py.h5s.create_simple((len(values),))
+    dcpl = h5py.h5p.create(h5py.h5p.DATASET_CREATE)
+    if chunks:
+        dcpl.set_chunk((chunks,))
+    ds = h5py.h5d.create(group.id, name.encode(), tid, sid, dcpl=dcpl)
+    ds.write(h5py.h5s.ALL, h5py.h5s.ALL, np.array(values, dtype=f"S{size}"))
+
+
+output_path = Path(__file__).with_name("string_cache.h5")
+
+with h5py.File(output_path, "w") as f:
+    rows = range(ROWS)
+
+    # Fixed-length values longer than DuckDB's inline string size, chunked and null-padded.
+    create_fixed_string_dataset(
+        f, "fixed_long", [f"event-label-{i:06d}".encode() for i in rows], 24, h5py.h5t.STR_NULLPAD, CHUNK_ROWS
+    )
+    # Short space-padded values in a contiguous dataset.
+    create_fixed_string_dataset(f, "fixed_short", [f"c{i % 100}".encode() for i in rows], 8, h5py.h5t.STR_SPACEPAD)
+
+    # Variable-length values mixing empty, inlined, and heap-allocated strings.
+    vlen = ["" if i % 7 == 0 else "x" * (i % 40) + f"-{i}" for i in rows]
+    f.create_dataset("vlen", data=vlen, dtype=h5py.string_dtype("ascii"), chunks=(CHUNK_ROWS,))
+
+    # Variable-length UTF-8 values.
+    utf8 = [f"Δ{i % 10}é" for i in rows]
+    f.create_dataset("utf8", data=utf8, dtype=h5py.string_dtype("utf-8"), chunks=(CHUNK_ROWS,))
+
+print(f"Created {output_path.name} successfully!")
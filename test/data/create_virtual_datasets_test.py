@@ -0,0 +1,59 @@
+#!/usr/bin/env python3
+"""Create virtual datasets stitched from per-module source files, for h5_read scans of their sources."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+MODULE_ROWS = [2500, 2500, 2500, 1000]
+LOCAL_ROWS = [3000, 2000]
+
+data_dir = Path(__file__).parent
+output_path = data_dir / "virtual_datasets.h5"
+total_rows = sum(MODULE_ROWS)
+
+# Module files hold consecutive rows: data is the row number within the virtual datasets.
+first_row = 0
+for module, rows in enumerate(MODULE_ROWS):
+    data = np.arange(first_row, first_row + rows, dtype=np.int64)
+    with h5py.File(data_dir / f"virtual_module_{module}.h5", "w") as f:
+        f.create_dataset("data", data=data, chunks=(500,), compression="gzip")
+        frames = data[:, np.newaxis].astype(np.int32) * 4 + np.arange(4, dtype=np.int32)
+        f.create_dataset("frames", data=frames)
+    first_row += rows
+
+with h5py.File(output_path, "w") as f:
+    # Source files are named relative to this file, as detector software writes them.
+    data_layout = h5py.VirtualLayout(shape=(total_rows,), dtype=np.int64)
+    frames_layout = h5py.VirtualLayout(shape=(total_rows, 4), dtype=np.int32)
+    first_row = 0
+    for module, rows in enumerate(MODULE_ROWS):
+        source_file = f"virtual_module_{module}.h5"
+        data_layout[first_row : first_row + rows] = h5py.VirtualSource(source_file, "data", shape=(rows,))
+        frames_layout[first_row : first_row + rows, :] = h5py.VirtualSource(source_file, "frames", shape=(rows, 4))
+        first_row += rows
+    f.create_virtual_dataset("data", data_layout, fillvalue=-1)
+    f.create_virtual_dataset("frames", frames_layout, fillvalue=-1)
+
+    # Sources in the virtual datasets' own file ("."): twice the row number.
+    local = f.create_group("local")
+    first_row = 0
+    for part, rows in enumerate(LOCAL_ROWS):
+        local.create_dataset(f"part_{part}", data=np.arange(first_row, first_row + rows, dtype=np.int64) * 2)
+        first_row += rows
+    local_layout = h5py.VirtualLayout(shape=(sum(LOCAL_ROWS),), dtype=np.int64)
+    gapped_layout = h5py.VirtualLayout(shape=(sum(LOCAL_ROWS) + 1000,), dtype=np.int64)
+    first_row = 0
+    for part, rows in enumerate(LOCAL_ROWS):
+        source = h5py.VirtualSource(".", f"local/part_{part}", shape=(rows,))
+        local_layout[first_row : first_row + rows] = source
+        # Rows 3000-3999 have no source and read as the fill value
+        gapped_first_row = first_row + 1000 * part
+        gapped_layout[gapped_first_row : gapped_first_row + rows] = source
+        first_row += rows
+    f.create_virtual_dataset("local_data", local_layout, fillvalue=-1)
+    f.create_virtual_dataset("gapped", gapped_layout, fillvalue=-1)
+
+print(f"Created {output_path.name} and {len(MODULE_ROWS)} module files successfully!")
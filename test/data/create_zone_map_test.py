@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+"""Create chunked numeric datasets for h5_read per-chunk min/max zone maps."""
+
+from pathlib import Path
+
+import h5py
+import numpy as np
+
+
+ROWS = 100_000
+CHUNK_ROWS = 1000
+
+
+output_path = Path(__file__).with_name("zone_map.h5")
+
+with h5py.File(output_path, "w") as f:
+    rows = np.arange(ROWS, dtype=np.int64)
+
+    # Sorted and clustered columns: selective filters only match a few chunks.
+    f.create_dataset("energy", data=rows.astype(np.float64) * 0.5, chunks=(CHUNK_ROWS,), compression="gzip")
+    f.create_dataset("event_id", data=rows * 3 + 1, chunks=(CHUNK_ROWS,))
+    f.create_dataset("detector", data=(rows // 10_000).astype(np.uint8), chunks=(CHUNK_ROWS,), shuffle=True)
+
+    # Unsorted column whose chunks all span the full value range, so nothing can be skipped.
+    f.create_dataset("wrapped", data=(rows % 997).astype(np.int32), chunks=(CHUNK_ROWS,))
+
+    # Large unsigned values exercise width-preserving min/max values.
+    f.create_dataset("big_u64", data=np.uint64(2**63) + rows.astype(np.uint64), chunks=(CHUNK_ROWS,))
+
+    # Chunks containing NaN never get statistics and are always scanned.
+    with_nan = rows.astype(np.float32)
+    with_nan[[1500, 42_000, 99_999]] = np.nan
+    f.create_dataset("with_nan", data=with_nan, chunks=(CHUNK_ROWS,))
+
+    # 768-row chunks leave a partial last chunk.
+    f.create_dataset("ragged", data=rows.astype(np.int32), chunks=(768,))
+
+    # Not chunked, so no zone map is kept.
+    f.create_dataset("contiguous", data=rows.astype(np.int32))
+
+print(f"Created {output_path.name} successfully!")
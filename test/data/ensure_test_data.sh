@@ -39,6 +39,19 @@ required_files=(
   "$PROJECT_ROOT/test/data/nd_cache_test.h5"
   "$PROJECT_ROOT/test/data/cache_boundaries.h5"
   "$PROJECT_ROOT/test/data/cache_progress.h5"
+  "$PROJECT_ROOT/test/data/chunk_filters.h5"
+  "$PROJECT_ROOT/test/data/stored_types.h5"
+  "$PROJECT_ROOT/test/data/late_materialization.h5"
+  "$PROJECT_ROOT/test/data/column_statistics.h5"
+  "$PROJECT_ROOT/test/data/column_statistics_more.h5"
+  "$PROJECT_ROOT/test/data/paged_metadata.h5"
+  "$PROJECT_ROOT/test/data/virtual_datasets.h5"
+  "$PROJECT_ROOT/test/data/virtual_module_3.h5"
+  "$PROJECT_ROOT/test/data/enum_dictionary.h5"
+  "$PROJECT_ROOT/test/data/zone_map.h5"
+  "$PROJECT_ROOT/test/data/string_cache.h5"
+  "$PROJECT_ROOT/test/data/run_windows.h5"
+  "$PROJECT_ROOT/test/data/compound.h5"
   "$PROJECT_ROOT/test/data/sparse_pushdown_cache.h5"
   "$PROJECT_ROOT/test/data/sparse_partition_pushdown.h5"
   "$PROJECT_ROOT/test/data/wide_few_rows.h5"
@@ -164,6 +164,50 @@ echo ""
 echo -e "${GREEN}[18/28] Generating cache_progress.h5${NC}"
 (cd test/data && "$PYTHON_BIN" create_cache_progress_test.py)
 
+echo ""
+echo -e "${GREEN}[18b/28] Generating chunk_filters.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_chunk_filters_test.py)
+
+echo ""
+echo -e "${GREEN}[18b2/28] Generating stored_types.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_stored_types_test.py)
+
+echo ""
+echo -e "${GREEN}[18b3/28] Generating late_materialization.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_late_materialization_test.py)
+
+echo ""
+echo -e "${GREEN}[18b4/28] Generating column_statistics.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_column_statistics_test.py)
+
+echo ""
+echo -e "${GREEN}[18b5/28] Generating paged_metadata.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_paged_metadata_test.py)
+
+echo ""
+echo -e "${GREEN}[18b6/28] Generating virtual_datasets.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_virtual_datasets_test.py)
+
+echo ""
+echo -e "${GREEN}[18b7/28] Generating enum_dictionary.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_enum_dictionary_test.py)
+
+echo ""
+echo -e "${GREEN}[18c/28] Generating zone_map.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_zone_map_test.py)
+
+echo ""
+echo -e "${GREEN}[18d/28] Generating string_cache.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_string_cache_test.py)
+
+echo ""
+echo -e "${GREEN}[18e/28] Generating run_windows.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_run_windows_test.py)
+
+echo ""
+echo -e "${GREEN}[18f/28] Generating compound.h5${NC}"
+(cd test/data && "$PYTHON_BIN" create_compound_test.py)
+
 echo ""
 echo -e "${GREEN}[19/28] Generating sparse_pushdown_cache.h5${NC}"
 (cd test/data && "$PYTHON_BIN" create_sparse_pushdown_cache_test.py)
@@ -262,6 +306,13 @@ echo "    - multidim_mismatch.h5    (multidim row-count mismatch)"
 echo "    - nd_cache_test.h5        (N-D cache coverage)"
 echo "    - cache_boundaries.h5     (regular cache row-count boundaries)"
 echo "    - cache_progress.h5       (h5_read cache-progress boundaries)"
+echo "    - chunk_filters.h5        (chunk-direct deflate/shuffle decoding)"
+echo "    - virtual_datasets.h5     (virtual datasets over virtual_module_*.h5 sources)"
+echo "    - enum_dictionary.h5      (ENUM columns and dictionary string windows)"
+echo "    - zone_map.h5             (per-chunk min/max zone maps)"
+echo "    - string_cache.h5         (cached fixed/variable-length string windows)"
+echo "    - run_windows.h5          (run-encoded columns spanning several run windows)"
+echo "    - compound.h5             (compound datasets read as field columns)"
 echo "    - sparse_pushdown_cache.h5 (sparse pushdown cache coverage)"
 echo "    - sparse_partition_pushdown.h5 (sparse pushdown across logical partitions)"
 echo "    - wide_few_rows.h5        (wide-row cache/threading coverage)"
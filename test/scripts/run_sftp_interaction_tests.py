@@ -1442,6 +1442,39 @@ class SFTPInteractionTests(unittest.TestCase):
         )
         self.assertGreater(read_calls, 0)
 
+    def _count_connections_for_repeated_queries(self, pool_setting: str) -> int:
+        url = f"sftp://127.0.0.1:{self.password_server.port}/simple.h5"
+        sql = textwrap.dedent(
+            f"""
+            LOAD h5db;
+            {pool_setting}
+            CREATE OR REPLACE TEMPORARY SECRET pooled_connection (
+                TYPE sftp,
+                SCOPE 'sftp://127.0.0.1:{self.password_server.port}/',
+                USERNAME 'h5db',
+                PASSWORD 'h5db',
+                KNOWN_HOSTS_PATH '{self.password_known_hosts}',
+                PORT {self.password_server.port}
+            );
+            SELECT COUNT(*) FROM h5_tree('{url}');
+            SELECT COUNT(*) FROM h5_ls('{url}', '/');
+            SELECT COUNT(*) FROM h5_tree('{url}');
+            """
+        ).strip()
+        result = self.run_sql(sql)
+        self.assertEqual(result.returncode, 0, msg=result.output)
+        self.assertEqual(self.numeric_stdout_lines(result), ["10", "5", "10"], msg=result.output)
+        connections, _ = self.password_server.telemetry.snapshot()
+        return len(connections)
+
+    def test_repeated_queries_reuse_pooled_sftp_connection(self) -> None:
+        self.assertEqual(self._count_connections_for_repeated_queries(""), 1)
+        self.assertGracefulSftpCleanup(self.password_server, expected_connections=1)
+
+    def test_disabled_sftp_pool_connects_per_query(self) -> None:
+        self.assertEqual(self._count_connections_for_repeated_queries("SET h5db_sftp_pool_size = 0;"), 3)
+        self.assertGracefulSftpCleanup(self.password_server, expected_connections=3)
+
     def test_single_query_reuses_sftp_connection_across_h5_tree_and_h5_ls(self) -> None:
         url = f"sftp://127.0.0.1:{self.password_server.port}/simple.h5"
         sql = textwrap.dedent(
@@ -1521,6 +1554,43 @@ class SFTPInteractionTests(unittest.TestCase):
         finally:
             self.password_server.config.list_folder_omit_permissions = False
 
+    def _count_glob_crawl_rows_and_connections(self, concurrency: int) -> tuple[list[str], int]:
+        pattern = f"sftp://127.0.0.1:{self.password_server.port}/glob/**/glob_same_*.h5"
+        sql = textwrap.dedent(
+            f"""
+            LOAD h5db;
+            SET h5db_sftp_glob_concurrency = {concurrency};
+            CREATE OR REPLACE TEMPORARY SECRET concurrent_glob (
+                TYPE sftp,
+                SCOPE 'sftp://127.0.0.1:{self.password_server.port}/',
+                USERNAME 'h5db',
+                PASSWORD 'h5db',
+                KNOWN_HOSTS_PATH '{self.password_known_hosts}',
+                PORT {self.password_server.port}
+            );
+            SELECT COUNT(*) FROM h5_read('{pattern}', '/values');
+            SELECT COUNT(*) FROM h5_read('{pattern}', '/values');
+            """
+        ).strip()
+        result = self.run_sql(sql)
+        self.assertEqual(result.returncode, 0, msg=result.output)
+        connections, _ = self.password_server.telemetry.snapshot()
+        return self.numeric_stdout_lines(result), len(connections)
+
+    def test_sftp_glob_crawl_on_query_connection_without_concurrency(self) -> None:
+        rows, connections = self._count_glob_crawl_rows_and_connections(1)
+        self.assertEqual(rows, ["6", "6"])
+        self.assertEqual(connections, 1)
+
+    def test_sftp_glob_crawl_lists_directories_on_pooled_connections(self) -> None:
+        rows, connections = self._count_glob_crawl_rows_and_connections(8)
+        self.assertEqual(rows, ["6", "6"])
+        # The query's own connection plus at most one per listing in flight; glob connections are pooled between
+        # the two queries.
+        self.assertGreaterEqual(connections, 1)
+        self.assertLessEqual(connections, 9)
+        self.assertGracefulSftpCleanup(self.password_server, expected_connections=connections)
+
     def test_missing_sftp_glob_treats_generic_exact_fallback_stat_failure_as_no_match(self) -> None:
         self.password_server.config.fail_stat_paths.add("/glob/no_such_*.h5")
         try: